@@ -0,0 +1,372 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// End-to-end benchmark of the client side of a Cognito SRP sign in.
+//
+// Every handshake drives `AmplifySRPClient`, reached through the
+// `SRPBenchmark` SPI, through the same steps as the sign in state machine:
+// creating the client on the shared key pool, `generateClientKeyPair`,
+// `calculateSharedSecretValue`, `generateAuthenticationKey` and
+// `generateDevicePasswordVerifier`. An in-process server stand-in supplies
+// the salt and B, so no network access is needed.
+//
+// Handshakes run on 1 and on N concurrent tasks and the results are printed
+// to stdout as one JSON document:
+//
+//   {"benchmark": "srp_handshake", "group_bits": 3072, "results": [{"concurrency": 1,
+//     "handshakes": ..., "p50_ms": ..., "p99_ms": ..., "handshakes_per_sec": ...,
+//     "handshakes_per_sec_per_core": ..., "allocs_per_handshake": ..., ...}, ...]}
+//
+// Allocation counts are null on platforms where they cannot be observed.
+//
+// Usage: swift run -c release AmplifySRPBenchmark
+//            [--min-time-ms N] [--concurrency N[,N...]] [--random secure|buffered]
+//            [--key-pool shared|none]
+
+import AmplifyBigInteger
+import AmplifySRP
+import AmplifySRPBenchmarkSupport
+@_spi(SRPBenchmark) import AWSCognitoAuthPlugin
+import CryptoKit
+import Foundation
+
+// MARK: - Configuration
+
+struct BenchmarkOptions {
+    var minTimeMilliseconds = 2_000
+    var concurrencyLevels = [1, ProcessInfo.processInfo.activeProcessorCount]
+    var useBufferedRandom = false
+    var usesSharedKeyPool = true
+
+    init(arguments: [String]) {
+        var iterator = arguments.dropFirst().makeIterator()
+        while let argument = iterator.next() {
+            switch argument {
+            case "--min-time-ms":
+                minTimeMilliseconds = iterator.next().flatMap(Int.init) ?? minTimeMilliseconds
+            case "--concurrency":
+                let levels = iterator.next()?.split(separator: ",").compactMap { Int($0) } ?? []
+                if !levels.isEmpty {
+                    concurrencyLevels = levels.filter { $0 > 0 }
+                }
+            case "--random":
+                useBufferedRandom = iterator.next() == "buffered"
+            case "--key-pool":
+                usesSharedKeyPool = iterator.next() != "none"
+            default:
+                FileHandle.standardError.write(Data(
+                    ("usage: AmplifySRPBenchmark [--min-time-ms N] [--concurrency N[,N...]] " +
+                        "[--random secure|buffered] [--key-pool shared|none]\n").utf8))
+                exit(1)
+            }
+        }
+    }
+
+    var randomSource: SRPRandomSource {
+        useBufferedRandom ? BufferedSRPRandomSource() : SecureSRPRandomSource()
+    }
+}
+
+let username = "benchmark-user"
+let password = "benchmark-password"
+let deviceGroupKey = "benchmark-device-group"
+let deviceKey = "benchmark-device"
+
+// MARK: - Server stand-in
+
+/// The values a Cognito user pool returns in the `PASSWORD_VERIFIER` challenge
+struct SRPServerChallenge {
+    let privateB: BigInt
+    let publicBHexValue: String
+}
+
+// swiftlint:disable identifier_name
+/// Holds the verifier of a single user and answers handshakes the way the
+/// user pool does, see https://datatracker.ietf.org/doc/html/rfc5054
+struct SRPServerStandIn {
+
+    let commonState: SRPCommonState
+    let salt: BigInt
+    let verifier: BigInt
+
+    var saltHexValue: String {
+        salt.asString(radix: 16)
+    }
+
+    init(commonState: SRPCommonState, username: String, password: String) {
+        self.commonState = commonState
+        self.salt = BigInt(unsignedData: SecureSRPRandomSource().randomBytes(count: 16))
+
+        // x = SHA(<salt> | SHA(<username> | ":" | <raw password>)), v = g^x
+        let usernamePasswordHash = SHA256.hash(data: [UInt8]("\(username):\(password)".utf8))
+        let xHash = SHA256.hash(data: AmplifyBigIntHelper.getSignedData(num: salt) + usernamePasswordHash)
+        let x = BigInt(unsignedData: [UInt8](xHash))
+        self.verifier = commonState.generator.pow(x, modulus: commonState.prime)
+    }
+
+    /// B = k*v + g^b (mod N)
+    func makeChallenge() -> SRPServerChallenge {
+        let N = commonState.prime
+        let b = BigInt.random(below: N)
+        let B = ((commonState.k * verifier) + commonState.generator.pow(b, modulus: N)) % N
+        return SRPServerChallenge(privateB: b, publicBHexValue: B.asString(radix: 16))
+    }
+
+    /// S = (A * v^u)^b (mod N), which must match the client's premaster secret
+    func premasterSecret(clientPublicKeyHexValue: String, challenge: SRPServerChallenge) -> [UInt8]? {
+        guard let A = BigInt(clientPublicKeyHexValue, radix: 16),
+              let B = BigInt(challenge.publicBHexValue, radix: 16) else {
+            return nil
+        }
+        let N = commonState.prime
+        let u = SRPClientState.calculcateU(
+            publicClientKey: AmplifyBigIntHelper.getSignedData(num: A),
+            publicServerKey: AmplifyBigIntHelper.getSignedData(num: B)
+        )
+        let base = (A * verifier.pow(u, modulus: N)) % N
+        return AmplifyBigIntHelper.getSignedData(num: base.pow(challenge.privateB, modulus: N))
+    }
+}
+// swiftlint:enable identifier_name
+
+// MARK: - Handshake
+
+enum HandshakeStep: Int, CaseIterable {
+    case createClient
+    case generateClientKeyPair
+    case calculateSharedSecretValue
+    case generateAuthenticationKey
+    case generateDevicePasswordVerifier
+
+    var name: String {
+        switch self {
+        case .createClient: return "create_client"
+        case .generateClientKeyPair: return "generate_client_key_pair"
+        case .calculateSharedSecretValue: return "calculate_shared_secret_value"
+        case .generateAuthenticationKey: return "generate_authentication_key"
+        case .generateDevicePasswordVerifier: return "generate_device_password_verifier"
+        }
+    }
+}
+
+struct HandshakeResult {
+    /// Nanoseconds spent in every `HandshakeStep`
+    var stepNanoseconds = [UInt64](repeating: 0, count: HandshakeStep.allCases.count)
+    var clientPublicKeyHexValue = ""
+    var premasterSecret: [UInt8] = []
+
+    var totalNanoseconds: UInt64 {
+        stepNanoseconds.reduce(0, +)
+    }
+}
+
+/// Runs the client side of one handshake against a precomputed challenge.
+func runHandshake(
+    server: SRPServerStandIn,
+    challenge: SRPServerChallenge,
+    randomSource: SRPRandomSource,
+    usesSharedKeyPool: Bool
+) throws -> HandshakeResult {
+    var result = HandshakeResult()
+    var start = DispatchTime.now().uptimeNanoseconds
+
+    func lap(_ step: HandshakeStep) {
+        let now = DispatchTime.now().uptimeNanoseconds
+        result.stepNanoseconds[step.rawValue] = now - start
+        start = now
+    }
+
+    let client = try SRPBenchmarkClient(randomSource: randomSource, usesSharedKeyPool: usesSharedKeyPool)
+    lap(.createClient)
+
+    let keys = client.generateClientKeyPair()
+    lap(.generateClientKeyPair)
+
+    let sharedSecret = try client.calculateSharedSecretValue(
+        username: username,
+        password: password,
+        saltHexValue: server.saltHexValue,
+        clientPrivateKeyHexValue: keys.privateKeyHexValue,
+        clientPublicKeyHexValue: keys.publicKeyHexValue,
+        serverPublicKeyHexValue: challenge.publicBHexValue
+    )
+    lap(.calculateSharedSecretValue)
+
+    _ = SRPBenchmarkClient.generateAuthenticationKey(sharedSecret: sharedSecret)
+    lap(.generateAuthenticationKey)
+
+    _ = client.generateDevicePasswordVerifier(
+        deviceGroupKey: deviceGroupKey,
+        deviceKey: deviceKey,
+        password: password
+    )
+    lap(.generateDevicePasswordVerifier)
+
+    result.clientPublicKeyHexValue = keys.publicKeyHexValue
+    result.premasterSecret = sharedSecret.premasterSecret
+    return result
+}
+
+// MARK: - Measurement
+
+struct Measurement {
+    let concurrency: Int
+    let wallNanoseconds: UInt64
+    let handshakes: [HandshakeResult]
+    let allocations: UInt64?
+    let allocationBytes: UInt64?
+}
+
+/// Runs handshakes on `concurrency` tasks until `minTimeMilliseconds` have passed.
+func measure(
+    concurrency: Int,
+    options: BenchmarkOptions,
+    server: SRPServerStandIn,
+    challenges: [SRPServerChallenge],
+    countsAllocations: Bool
+) async throws -> Measurement {
+    let deadline = DispatchTime.now().uptimeNanoseconds + UInt64(options.minTimeMilliseconds) * 1_000_000
+    let allocationsBefore = amplifyBenchmarkAllocationCount()
+    let allocationBytesBefore = amplifyBenchmarkAllocationBytes()
+    let start = DispatchTime.now().uptimeNanoseconds
+
+    let handshakes = try await withThrowingTaskGroup(of: [HandshakeResult].self) { group in
+        for worker in 0 ..< concurrency {
+            group.addTask {
+                let randomSource = options.randomSource
+                var results: [HandshakeResult] = []
+                var index = worker
+                repeat {
+                    let challenge = challenges[index % challenges.count]
+                    results.append(try runHandshake(
+                        server: server,
+                        challenge: challenge,
+                        randomSource: randomSource,
+                        usesSharedKeyPool: options.usesSharedKeyPool
+                    ))
+                    index += concurrency
+                } while DispatchTime.now().uptimeNanoseconds < deadline
+                return results
+            }
+        }
+        var all: [HandshakeResult] = []
+        for try await results in group {
+            all.append(contentsOf: results)
+        }
+        return all
+    }
+
+    let wallNanoseconds = DispatchTime.now().uptimeNanoseconds - start
+    return Measurement(
+        concurrency: concurrency,
+        wallNanoseconds: wallNanoseconds,
+        handshakes: handshakes,
+        allocations: countsAllocations ? amplifyBenchmarkAllocationCount() - allocationsBefore : nil,
+        allocationBytes: countsAllocations ? amplifyBenchmarkAllocationBytes() - allocationBytesBefore : nil
+    )
+}
+
+func percentile(_ sorted: [UInt64], _ fraction: Double) -> Double {
+    guard !sorted.isEmpty else {
+        return 0
+    }
+    let rank = Int((fraction * Double(sorted.count - 1)).rounded())
+    return Double(sorted[rank])
+}
+
+func milliseconds(_ nanoseconds: Double) -> String {
+    String(format: "%.4f", nanoseconds / 1_000_000)
+}
+
+func json(_ measurement: Measurement) -> String {
+    let count = measurement.handshakes.count
+    let totals = measurement.handshakes.map(\.totalNanoseconds).sorted()
+    let mean = Double(totals.reduce(0, +)) / Double(max(count, 1))
+    let perSecond = Double(count) / (Double(measurement.wallNanoseconds) / 1_000_000_000)
+    let cores = min(measurement.concurrency, ProcessInfo.processInfo.activeProcessorCount)
+
+    let steps = HandshakeStep.allCases.map { step -> String in
+        let samples = measurement.handshakes.map { $0.stepNanoseconds[step.rawValue] }.sorted()
+        return "\"\(step.name)\": \(milliseconds(percentile(samples, 0.5)))"
+    }.joined(separator: ", ")
+
+    func perHandshake(_ value: UInt64?) -> String {
+        guard let value, count > 0 else {
+            return "null"
+        }
+        return String(format: "%.1f", Double(value) / Double(count))
+    }
+
+    return "{\"concurrency\": \(measurement.concurrency), \"handshakes\": \(count), " +
+        "\"p50_ms\": \(milliseconds(percentile(totals, 0.5))), " +
+        "\"p99_ms\": \(milliseconds(percentile(totals, 0.99))), " +
+        "\"mean_ms\": \(milliseconds(mean)), " +
+        "\"handshakes_per_sec\": \(String(format: "%.2f", perSecond)), " +
+        "\"handshakes_per_sec_per_core\": \(String(format: "%.2f", perSecond / Double(cores))), " +
+        "\"allocs_per_handshake\": \(perHandshake(measurement.allocations)), " +
+        "\"alloc_bytes_per_handshake\": \(perHandshake(measurement.allocationBytes)), " +
+        "\"step_p50_ms\": {\(steps)}}"
+}
+
+// MARK: - Main
+
+let options = BenchmarkOptions(arguments: CommandLine.arguments)
+if options.useBufferedRandom {
+    // the library's own draws take the same generator as the key source
+    AmplifyRandomGenerator.installBufferedGenerator()
+}
+let countsAllocations = amplifyBenchmarkStartCountingAllocations() != 0
+
+// swiftlint:disable:next force_unwrapping
+let prime = BigInt(SRPBenchmarkClient.nHexValue, radix: 16)!
+// swiftlint:disable:next force_unwrapping
+let generator = BigInt(SRPBenchmarkClient.gHexValue, radix: 16)!
+let server = SRPServerStandIn(
+    commonState: SRPCommonState(prime: prime, generator: generator),
+    username: username,
+    password: password
+)
+
+// Server work is kept out of the measured window by answering from a pool
+// of precomputed challenges.
+let challenges = (0 ..< 64).map { _ in server.makeChallenge() }
+
+// Warm up and check that client and server agree on the shared secret.
+for challenge in challenges.prefix(4) {
+    let result = try runHandshake(
+        server: server,
+        challenge: challenge,
+        randomSource: options.randomSource,
+        usesSharedKeyPool: options.usesSharedKeyPool
+    )
+    let expected = server.premasterSecret(
+        clientPublicKeyHexValue: result.clientPublicKeyHexValue,
+        challenge: challenge
+    )
+    guard result.premasterSecret == expected else {
+        FileHandle.standardError.write(Data("client and server shared secrets differ\n".utf8))
+        exit(1)
+    }
+}
+
+var results: [String] = []
+for concurrency in options.concurrencyLevels {
+    let measurement = try await measure(
+        concurrency: concurrency,
+        options: options,
+        server: server,
+        challenges: challenges,
+        countsAllocations: countsAllocations
+    )
+    results.append(json(measurement))
+}
+
+print("{\"benchmark\": \"srp_handshake\", \"group_bits\": \(prime.unsignedByteArray.count * 8), " +
+      "\"random\": \"\(options.useBufferedRandom ? "buffered" : "secure")\", " +
+      "\"key_pool\": \"\(options.usesSharedKeyPool ? "shared" : "none")\", " +
+      "\"cores\": \(ProcessInfo.processInfo.activeProcessorCount), " +
+      "\"results\": [\n  \(results.joined(separator: ",\n  "))\n]}")
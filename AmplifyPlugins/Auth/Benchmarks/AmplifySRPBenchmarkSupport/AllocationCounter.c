@@ -0,0 +1,61 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/AmplifySRPBenchmarkSupport.h"
+
+// Counters are shared by all benchmark threads.
+static uint64_t allocationCount;
+static uint64_t allocationBytes;
+
+static void recordAllocation(uint64_t bytes) {
+    __atomic_fetch_add(&allocationCount, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&allocationBytes, bytes, __ATOMIC_RELAXED);
+}
+
+#if defined(__APPLE__)
+
+// libmalloc reports every allocation to this hook while it is set, it is the
+// same mechanism MallocStackLogging uses.
+typedef void (mallocLogger)(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3,
+                            uintptr_t result, uint32_t numHotFramesToSkip);
+extern mallocLogger *malloc_logger;
+
+#define MALLOC_LOG_TYPE_ALLOCATE   2
+#define MALLOC_LOG_TYPE_DEALLOCATE 4
+
+static void countingMallocLogger(uint32_t type, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3,
+                                 uintptr_t result, uint32_t numHotFramesToSkip) {
+    (void)arg1;
+    (void)result;
+    (void)numHotFramesToSkip;
+    if ((type & MALLOC_LOG_TYPE_ALLOCATE) == 0) {
+        return;
+    }
+    // realloc is logged as allocate + deallocate with the new size in arg3
+    recordAllocation((type & MALLOC_LOG_TYPE_DEALLOCATE) != 0 ? arg3 : arg2);
+}
+
+int amplifyBenchmarkStartCountingAllocations(void) {
+    malloc_logger = countingMallocLogger;
+    return 1;
+}
+
+#else
+
+int amplifyBenchmarkStartCountingAllocations(void) {
+    return 0;
+}
+
+#endif
+
+uint64_t amplifyBenchmarkAllocationCount(void) {
+    return __atomic_load_n(&allocationCount, __ATOMIC_RELAXED);
+}
+
+uint64_t amplifyBenchmarkAllocationBytes(void) {
+    return __atomic_load_n(&allocationBytes, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,23 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef AmplifySRPBenchmarkSupport_h
+#define AmplifySRPBenchmarkSupport_h
+
+#include <stdint.h>
+
+/// Starts counting heap allocations of the whole process.
+/// Returns 0 when allocations cannot be observed on this platform.
+int amplifyBenchmarkStartCountingAllocations(void);
+
+/// Number of allocations (malloc, calloc, realloc) observed so far.
+uint64_t amplifyBenchmarkAllocationCount(void);
+
+/// Number of bytes requested by the allocations observed so far.
+uint64_t amplifyBenchmarkAllocationBytes(void);
+
+#endif /* AmplifySRPBenchmarkSupport_h */
@@ -0,0 +1,329 @@
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* Micro-benchmark for the libtommathAmplify primitives.
+ *
+ * Every operation is timed at operand sizes from 256 to 8192 bits and the
+ * results are printed to stdout as one JSON document:
+ *
+ *   {"digit_bits": 60, "results": [{"op": "mul", "bits": 256, "iterations": ...,
+ *     "ns_per_op": ..., "cycles_per_op": ..., "allocs_per_op": ..., "alloc_bytes_per_op": ...}, ...]}
+ *
+ * cycles_per_op is only reported on x86_64 (TSC ticks), allocation counts only
+ * with glibc, where the heap functions are interposed; both are null otherwise.
+ *
+ * Usage: libtommathAmplifyBenchmark [--min-time-ms N] [--op NAME] [--bits N]
+ */
+
+#include "libtommathAmplify.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  include <x86intrin.h>
+#  define BENCH_HAS_CYCLES 1
+#  define BENCH_CYCLES() __rdtsc()
+#else
+#  define BENCH_HAS_CYCLES 0
+#  define BENCH_CYCLES() 0uLL
+#endif
+
+/* allocation counting */
+static unsigned long long s_allocs, s_alloc_bytes;
+
+#if defined(__GLIBC__)
+#  define BENCH_HAS_ALLOCS 1
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *mem, size_t size);
+extern void __libc_free(void *mem);
+
+void *malloc(size_t size)
+{
+   s_allocs++;
+   s_alloc_bytes += size;
+   return __libc_malloc(size);
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+   s_allocs++;
+   s_alloc_bytes += nmemb * size;
+   return __libc_calloc(nmemb, size);
+}
+
+void *realloc(void *mem, size_t size)
+{
+   s_allocs++;
+   s_alloc_bytes += size;
+   return __libc_realloc(mem, size);
+}
+
+void free(void *mem)
+{
+   __libc_free(mem);
+}
+#else
+#  define BENCH_HAS_ALLOCS 0
+#endif
+
+typedef struct {
+   int bits;
+   amplify_mp_int a, b, c, d, m;
+   char *str;
+   size_t str_len;
+   unsigned char *bin;
+   size_t bin_len;
+} bench_ctx;
+
+typedef struct {
+   const char *name;
+   amplify_mp_err(*run)(bench_ctx *ctx);
+} bench_op;
+
+static amplify_mp_err s_run_mul(bench_ctx *ctx)
+{
+   return amplify_mp_mul(&ctx->a, &ctx->b, &ctx->c);
+}
+
+static amplify_mp_err s_run_sqr(bench_ctx *ctx)
+{
+   return amplify_mp_sqr(&ctx->a, &ctx->c);
+}
+
+static amplify_mp_err s_run_exptmod(bench_ctx *ctx)
+{
+   return amplify_mp_exptmod(&ctx->a, &ctx->b, &ctx->m, &ctx->c);
+}
+
+/* 2n-bit by n-bit division */
+static amplify_mp_err s_run_div(bench_ctx *ctx)
+{
+   return amplify_mp_div(&ctx->d, &ctx->m, &ctx->c, NULL);
+}
+
+static amplify_mp_err s_run_invmod(bench_ctx *ctx)
+{
+   return amplify_mp_invmod(&ctx->a, &ctx->m, &ctx->c);
+}
+
+static amplify_mp_err s_run_to_radix_16(bench_ctx *ctx)
+{
+   return amplify_mp_to_radix(&ctx->a, ctx->str, ctx->str_len, NULL, 16);
+}
+
+static amplify_mp_err s_run_to_radix_10(bench_ctx *ctx)
+{
+   return amplify_mp_to_radix(&ctx->a, ctx->str, ctx->str_len, NULL, 10);
+}
+
+static amplify_mp_err s_run_read_radix_16(bench_ctx *ctx)
+{
+   amplify_mp_err err;
+   if ((err = amplify_mp_to_radix(&ctx->a, ctx->str, ctx->str_len, NULL, 16)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_mp_read_radix(&ctx->c, ctx->str, 16);
+}
+
+static amplify_mp_err s_run_to_ubin(bench_ctx *ctx)
+{
+   return amplify_mp_to_ubin(&ctx->a, ctx->bin, ctx->bin_len, NULL);
+}
+
+static amplify_mp_err s_run_from_ubin(bench_ctx *ctx)
+{
+   return amplify_mp_from_ubin(&ctx->c, ctx->bin, ctx->bin_len);
+}
+
+static const bench_op s_ops[] = {
+   { "mul",            s_run_mul },
+   { "sqr",            s_run_sqr },
+   { "exptmod",        s_run_exptmod },
+   { "div",            s_run_div },
+   { "invmod",         s_run_invmod },
+   { "to_radix_16",    s_run_to_radix_16 },
+   { "to_radix_10",    s_run_to_radix_10 },
+   { "read_radix_16",  s_run_read_radix_16 },
+   { "to_ubin",        s_run_to_ubin },
+   { "from_ubin",      s_run_from_ubin }
+};
+
+static const int s_sizes[] = { 256, 512, 1024, 2048, 3072, 4096, 8192 };
+
+static unsigned long long s_time_ns(void)
+{
+   struct timespec ts;
+   (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ((unsigned long long)ts.tv_sec * 1000000000uLL) + (unsigned long long)ts.tv_nsec;
+}
+
+/* random number of exactly "bits" bits */
+static amplify_mp_err s_rand_bits(amplify_mp_int *a, int bits)
+{
+   amplify_mp_err err;
+   amplify_mp_int top;
+
+   if ((err = amplify_mp_rand(a, (bits + AMPLIFY_MP_DIGIT_BIT - 1) / AMPLIFY_MP_DIGIT_BIT)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_mod_2d(a, bits - 1, a)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_init(&top)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_2expt(&top, bits - 1)) == AMPLIFY_MP_OKAY) {
+      err = amplify_mp_add(a, &top, a);
+   }
+   amplify_mp_clear(&top);
+   return err;
+}
+
+static amplify_mp_err s_ctx_setup(bench_ctx *ctx, int bits)
+{
+   amplify_mp_err err;
+   int size;
+
+   ctx->bits = bits;
+   if ((err = amplify_mp_init_multi(&ctx->a, &ctx->b, &ctx->c, &ctx->d, &ctx->m, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /* odd modulus, a invertible and smaller than m, b a full size exponent */
+   if ((err = s_rand_bits(&ctx->m, bits)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   ctx->m.dp[0] |= 1u;
+   do {
+      if ((err = s_rand_bits(&ctx->a, bits - 1)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      err = amplify_mp_invmod(&ctx->a, &ctx->m, &ctx->c);
+   } while (err == AMPLIFY_MP_VAL);
+   if (err != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   if ((err = s_rand_bits(&ctx->b, bits)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   if ((err = s_rand_bits(&ctx->d, 2 * bits)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+
+   if ((err = amplify_mp_radix_size(&ctx->d, 10, &size)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   ctx->str_len = (size_t)size;
+   ctx->bin_len = amplify_mp_ubin_size(&ctx->a);
+   ctx->str = (char *)malloc(ctx->str_len);
+   ctx->bin = (unsigned char *)malloc(ctx->bin_len);
+   if ((ctx->str == NULL) || (ctx->bin == NULL)) {
+      err = AMPLIFY_MP_MEM;
+      goto LBL_ERR;
+   }
+   if ((err = amplify_mp_to_ubin(&ctx->a, ctx->bin, ctx->bin_len, NULL)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+
+   return AMPLIFY_MP_OKAY;
+
+LBL_ERR:
+   amplify_mp_clear_multi(&ctx->a, &ctx->b, &ctx->c, &ctx->d, &ctx->m, NULL);
+   return err;
+}
+
+static void s_ctx_clear(bench_ctx *ctx)
+{
+   free(ctx->str);
+   free(ctx->bin);
+   ctx->str = NULL;
+   ctx->bin = NULL;
+   amplify_mp_clear_multi(&ctx->a, &ctx->b, &ctx->c, &ctx->d, &ctx->m, NULL);
+}
+
+static amplify_mp_err s_bench(const bench_op *op, bench_ctx *ctx, unsigned long long min_ns, int *first)
+{
+   unsigned long long iterations = 0u, start_ns, elapsed_ns, start_cycles, cycles, allocs, alloc_bytes;
+   amplify_mp_err err;
+
+   /* warm up, lets the result ints reach their final size */
+   if ((err = op->run(ctx)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   allocs = s_allocs;
+   alloc_bytes = s_alloc_bytes;
+   start_ns = s_time_ns();
+   start_cycles = BENCH_CYCLES();
+   do {
+      if ((err = op->run(ctx)) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+      iterations++;
+      elapsed_ns = s_time_ns() - start_ns;
+   } while (elapsed_ns < min_ns);
+   cycles = BENCH_CYCLES() - start_cycles;
+   allocs = s_allocs - allocs;
+   alloc_bytes = s_alloc_bytes - alloc_bytes;
+
+   printf("%s\n    {\"op\": \"%s\", \"bits\": %d, \"iterations\": %llu, \"ns_per_op\": %.1f",
+          (*first != 0) ? "" : ",", op->name, ctx->bits, iterations, (double)elapsed_ns / (double)iterations);
+   if (BENCH_HAS_CYCLES != 0) {
+      printf(", \"cycles_per_op\": %.1f", (double)cycles / (double)iterations);
+   } else {
+      printf(", \"cycles_per_op\": null");
+   }
+   if (BENCH_HAS_ALLOCS != 0) {
+      printf(", \"allocs_per_op\": %.2f, \"alloc_bytes_per_op\": %.1f}",
+             (double)allocs / (double)iterations, (double)alloc_bytes / (double)iterations);
+   } else {
+      printf(", \"allocs_per_op\": null, \"alloc_bytes_per_op\": null}");
+   }
+   *first = 0;
+   return AMPLIFY_MP_OKAY;
+}
+
+int main(int argc, char **argv)
+{
+   unsigned long long min_ns = 200uLL * 1000000uLL;
+   const char *only_op = NULL;
+   int only_bits = 0, first = 1, i;
+   size_t x, y;
+
+   for (i = 1; i < argc; ++i) {
+      if ((strcmp(argv[i], "--min-time-ms") == 0) && ((i + 1) < argc)) {
+         min_ns = strtoull(argv[++i], NULL, 10) * 1000000uLL;
+      } else if ((strcmp(argv[i], "--op") == 0) && ((i + 1) < argc)) {
+         only_op = argv[++i];
+      } else if ((strcmp(argv[i], "--bits") == 0) && ((i + 1) < argc)) {
+         only_bits = atoi(argv[++i]);
+      } else {
+         fprintf(stderr, "usage: %s [--min-time-ms N] [--op NAME] [--bits N]\n", argv[0]);
+         return EXIT_FAILURE;
+      }
+   }
+
+   /* reproducible operands */
+   amplify_s_mp_rand_jenkins_init(0x5eed5eedu);
+   amplify_mp_rand_source(amplify_s_mp_rand_jenkins);
+
+   printf("{\n  \"digit_bits\": %d,\n  \"results\": [", AMPLIFY_MP_DIGIT_BIT);
+   for (x = 0u; x < (sizeof(s_sizes) / sizeof(s_sizes[0])); ++x) {
+      bench_ctx ctx;
+      amplify_mp_err err;
+
+      if ((only_bits != 0) && (only_bits != s_sizes[x])) {
+         continue;
+      }
+      if ((err = s_ctx_setup(&ctx, s_sizes[x])) != AMPLIFY_MP_OKAY) {
+         fprintf(stderr, "setup failed for %d bits: %s\n", s_sizes[x], amplify_mp_error_to_string(err));
+         return EXIT_FAILURE;
+      }
+      for (y = 0u; y < (sizeof(s_ops) / sizeof(s_ops[0])); ++y) {
+         if ((only_op != NULL) && (strcmp(only_op, s_ops[y].name) != 0)) {
+            continue;
+         }
+         if ((err = s_bench(&s_ops[y], &ctx, min_ns, &first)) != AMPLIFY_MP_OKAY) {
+            fprintf(stderr, "%s failed for %d bits: %s\n", s_ops[y].name, s_sizes[x], amplify_mp_error_to_string(err));
+            s_ctx_clear(&ctx);
+            return EXIT_FAILURE;
+         }
+         fflush(stdout);
+      }
+      s_ctx_clear(&ctx);
+   }
+   printf("\n  ]\n}\n");
+
+   return EXIT_SUCCESS;
+}
@@ -32,16 +32,8 @@ extension VerifyDevicePasswordSRP {
         do {
             let dateStr = stateData.clientTimestamp.utcString
             let clientClass = type(of: srpClient)
-            // swiftlint:disable:next identifier_name
-            let u = try clientClass.calculateUHexValue(
-                clientPublicKeyHexValue: stateData.srpKeyPair.publicKeyHexValue,
-                serverPublicKeyHexValue: serverPublicBHexString
-            )
             // HKDF
-            let authenticationKey = try clientClass.generateAuthenticationKey(
-                sharedSecretHexValue: sharedSecret,
-                uHexValue: u
-            )
+            let authenticationKey = try clientClass.generateAuthenticationKey(sharedSecret: sharedSecret)
 
             // Signature
             let signature = generateSignature(
@@ -69,10 +61,10 @@ extension VerifyDevicePasswordSRP {
         saltHex: String,
         serverPublicBHexString: String,
         srpClient: SRPClientBehavior
-    ) throws -> String {
+    ) throws -> SRPSharedSecret {
         do {
             let srpKeyPair = stateData.srpKeyPair
-            return try srpClient.calculateSharedSecret(
+            return try srpClient.calculateSharedSecretValue(
                 username: username,
                 password: password,
                 saltHexValue: saltHex,
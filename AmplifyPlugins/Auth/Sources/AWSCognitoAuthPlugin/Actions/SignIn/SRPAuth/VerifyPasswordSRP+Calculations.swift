@@ -32,16 +32,8 @@ extension VerifyPasswordSRP {
             let strippedPoolId =  strippedPoolId(poolId)
             let dateStr = stateData.clientTimestamp.utcString
             let clientClass = type(of: srpClient)
-            // swiftlint:disable:next identifier_name
-            let u = try clientClass.calculateUHexValue(
-                clientPublicKeyHexValue: stateData.srpKeyPair.publicKeyHexValue,
-                serverPublicKeyHexValue: serverPublicBHexString
-            )
             // HKDF
-            let authenticationkey = try clientClass.generateAuthenticationKey(
-                sharedSecretHexValue: sharedSecret,
-                uHexValue: u
-            )
+            let authenticationkey = try clientClass.generateAuthenticationKey(sharedSecret: sharedSecret)
 
             // Signature
             let signature = generateSignature(
@@ -69,12 +61,12 @@ extension VerifyPasswordSRP {
         serverPublicBHexString: String,
         srpClient: SRPClientBehavior,
         poolId: String
-    ) throws -> String {
+    ) throws -> SRPSharedSecret {
         let strippedPoolId =  strippedPoolId(poolId)
         let usernameForS = "\(strippedPoolId)\(userIdForSRP)"
         do {
             let srpKeyPair = stateData.srpKeyPair
-            return try srpClient.calculateSharedSecret(
+            return try srpClient.calculateSharedSecretValue(
                 username: usernameForS,
                 password: stateData.password,
                 saltHexValue: saltHex,
@@ -23,7 +23,9 @@ struct BasicSRPAuthEnvironment: SRPAuthEnvironment {
         userPoolConfiguration: UserPoolConfigurationData,
         cognitoUserPoolFactory: @escaping CognitoUserPoolFactory,
         eventIDFactory: @escaping EventIDFactory = UUIDFactory.factory,
-        srpClientFactory: @escaping SRPClientFactory = AmplifySRPClient.init(NHexValue:gHexValue:),
+        srpClientFactory: @escaping SRPClientFactory = { nHexValue, gHexValue in
+            try AmplifySRPClient(NHexValue: nHexValue, gHexValue: gHexValue, usesSharedKeyPool: true)
+        },
         srpConfiguration: (nHexValue: String, gHexValue: String) = (
             nHexValue: SRPCommonConfig.nHexValue,
             gHexValue: SRPCommonConfig.gHexValue
@@ -13,15 +13,33 @@ struct AmplifySRPClient: SRPClientBehavior {
 
     let commonState: SRPCommonState
     let client: SRPClientState
+    let context: AmplifySRPClientContext
+    let randomSource: SRPRandomSource
     // swiftlint:disable identifier_name
-    init(NHexValue: String, gHexValue: String) throws {
-        guard let N = BigInt(NHexValue, radix: 16),
-              let g = BigInt(gHexValue, radix: 16)
-        else {
-                  throw SRPError.numberConversion
-              }
-        self.commonState = SRPCommonState(prime: N, generator: g)
-        self.client = SRPClientState(commonState: commonState)
+    /// With `usesSharedKeyPool`, the private key a comes from the process wide
+    /// `SRPEphemeralKeyPool` of the group whenever it has a pair ready, and
+    /// that pool draws from its own `SecureSRPRandomSource`. `randomSource` is
+    /// then only used for a when the pool is empty, and for the device salt.
+    init(
+        NHexValue: String,
+        gHexValue: String,
+        randomSource: SRPRandomSource = SecureSRPRandomSource(),
+        usesSharedKeyPool: Bool = false
+    ) throws {
+        guard let commonState = SRPCommonState.shared(primeHexValue: NHexValue, generatorHexValue: gHexValue) else {
+            throw SRPError.numberConversion
+        }
+        guard commonState.isValidGroup, let group = commonState.group else {
+            throw SRPError.illegalParameter
+        }
+        self.commonState = commonState
+        self.client = SRPClientState(
+            commonState: commonState,
+            randomSource: randomSource,
+            keyPool: usesSharedKeyPool ? SRPEphemeralKeyPool.shared(for: commonState) : nil
+        )
+        self.context = AmplifySRPClientContext(group: group)
+        self.randomSource = randomSource
     }
 
     var kHexValue: String {
@@ -47,31 +65,14 @@ struct AmplifySRPClient: SRPClientBehavior {
         clientPublicKeyHexValue: String,
         serverPublicKeyHexValue: String
     ) throws -> String {
-        guard let clientPublicNum = BigInt(clientPublicKeyHexValue, radix: 16) else {
-            throw SRPError.numberConversion
-        }
-        guard let clientPrivateNum = BigInt(clientPrivateKeyHexValue, radix: 16) else {
-            throw SRPError.numberConversion
-        }
-        guard let saltNum = BigInt(saltHexValue, radix: 16) else {
-            throw SRPError.numberConversion
-        }
-        guard let serverPublicKeyNum = BigInt(serverPublicKeyHexValue, radix: 16) else {
-            throw SRPError.numberConversion
-        }
-        guard serverPublicKeyNum % commonState.prime != BigInt(0) else {
-            throw SRPError.illegalParameter
-        }
-        let sharedSecret = SRPClientState.calculateSessionKey(
+        try premasterSecret(
             username: username,
             password: password,
-            publicClientKey: clientPublicNum,
-            privateClientKey: clientPrivateNum,
-            publicServerKey: serverPublicKeyNum,
-            salt: saltNum,
-            commonState: commonState
-        )
-        return sharedSecret.asString(radix: 16)
+            saltHexValue: saltHexValue,
+            clientPrivateKeyHexValue: clientPrivateKeyHexValue,
+            clientPublicKeyHexValue: clientPublicKeyHexValue,
+            serverPublicKeyHexValue: serverPublicKeyHexValue
+        ).premasterSecret.asString(radix: 16)
     }
 
     static func calculateUHexValue(
@@ -84,12 +85,9 @@ struct AmplifySRPClient: SRPClientBehavior {
         guard let serverPublicNum = BigInt(serverPublicKeyHexValue, radix: 16) else {
             throw SRPError.numberConversion
         }
-        let signedClientPublicKey = AmplifyBigIntHelper.getSignedData(num: clientPublicNum)
-        let signedServerPublicKey = AmplifyBigIntHelper.getSignedData(num: serverPublicNum)
-
-        let u = SRPClientState.calculcateU(
-            publicClientKey: signedClientPublicKey,
-            publicServerKey: signedServerPublicKey
+        let u = AmplifySRPClientContext.scramblingParameter(
+            publicClientKey: clientPublicNum.reference,
+            publicServerKey: serverPublicNum.reference
         )
 
         return u.asString(radix: 16)
@@ -102,16 +100,79 @@ struct AmplifySRPClient: SRPClientBehavior {
         guard let uNum = BigInt(uHexValue, radix: 16) else {
             throw SRPError.numberConversion
         }
-        let keyingMaterial = AmplifyBigIntHelper.getSignedData(num: sharedSecretNum)
-        let salt = AmplifyBigIntHelper.getSignedData(num: uNum)
+        return authenticationKey(
+            keyingMaterial: AmplifyBigIntHelper.getSignedData(num: sharedSecretNum),
+            salt: AmplifyBigIntHelper.getSignedData(num: uNum)
+        )
+    }
+
+    // MARK: - Binary path
+    //
+    // S and u stay numbers from the premaster secret to the key derivation,
+    // only A, a, B and the salt are read from hex once.
+
+    // swiftlint:disable:next function_parameter_count
+    func calculateSharedSecretValue(
+        username: String,
+        password: String,
+        saltHexValue: String,
+        clientPrivateKeyHexValue: String,
+        clientPublicKeyHexValue: String,
+        serverPublicKeyHexValue: String
+    ) throws -> SRPSharedSecret {
+        let (sharedSecret, u) = try premasterSecret(
+            username: username,
+            password: password,
+            saltHexValue: saltHexValue,
+            clientPrivateKeyHexValue: clientPrivateKeyHexValue,
+            clientPublicKeyHexValue: clientPublicKeyHexValue,
+            serverPublicKeyHexValue: serverPublicKeyHexValue
+        )
+        return SRPSharedSecret(
+            premasterSecret: AmplifyBigIntHelper.getSignedData(num: sharedSecret),
+            scramblingParameter: AmplifyBigIntHelper.getSignedData(num: u)
+        )
+    }
+
+    static func generateAuthenticationKey(sharedSecret: SRPSharedSecret) -> Data {
+        authenticationKey(keyingMaterial: sharedSecret.premasterSecret, salt: sharedSecret.scramblingParameter)
+    }
+
+    // swiftlint:disable:next function_parameter_count
+    private func premasterSecret(
+        username: String,
+        password: String,
+        saltHexValue: String,
+        clientPrivateKeyHexValue: String,
+        clientPublicKeyHexValue: String,
+        serverPublicKeyHexValue: String
+    ) throws -> (premasterSecret: AmplifyBigInt, scramblingParameter: AmplifyBigInt) {
+        guard let clientPublicNum = AmplifyBigInt(clientPublicKeyHexValue, radix: 16),
+              let clientPrivateNum = AmplifyBigInt(clientPrivateKeyHexValue, radix: 16),
+              let saltNum = AmplifyBigInt(saltHexValue, radix: 16),
+              let serverPublicKeyNum = AmplifyBigInt(serverPublicKeyHexValue, radix: 16)
+        else {
+            throw SRPError.numberConversion
+        }
+        guard let secret = context.premasterSecretAndScramblingParameter(
+            identity: [UInt8]("\(username):\(password)".utf8),
+            salt: saltNum,
+            privateClientKey: clientPrivateNum,
+            publicClientKey: clientPublicNum,
+            publicServerKey: serverPublicKeyNum
+        ) else {
+            throw SRPError.illegalParameter
+        }
+        return secret
+    }
 
-        let authenticationkey = HMACKeyDerivationFunction.generateDerivedKey(
+    private static func authenticationKey(keyingMaterial: [UInt8], salt: [UInt8]) -> Data {
+        HMACKeyDerivationFunction.generateDerivedKey(
             keyingMaterial: Data(keyingMaterial),
             salt: Data(salt),
             info: "Caldera Derived Key",
             outputLength: 16
         )
-        return authenticationkey
     }
 
     func generateDevicePasswordVerifier(
@@ -120,17 +181,18 @@ struct AmplifySRPClient: SRPClientBehavior {
         password: String
     ) -> (salt: Data, passwordVerifier: Data) {
 
-            let passwordVerifier = SRPClientState.calculateDevicePasswordVerifier(
-                deviceGroupKey: deviceGroupKey,
-                deviceKey: deviceKey,
-                password: password,
-                commonState: commonState
+            // Salt (16 random bytes)
+            let salt = BigInt(unsignedData: randomSource.randomBytes(count: 16))
+
+            // PasswordVerifier = g^H(salt | H(DeviceGroupKey + DeviceKey + ":" + RANDOM_PASSWORD)) (mod N)
+            let x = AmplifySRPClientContext.privateKey(
+                identity: [UInt8]("\(deviceGroupKey)\(deviceKey):\(password)".utf8),
+                salt: salt.reference
             )
+            let passwordVerifier = context.power(x)
 
-            let verifierData = Data(AmplifyBigIntHelper.getSignedData(
-                num: passwordVerifier.passwordVerifier))
-            let saltData = Data(AmplifyBigIntHelper.getSignedData(
-                num: passwordVerifier.salt))
+            let verifierData = Data(AmplifyBigIntHelper.getSignedData(num: passwordVerifier))
+            let saltData = Data(AmplifyBigIntHelper.getSignedData(num: salt))
 
             return (saltData, verifierData)
         }
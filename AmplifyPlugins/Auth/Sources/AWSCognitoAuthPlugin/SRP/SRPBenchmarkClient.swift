@@ -0,0 +1,79 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifySRP
+import Foundation
+
+/// The SRP steps of a sign-in handshake with the group of the user pool, for
+/// the AmplifySRPBenchmark executable. `AmplifySRPClient` and its types stay
+/// internal, this wrapper forwards the steps the sign-in actions run.
+@_spi(SRPBenchmark)
+public struct SRPBenchmarkClient {
+
+    /// S and u as `calculateSharedSecretValue` returns them
+    public struct SharedSecret {
+
+        let value: SRPSharedSecret
+
+        /// S in the signed big endian format that is hashed into the key
+        public var premasterSecret: [UInt8] {
+            value.premasterSecret
+        }
+    }
+
+    public static let nHexValue = SRPCommonConfig.nHexValue
+    public static let gHexValue = SRPCommonConfig.gHexValue
+
+    private let client: AmplifySRPClient
+
+    /// `usesSharedKeyPool` as `BasicSRPAuthEnvironment` passes it. The pool
+    /// draws a from its own secure source, `randomSource` only when it is empty.
+    public init(randomSource: SRPRandomSource, usesSharedKeyPool: Bool = true) throws {
+        self.client = try AmplifySRPClient(
+            NHexValue: SRPCommonConfig.nHexValue,
+            gHexValue: SRPCommonConfig.gHexValue,
+            randomSource: randomSource,
+            usesSharedKeyPool: usesSharedKeyPool
+        )
+    }
+
+    public func generateClientKeyPair() -> (publicKeyHexValue: String, privateKeyHexValue: String) {
+        let keys = client.generateClientKeyPair()
+        return (keys.publicKeyHexValue, keys.privateKeyHexValue)
+    }
+
+    // swiftlint:disable:next function_parameter_count
+    public func calculateSharedSecretValue(
+        username: String,
+        password: String,
+        saltHexValue: String,
+        clientPrivateKeyHexValue: String,
+        clientPublicKeyHexValue: String,
+        serverPublicKeyHexValue: String
+    ) throws -> SharedSecret {
+        SharedSecret(value: try client.calculateSharedSecretValue(
+            username: username,
+            password: password,
+            saltHexValue: saltHexValue,
+            clientPrivateKeyHexValue: clientPrivateKeyHexValue,
+            clientPublicKeyHexValue: clientPublicKeyHexValue,
+            serverPublicKeyHexValue: serverPublicKeyHexValue
+        ))
+    }
+
+    public static func generateAuthenticationKey(sharedSecret: SharedSecret) -> Data {
+        AmplifySRPClient.generateAuthenticationKey(sharedSecret: sharedSecret.value)
+    }
+
+    public func generateDevicePasswordVerifier(
+        deviceGroupKey: String,
+        deviceKey: String,
+        password: String
+    ) -> (salt: Data, passwordVerifier: Data) {
+        client.generateDevicePasswordVerifier(deviceGroupKey: deviceGroupKey, deviceKey: deviceKey, password: password)
+    }
+}
@@ -37,6 +37,28 @@ protocol SRPClientBehavior {
         deviceKey: String,
         password: String
     ) -> (salt: Data, passwordVerifier: Data)
+
+    // swiftlint:disable:next function_parameter_count
+    func calculateSharedSecretValue(
+        username: String,
+        password: String,
+        saltHexValue: String,
+        clientPrivateKeyHexValue: String,
+        clientPublicKeyHexValue: String,
+        serverPublicKeyHexValue: String
+    ) throws -> SRPSharedSecret
+
+    static func generateAuthenticationKey(sharedSecret: SRPSharedSecret) throws -> Data
+}
+
+/// The premaster secret S and the scrambling parameter u it was computed
+/// with, in the signed big endian format that is hashed into the
+/// authentication key
+struct SRPSharedSecret {
+
+    let premasterSecret: [UInt8]
+
+    let scramblingParameter: [UInt8]
 }
 
 enum SRPError: Error {
@@ -0,0 +1,192 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+// The arithmetic and bitwise operators are in AmplifyBigInt+Operations.swift,
+// this file adds the rest of the protocol so that generic integer code gets
+// the library calls instead of the word by word defaults.
+extension AmplifyBigInt: ExpressibleByIntegerLiteral, SignedInteger {
+
+    public typealias Magnitude = AmplifyBigInt
+
+    public convenience init<T: BinaryInteger>(_ source: T) {
+        self.init()
+        if let bigInt = source as? AmplifyBigInt {
+            let result = amplify_mp_copy(&bigInt.value, &value)
+            guard result == AMPLIFY_MP_OKAY else {
+                fatalError("Could not copy the number - \(result)")
+            }
+        } else if let int = Int64(exactly: source) {
+            amplify_mp_set_i64(&value, int)
+        } else {
+            let words = Array(source.magnitude.words)
+            let result = amplify_mp_unpack(
+                &value,
+                words.count,
+                AMPLIFY_MP_LSB_FIRST,
+                MemoryLayout<UInt>.size,
+                AMPLIFY_MP_NATIVE_ENDIAN,
+                0,
+                words
+            )
+            guard result == AMPLIFY_MP_OKAY else {
+                fatalError("Could not create a number from the words of \(source) - \(result)")
+            }
+            if source < 0 {
+                value.sign = AMPLIFY_MP_NEG
+            }
+        }
+    }
+
+    public convenience init?<T: BinaryInteger>(exactly source: T) {
+        self.init(source)
+    }
+
+    public convenience init<T: BinaryInteger>(truncatingIfNeeded source: T) {
+        self.init(source)
+    }
+
+    public convenience init<T: BinaryInteger>(clamping source: T) {
+        self.init(source)
+    }
+
+    /// Creates the integer closest to `source` toward zero
+    public convenience init<T: BinaryFloatingPoint>(_ source: T) {
+        guard source.isFinite else {
+            fatalError("\(source) cannot be converted to AmplifyBigInt because it is not finite")
+        }
+        let truncated = source.rounded(.towardZero)
+        let magnitude: AmplifyBigInt
+        if truncated == 0 {
+            magnitude = AmplifyBigInt()
+        } else {
+            // Integral values are normal, so the leading bit is implicit
+            let significand = AmplifyBigInt(truncated.significandBitPattern) | AmplifyBigInt(1) << T.significandBitCount
+            magnitude = significand << (Int(truncated.exponent) - T.significandBitCount)
+        }
+        self.init()
+        amplify_mp_exch(&magnitude.value, &value)
+        if truncated < 0 {
+            value.sign = AMPLIFY_MP_NEG
+        }
+    }
+
+    public convenience init?<T: BinaryFloatingPoint>(exactly source: T) {
+        guard source.isFinite, source.rounded(.towardZero) == source else {
+            return nil
+        }
+        self.init(source)
+    }
+
+    public var magnitude: AmplifyBigInt {
+        let absolute = AmplifyBigInt()
+        let result = amplify_mp_abs(&value, &absolute.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during magnitude operation: \(result)")
+        }
+        return absolute
+    }
+
+    /// Bits of the shortest two's complement representation, the sign bit included
+    public var bitWidth: Int {
+        Int(amplify_mp_count_bits(&value)) + 1
+    }
+
+    public var trailingZeroBitCount: Int {
+        value.used == 0 ? bitWidth : Int(amplify_mp_cnt_lsb(&value))
+    }
+
+    public var words: Words {
+        Words(self)
+    }
+
+    public func quotientAndRemainder(dividingBy divisor: AmplifyBigInt) -> (quotient: AmplifyBigInt, remainder: AmplifyBigInt) {
+        let quotient = AmplifyBigInt()
+        let remainder = AmplifyBigInt()
+        let result = amplify_mp_div(&value, &divisor.value, &quotient.value, &remainder.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during quotientAndRemainder(dividingBy:) operation: \(result)")
+        }
+        return (quotient, remainder)
+    }
+
+    public func signum() -> AmplifyBigInt {
+        if value.used == 0 {
+            return AmplifyBigInt()
+        }
+        return AmplifyBigInt(value.sign == AMPLIFY_MP_NEG ? -1 : 1)
+    }
+
+    public func hash(into hasher: inout Hasher) {
+        hasher.combine(value.sign == AMPLIFY_MP_NEG)
+        guard let digits = value.dp else {
+            return
+        }
+        hasher.combine(bytes: UnsafeRawBufferPointer(
+            start: digits,
+            count: Int(value.used) * MemoryLayout<amplify_mp_digit>.stride
+        ))
+    }
+}
+
+public extension AmplifyBigInt {
+
+    /// Two's complement words of the number, least significant first, read directly from its digits
+    struct Words: RandomAccessCollection {
+
+        public typealias Indices = Range<Int>
+
+        private let bigInt: AmplifyBigInt
+        private let isNegative: Bool
+
+        /// Index of the word holding the lowest set bit, the words below it are zero for negative numbers
+        private let lowestSetWord: Int
+
+        public let startIndex = 0
+        public let endIndex: Int
+
+        init(_ bigInt: AmplifyBigInt) {
+            self.bigInt = bigInt
+            self.isNegative = bigInt.value.sign == AMPLIFY_MP_NEG
+            self.lowestSetWord = Int(amplify_mp_cnt_lsb(&bigInt.value)) / UInt.bitWidth
+            self.endIndex = (bigInt.bitWidth + UInt.bitWidth - 1) / UInt.bitWidth
+        }
+
+        public subscript(position: Int) -> UInt {
+            precondition(position >= startIndex && position < endIndex, "Index out of range")
+            let word = magnitudeWord(at: position)
+            guard isNegative, position >= lowestSetWord else {
+                return word
+            }
+            return position == lowestSetWord ? ~word &+ 1 : ~word
+        }
+
+        /// Bits `position * UInt.bitWidth ..< (position + 1) * UInt.bitWidth` of the magnitude
+        private func magnitudeWord(at position: Int) -> UInt {
+            guard let digits = bigInt.value.dp else {
+                return 0
+            }
+            let digitBitCount = Int(AMPLIFY_MP_DIGIT_BIT)
+            let used = Int(bigInt.value.used)
+            let lowestBit = position * UInt.bitWidth
+            var digitIndex = lowestBit / digitBitCount
+            var digitShift = lowestBit % digitBitCount
+            var word: UInt = 0
+            var filled = 0
+            while filled < UInt.bitWidth && digitIndex < used {
+                let digit = UInt64(digits[digitIndex]) >> UInt64(digitShift)
+                word |= UInt(truncatingIfNeeded: digit) << filled
+                filled += digitBitCount - digitShift
+                digitShift = 0
+                digitIndex += 1
+            }
+            return word
+        }
+    }
+}
@@ -8,6 +8,9 @@
 import Foundation
 import libtommathAmplify
 
+/// Exponent windows scanned per slice of powCooperatively, about 0.5 ms for a 3072-bit modulus
+private let powWindowsPerSlice: Int32 = 16
+
 public extension AmplifyBigInt {
 
     // MARK: - Addition
@@ -88,19 +91,28 @@ public extension AmplifyBigInt {
 
     // MARK: - Division
 
-    static func / (lhs: AmplifyBigInt, rhs: AmplifyBigInt) -> Self {
-        fatalError()
+    /// Truncating division, the quotient is rounded toward zero
+    static func / (lhs: AmplifyBigInt, rhs: AmplifyBigInt) -> AmplifyBigInt {
+        let quotient = AmplifyBigInt()
+        let result = amplify_mp_div(&lhs.value, &rhs.value, &quotient.value, nil)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during / operation: \(result)")
+        }
+        return quotient
+    }
+
+    static func / (lhs: AmplifyBigInt, rhs: Int) -> AmplifyBigInt {
+        return lhs / AmplifyBigInt(rhs)
     }
 
     static func /= (lhs: inout AmplifyBigInt, rhs: AmplifyBigInt) {
-        fatalError()
+        lhs = lhs / rhs
     }
 
     static func % (lhs: AmplifyBigInt, rhs: AmplifyBigInt) -> AmplifyBigInt {
-        let quotient = AmplifyBigInt()
         let remainder = AmplifyBigInt()
 
-        let result = amplify_mp_div(&lhs.value, &rhs.value, &quotient.value, &remainder.value)
+        let result = amplify_mp_div(&lhs.value, &rhs.value, nil, &remainder.value)
 
         if result != AMPLIFY_MP_OKAY {
             fatalError("Error occurred during % operation: \(result)")
@@ -130,18 +142,151 @@ public extension AmplifyBigInt {
         return exponentialModulus
     }
 
+    /// Computes self^power mod modulus in slices of a fraction of a millisecond
+    ///
+    /// The task yields between slices, so a 3072-bit exponentiation does not
+    /// hold a cooperative thread for its whole duration, and it throws
+    /// `CancellationError` as soon as the task is cancelled.
+    ///
+    /// The sign-in actions do not use it: S is computed in one call by
+    /// `AmplifySRPClientContext.premasterSecret(identity:...)`, which
+    /// exponentiates with the cached group of the user pool.
+    func powCooperatively(
+        _ power: AmplifyBigInt,
+        modulus: AmplifyBigInt
+    ) async throws -> AmplifyBigInt {
+        var state = amplify_mp_exptmod_state()
+        var result = amplify_mp_exptmod_begin(&state, &value, &power.value, &modulus.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during powCooperatively(:modulus:) operation: \(result)")
+        }
+        defer {
+            amplify_mp_exptmod_clear(&state)
+        }
+
+        var done = AMPLIFY_MP_NO
+        while true {
+            try Task.checkCancellation()
+            result = amplify_mp_exptmod_step(&state, powWindowsPerSlice, &done)
+            guard result == AMPLIFY_MP_OKAY else {
+                fatalError("Error occurred during powCooperatively(:modulus:) operation: \(result)")
+            }
+            if done == AMPLIFY_MP_YES {
+                break
+            }
+            await Task.yield()
+        }
+
+        let exponentialModulus = AmplifyBigInt()
+        result = amplify_mp_exptmod_finish(&state, &exponentialModulus.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during powCooperatively(:modulus:) operation: \(result)")
+        }
+        return exponentialModulus
+    }
+
     // MARK: - Binary operations
 
+    // Two's complement, as for the fixed width integers of the standard library
+
+    static func & (lhs: AmplifyBigInt, rhs: AmplifyBigInt) -> AmplifyBigInt {
+        let conjunction = AmplifyBigInt()
+        let result = amplify_mp_and(&lhs.value, &rhs.value, &conjunction.value)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during & operation: \(result)")
+        }
+        return conjunction
+    }
+
     static func &= (lhs: inout AmplifyBigInt, rhs: AmplifyBigInt) {
-        fatalError()
+        lhs = lhs & rhs
+    }
+
+    static func | (lhs: AmplifyBigInt, rhs: AmplifyBigInt) -> AmplifyBigInt {
+        let disjunction = AmplifyBigInt()
+        let result = amplify_mp_or(&lhs.value, &rhs.value, &disjunction.value)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during | operation: \(result)")
+        }
+        return disjunction
     }
 
     static func |= (lhs: inout AmplifyBigInt, rhs: AmplifyBigInt) {
-        fatalError()
+        lhs = lhs | rhs
+    }
+
+    static func ^ (lhs: AmplifyBigInt, rhs: AmplifyBigInt) -> AmplifyBigInt {
+        let exclusiveDisjunction = AmplifyBigInt()
+        let result = amplify_mp_xor(&lhs.value, &rhs.value, &exclusiveDisjunction.value)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during ^ operation: \(result)")
+        }
+        return exclusiveDisjunction
     }
 
-    /// Stores the result of performing a bitwise XOR operation on the two given values in the left-hand-side variable.
     static func ^= (lhs: inout AmplifyBigInt, rhs: AmplifyBigInt) {
-        fatalError()
+        lhs = lhs ^ rhs
+    }
+
+    /// -(self + 1)
+    static prefix func ~ (operand: AmplifyBigInt) -> AmplifyBigInt {
+        let complement = AmplifyBigInt()
+        let result = amplify_mp_complement(&operand.value, &complement.value)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during ~ operation: \(result)")
+        }
+        return complement
+    }
+
+    static prefix func - (operand: AmplifyBigInt) -> AmplifyBigInt {
+        let negation = AmplifyBigInt()
+        let result = amplify_mp_neg(&operand.value, &negation.value)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during - operation: \(result)")
+        }
+        return negation
+    }
+
+    // MARK: - Shifts
+
+    /// Smart shift, a negative count shifts to the right
+    static func << <RHS: BinaryInteger>(lhs: AmplifyBigInt, rhs: RHS) -> AmplifyBigInt {
+        guard rhs >= 0 else {
+            return lhs >> rhs.magnitude
+        }
+        let shifted = AmplifyBigInt()
+        let result = amplify_mp_mul_2d(&lhs.value, shiftCount(rhs), &shifted.value)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during << operation: \(result)")
+        }
+        return shifted
+    }
+
+    static func <<= <RHS: BinaryInteger>(lhs: inout AmplifyBigInt, rhs: RHS) {
+        lhs = lhs << rhs
+    }
+
+    /// Arithmetic smart shift, rounds toward negative infinity like the fixed width integers
+    static func >> <RHS: BinaryInteger>(lhs: AmplifyBigInt, rhs: RHS) -> AmplifyBigInt {
+        guard rhs >= 0 else {
+            return lhs << rhs.magnitude
+        }
+        let shifted = AmplifyBigInt()
+        let result = amplify_amplify_mp_signed_rsh(&lhs.value, shiftCount(rhs), &shifted.value)
+        if result != AMPLIFY_MP_OKAY {
+            fatalError("Error occurred during >> operation: \(result)")
+        }
+        return shifted
+    }
+
+    static func >>= <RHS: BinaryInteger>(lhs: inout AmplifyBigInt, rhs: RHS) {
+        lhs = lhs >> rhs
+    }
+
+    private static func shiftCount<RHS: BinaryInteger>(_ count: RHS) -> Int32 {
+        guard let shiftCount = Int32(exactly: count) else {
+            fatalError("Shift count \(count) is out of range")
+        }
+        return shiftCount
     }
 }
@@ -0,0 +1,77 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+public extension AmplifyBigInt {
+
+    /// Creates a uniformly distributed random number in `0 ..< upperBound`
+    ///
+    /// Bytes are drawn from the random source currently installed in the library,
+    /// see `AmplifyRandomGenerator.installBufferedGenerator()`.
+    /// - Parameter upperBound: exclusive, positive upper bound
+    static func random(below upperBound: AmplifyBigInt) -> AmplifyBigInt {
+        let randomInt = AmplifyBigInt()
+        let result = amplify_mp_rand_range(&randomInt.value, &upperBound.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during random(below:) operation: \(result)")
+        }
+        return randomInt
+    }
+
+    /// Creates a random prime of exactly `bits` bits
+    ///
+    /// The candidate search is spread over `threads` threads, which makes
+    /// generating throwaway SRP/DH groups for test fixtures scale with cores.
+    /// - Parameters:
+    ///   - bits: size of the prime, at least 2
+    ///   - safe: when true `(prime - 1) / 2` is prime as well
+    ///   - threads: number of threads searching, the calling one included
+    static func randomPrime(
+        bits: Int,
+        safe: Bool = false,
+        threads: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) -> AmplifyBigInt {
+        let prime = AmplifyBigInt()
+        let trials = amplify_mp_prime_rabin_miller_trials(Int32(bits))
+        let flags = safe ? AMPLIFY_MP_PRIME_SAFE : 0
+        let result = amplify_mp_prime_rand_parallel(&prime.value, trials, Int32(bits), flags, Int32(threads))
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during randomPrime(bits:) operation: \(result)")
+        }
+        return prime
+    }
+}
+
+public enum AmplifyRandomGenerator {
+
+    /// Routes all randomness used by the library through a buffered per-thread
+    /// ChaCha20 generator that is reseeded from the platform source.
+    ///
+    /// The source is process wide and nothing installs it implicitly, call this
+    /// once where the process is configured, before the first key is drawn.
+    /// Installing it again has no further effect.
+    public static func installBufferedGenerator() {
+        amplify_mp_rand_source(amplify_mp_rand_chacha20)
+    }
+
+    /// Restores the platform random source.
+    public static func installPlatformGenerator() {
+        amplify_mp_rand_source(nil)
+    }
+
+    /// Returns `count` bytes from the buffered per-thread ChaCha20 generator.
+    public static func bufferedRandomBytes(count: Int) -> [UInt8] {
+        var randomBytes = [UInt8](repeating: 0, count: count)
+        let result = amplify_mp_rand_chacha20(&randomBytes, count)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred in generating random bytes: \(result)")
+        }
+        return randomBytes
+    }
+}
@@ -0,0 +1,26 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+public extension AmplifyBigInt {
+
+    /// Returns true if `prime` is a safe prime of at least 1024 bits and
+    /// `1 < generator < prime - 1`.
+    ///
+    /// The groups of RFC 5054 are recognised without a primality test, the
+    /// verdict for any other prime is memoized for the lifetime of the process.
+    static func isValidSRPGroup(prime: AmplifyBigInt, generator: AmplifyBigInt) -> Bool {
+        var isValid = AMPLIFY_MP_NO
+        let result = amplify_srp_group_validate(&prime.value, &generator.value, &isValid)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during isValidSRPGroup operation: \(result)")
+        }
+        return isValid == AMPLIFY_MP_YES
+    }
+}
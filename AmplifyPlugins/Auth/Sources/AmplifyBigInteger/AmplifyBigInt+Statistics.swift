@@ -0,0 +1,81 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+public extension AmplifyBigInt {
+
+    /// Operation and heap counters of the big integer library for the calling thread
+    ///
+    /// The counters are only collected when libtommathAmplify is compiled with
+    /// `AMPLIFY_MP_STATS` (e.g. `swift build -Xcc -DAMPLIFY_MP_STATS`), otherwise
+    /// `isEnabled` is false and every snapshot is zero. Time is inclusive, the
+    /// modular exponentiation also accounts for its multiplications and reductions.
+    struct Statistics: Equatable {
+
+        public struct Operation: Equatable {
+            public let calls: UInt64
+            /// Sum of the operand sizes in digits
+            public let digits: UInt64
+            public let nanoseconds: UInt64
+        }
+
+        public let multiplication: Operation
+        public let squaring: Operation
+        public let reduction: Operation
+        public let division: Operation
+        public let modularExponentiation: Operation
+        public let radixConversion: Operation
+        public let unsignedBytesImport: Operation
+
+        public let allocations: UInt64
+        public let allocatedBytes: UInt64
+        public let reallocations: UInt64
+        public let reallocatedBytes: UInt64
+        public let frees: UInt64
+        public let freedBytes: UInt64
+
+        /// Whether the library collects statistics
+        public static var isEnabled: Bool {
+            amplify_mp_stats_enabled() == AMPLIFY_MP_YES
+        }
+
+        /// Returns the counters of the calling thread
+        public static func snapshot() -> Statistics {
+            var stats = amplify_mp_stats()
+            amplify_mp_stats_snapshot(&stats)
+            return Statistics(stats)
+        }
+
+        /// Zeroes the counters of the calling thread
+        public static func reset() {
+            amplify_mp_stats_reset()
+        }
+
+        init(_ stats: amplify_mp_stats) {
+            let operations = withUnsafeBytes(of: stats.ops) { buffer in
+                buffer.bindMemory(to: amplify_mp_op_stats.self).map {
+                    Operation(calls: $0.calls, digits: $0.digits, nanoseconds: $0.nanoseconds)
+                }
+            }
+            self.multiplication = operations[Int(AMPLIFY_MP_STATS_MUL)]
+            self.squaring = operations[Int(AMPLIFY_MP_STATS_SQR)]
+            self.reduction = operations[Int(AMPLIFY_MP_STATS_REDUCE)]
+            self.division = operations[Int(AMPLIFY_MP_STATS_DIV)]
+            self.modularExponentiation = operations[Int(AMPLIFY_MP_STATS_EXPTMOD)]
+            self.radixConversion = operations[Int(AMPLIFY_MP_STATS_TO_RADIX)]
+            self.unsignedBytesImport = operations[Int(AMPLIFY_MP_STATS_FROM_UBIN)]
+            self.allocations = stats.allocs
+            self.allocatedBytes = stats.alloc_bytes
+            self.reallocations = stats.reallocs
+            self.reallocatedBytes = stats.realloc_bytes
+            self.frees = stats.frees
+            self.freedBytes = stats.free_bytes
+        }
+    }
+}
@@ -56,12 +56,13 @@ public final class AmplifyBigInt {
         }
     }
 
-    public required convenience init(integerLiteral value: IntegerLiteralType) {
+    public required convenience init(integerLiteral value: Int) {
         self.init(value)
     }
 
     public convenience init(_ int: Int) {
-        self.init("\(int)")!
+        self.init()
+        amplify_mp_set_i64(&value, Int64(int))
     }
 
     deinit {
@@ -73,8 +74,7 @@ public final class AmplifyBigInt {
     }
 
     public func asString(radix: Int = 10) -> String {
-        // Will be replaced with this method - https://developer.apple.com/documentation/swift/string/2997127-init
-        // when moving to `BinaryInteger` conformance.
+        // Faster than `String(_:radix:)`, which goes through the generic `BinaryInteger` division.
         if radix < 2 || radix > 36 {
             fatalError("Could not convert to string, radix is out of range")
         }
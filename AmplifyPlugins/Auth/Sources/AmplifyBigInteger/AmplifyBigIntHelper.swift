@@ -38,4 +38,8 @@ public enum AmplifyBigIntHelper {
         return result
 
     }
+
+    public static func getSignedData(num: BigInteger) -> [UInt8] {
+        getSignedData(num: num.reference)
+    }
 }
@@ -0,0 +1,72 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+/// A modulus given by its prime factors, for exponentiations by CRT
+///
+/// Holds the Montgomery constants of every factor and the coefficients to
+/// join the residues, so that `pow` only exponentiates modulo the factors,
+/// each with an exponent reduced modulo `factor - 1`. Nothing changes the
+/// modulus after init, so one instance can be used by any number of threads.
+public final class AmplifyCRTModulus: @unchecked Sendable {
+
+    // the factors refer to each other by address, so the context must not move
+    let context: UnsafeMutablePointer<amplify_mp_crt_ctx>
+
+    /// Creates the modulus `primes[0] * primes[1] * ...`, nil if a factor is
+    /// even, below 3, not a probable prime or shares a divisor with another one.
+    public init?(primes: [AmplifyBigInt]) {
+        let context = UnsafeMutablePointer<amplify_mp_crt_ctx>.allocate(capacity: 1)
+        context.initialize(to: amplify_mp_crt_ctx())
+        // shallow copies, the library copies the digits before init returns
+        let factors = primes.map { $0.value }
+        let result = withExtendedLifetime(primes) {
+            amplify_mp_crt_init(context, factors, Int32(factors.count))
+        }
+        guard result == AMPLIFY_MP_OKAY else {
+            context.deallocate()
+            if result == AMPLIFY_MP_VAL {
+                return nil
+            }
+            fatalError("Error occurred during AmplifyCRTModulus init: \(result)")
+        }
+        self.context = context
+    }
+
+    deinit {
+        amplify_mp_crt_clear(context)
+        context.deallocate()
+    }
+
+    /// The product of the factors
+    public var modulus: AmplifyBigInt {
+        let modulus = AmplifyBigInt()
+        let result = amplify_mp_copy(&context.pointee.P, &modulus.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during modulus operation: \(result)")
+        }
+        return modulus
+    }
+
+    /// Returns base^exponent mod `modulus` for a non-negative exponent
+    ///
+    /// The factors are spread over `threads` threads, the calling one included.
+    public func pow(
+        _ base: AmplifyBigInt,
+        _ exponent: AmplifyBigInt,
+        threads: Int = ProcessInfo.processInfo.activeProcessorCount
+    ) -> AmplifyBigInt {
+        let power = AmplifyBigInt()
+        let result = amplify_mp_exptmod_crt(context, &base.value, &exponent.value, &power.value, Int32(threads))
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during pow(_:_:threads:) operation: \(result)")
+        }
+        return power
+    }
+}
@@ -0,0 +1,177 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+/// SRP-6a client math for one group, computed by the big integer library
+///
+/// Every protocol step is a single call into the library, which hashes the
+/// numbers with SHA-256 in Cognito's signed byte format. The intermediates
+/// live in the context, so an instance must not be shared between threads.
+public final class AmplifySRPClientContext {
+
+    var context = amplify_srp_client_ctx()
+
+    // the context points into the group's table
+    private let group: AmplifySRPGroup?
+
+    /// Creates the context of the group `prime`, `generator`, the SRP-6
+    /// multiplier k is computed from them.
+    public init(prime: AmplifyBigInt, generator: AmplifyBigInt) {
+        self.group = nil
+        let result = amplify_srp_client_init(&context, &prime.value, &generator.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during AmplifySRPClientContext init: \(result)")
+        }
+    }
+
+    /// Creates the context of a precomputed group, nothing is hashed and the
+    /// powers of g are taken from the group's table.
+    public init(group: AmplifySRPGroup) {
+        self.group = group
+        let result = amplify_srp_client_init_group(&context, group.group)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during AmplifySRPClientContext init: \(result)")
+        }
+    }
+
+    /// Creates the context with a given multiplier k, e.g. for groups whose
+    /// k was hashed with another function.
+    public convenience init(prime: AmplifyBigInt, generator: AmplifyBigInt, multiplier: AmplifyBigInt) {
+        self.init(prime: prime, generator: generator)
+        let result = amplify_mp_copy(&multiplier.value, &context.k)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during AmplifySRPClientContext init: \(result)")
+        }
+    }
+
+    deinit {
+        amplify_srp_client_clear(&context)
+    }
+
+    /// The SRP-6 multiplier k = H(N | g)
+    public var multiplier: AmplifyBigInt {
+        let k = AmplifyBigInt()
+        let result = amplify_mp_copy(&context.k, &k.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during multiplier operation: \(result)")
+        }
+        return k
+    }
+
+    /// Returns g^exponent mod N, the public key A for a private key and the
+    /// password verifier for x.
+    public func power(_ exponent: AmplifyBigInt) -> AmplifyBigInt {
+        let power = AmplifyBigInt()
+        let result = amplify_srp_compute_A(&context, &exponent.value, &power.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during power operation: \(result)")
+        }
+        return power
+    }
+
+    /// Returns u = H(A | B)
+    public static func scramblingParameter(
+        publicClientKey: AmplifyBigInt,
+        publicServerKey: AmplifyBigInt
+    ) -> AmplifyBigInt {
+        let u = AmplifyBigInt()
+        let result = amplify_srp_compute_u(&publicClientKey.value, &publicServerKey.value, &u.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during scramblingParameter operation: \(result)")
+        }
+        return u
+    }
+
+    /// Returns x = H(salt | H(identity)), `identity` is "username:password"
+    public static func privateKey(identity: [UInt8], salt: AmplifyBigInt) -> AmplifyBigInt {
+        let x = AmplifyBigInt()
+        let result = amplify_srp_compute_x(&salt.value, identity, identity.count, &x.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during privateKey operation: \(result)")
+        }
+        return x
+    }
+
+    /// Returns S = (B - k * g^x)^(a + u * x) mod N, or nil if B is a multiple of N
+    public func premasterSecret(
+        privateClientKey: AmplifyBigInt,
+        publicServerKey: AmplifyBigInt,
+        scramblingParameter: AmplifyBigInt,
+        privateKey: AmplifyBigInt
+    ) -> AmplifyBigInt? {
+        let secret = AmplifyBigInt()
+        let result = amplify_srp_compute_S(
+            &context,
+            &privateClientKey.value,
+            &publicServerKey.value,
+            &scramblingParameter.value,
+            &privateKey.value,
+            &secret.value
+        )
+        return premasterSecretResult(result, secret)
+    }
+
+    /// Computes x, u and S in one call, returns nil if B is a multiple of N
+    public func premasterSecret(
+        identity: [UInt8],
+        salt: AmplifyBigInt,
+        privateClientKey: AmplifyBigInt,
+        publicClientKey: AmplifyBigInt,
+        publicServerKey: AmplifyBigInt
+    ) -> AmplifyBigInt? {
+        let secret = AmplifyBigInt()
+        let result = amplify_srp_compute_premaster_secret(
+            &context,
+            identity,
+            identity.count,
+            &salt.value,
+            &privateClientKey.value,
+            &publicClientKey.value,
+            &publicServerKey.value,
+            &secret.value
+        )
+        return premasterSecretResult(result, secret)
+    }
+
+    /// Computes x, u and S in one call like `premasterSecret(identity:...)`,
+    /// and returns S together with the u it was computed with
+    public func premasterSecretAndScramblingParameter(
+        identity: [UInt8],
+        salt: AmplifyBigInt,
+        privateClientKey: AmplifyBigInt,
+        publicClientKey: AmplifyBigInt,
+        publicServerKey: AmplifyBigInt
+    ) -> (premasterSecret: AmplifyBigInt, scramblingParameter: AmplifyBigInt)? {
+        guard let secret = premasterSecret(
+            identity: identity,
+            salt: salt,
+            privateClientKey: privateClientKey,
+            publicClientKey: publicClientKey,
+            publicServerKey: publicServerKey
+        ) else {
+            return nil
+        }
+        let u = AmplifyBigInt()
+        let result = amplify_mp_copy(&context.u, &u.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during premasterSecret operation: \(result)")
+        }
+        return (secret, u)
+    }
+
+    private func premasterSecretResult(_ result: amplify_mp_err, _ secret: AmplifyBigInt) -> AmplifyBigInt? {
+        if result == AMPLIFY_MP_VAL {
+            return nil
+        }
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during premasterSecret operation: \(result)")
+        }
+        return secret
+    }
+}
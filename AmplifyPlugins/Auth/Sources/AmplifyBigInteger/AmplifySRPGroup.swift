@@ -0,0 +1,62 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+/// The constants of one SRP group, computed once for all its clients
+///
+/// Holds the multiplier k, the Montgomery constants of N and a table of
+/// powers of g, so that g^e for the 256-bit exponents of SRP takes no
+/// squarings. Nothing changes the group after init, so one instance can be
+/// used by any number of threads and client contexts.
+public final class AmplifySRPGroup: @unchecked Sendable {
+
+    // contexts keep the address of the group, so it must not move
+    let group: UnsafeMutablePointer<amplify_srp_group>
+
+    /// Creates the group `prime`, `generator`, nil if `prime` is not odd and
+    /// greater than 1.
+    public init?(prime: AmplifyBigInt, generator: AmplifyBigInt) {
+        let group = UnsafeMutablePointer<amplify_srp_group>.allocate(capacity: 1)
+        group.initialize(to: amplify_srp_group())
+        let result = amplify_srp_group_init(group, &prime.value, &generator.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            group.deallocate()
+            if result == AMPLIFY_MP_VAL {
+                return nil
+            }
+            fatalError("Error occurred during AmplifySRPGroup init: \(result)")
+        }
+        self.group = group
+    }
+
+    deinit {
+        amplify_srp_group_clear(group)
+        group.deallocate()
+    }
+
+    /// The SRP-6 multiplier k = H(N | g)
+    public var multiplier: AmplifyBigInt {
+        let k = AmplifyBigInt()
+        let result = amplify_mp_copy(&group.pointee.k, &k.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during multiplier operation: \(result)")
+        }
+        return k
+    }
+
+    /// Returns g^exponent mod N
+    public func power(_ exponent: AmplifyBigInt) -> AmplifyBigInt {
+        let power = AmplifyBigInt()
+        let result = amplify_srp_group_power(group, &exponent.value, &power.value)
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during power operation: \(result)")
+        }
+        return power
+    }
+}
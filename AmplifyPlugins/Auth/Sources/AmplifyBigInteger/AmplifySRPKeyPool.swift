@@ -0,0 +1,64 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+/// Fixed size ring of precomputed SRP ephemeral key pairs (a, A = g^a mod N)
+///
+/// Pairs are moved in and out of the ring without copying their digits, so a
+/// taken pair leaves no copy behind and the rest is wiped on deinit. The ring
+/// does no locking, an instance must not be shared between threads.
+public final class AmplifySRPKeyPool {
+
+    var pool = amplify_srp_key_pool()
+
+    /// Creates an empty ring holding at most `capacity` pairs
+    public init(capacity: Int) {
+        let result = amplify_srp_key_pool_init(&pool, Int32(capacity))
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during AmplifySRPKeyPool init: \(result)")
+        }
+    }
+
+    deinit {
+        amplify_srp_key_pool_clear(&pool)
+    }
+
+    public var capacity: Int {
+        Int(pool.size)
+    }
+
+    public var count: Int {
+        Int(pool.used)
+    }
+
+    /// Moves the pair into the ring, the given numbers are left zero.
+    ///
+    /// Returns false and leaves the numbers untouched if the ring is full.
+    @discardableResult
+    public func put(privateKey: AmplifyBigInt, publicKey: AmplifyBigInt) -> Bool {
+        let result = amplify_srp_key_pool_put(&pool, &privateKey.value, &publicKey.value)
+        if result == AMPLIFY_MP_BUF {
+            return false
+        }
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during put operation: \(result)")
+        }
+        return true
+    }
+
+    /// Removes the oldest pair from the ring, nil if it is empty
+    public func take() -> (privateKey: AmplifyBigInt, publicKey: AmplifyBigInt)? {
+        let privateKey = AmplifyBigInt()
+        let publicKey = AmplifyBigInt()
+        guard amplify_srp_key_pool_take(&pool, &privateKey.value, &publicKey.value) == AMPLIFY_MP_YES else {
+            return nil
+        }
+        return (privateKey, publicKey)
+    }
+}
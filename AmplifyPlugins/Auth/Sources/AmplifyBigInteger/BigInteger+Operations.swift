@@ -0,0 +1,95 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+public extension BigInteger {
+
+    // MARK: - Addition
+    static func + (lhs: BigInteger, rhs: BigInteger) -> BigInteger {
+        BigInteger(lhs.storage + rhs.storage)
+    }
+
+    static func + (lhs: BigInteger, rhs: Int) -> BigInteger {
+        lhs + BigInteger(rhs)
+    }
+
+    static func += (lhs: inout BigInteger, rhs: BigInteger) {
+        lhs.formResult("+=") { amplify_mp_add($0, &rhs.storage.value, $1) }
+    }
+
+    // MARK: - Subtraction
+    static func - (lhs: BigInteger, rhs: BigInteger) -> BigInteger {
+        BigInteger(lhs.storage - rhs.storage)
+    }
+
+    static func - (lhs: BigInteger, rhs: Int) -> BigInteger {
+        lhs - BigInteger(rhs)
+    }
+
+    static func -= (lhs: inout BigInteger, rhs: BigInteger) {
+        lhs.formResult("-=") { amplify_mp_sub($0, &rhs.storage.value, $1) }
+    }
+
+    mutating func negate() {
+        formResult("negate") { amplify_mp_neg($0, $1) }
+    }
+
+    // MARK: - Multiplication
+    static func * (lhs: BigInteger, rhs: BigInteger) -> BigInteger {
+        BigInteger(lhs.storage * rhs.storage)
+    }
+
+    static func * (lhs: BigInteger, rhs: Int) -> BigInteger {
+        lhs * BigInteger(rhs)
+    }
+
+    static func *= (lhs: inout BigInteger, rhs: BigInteger) {
+        lhs.formResult("*=") { amplify_mp_mul($0, &rhs.storage.value, $1) }
+    }
+
+    // MARK: - Division
+    static func / (lhs: BigInteger, rhs: BigInteger) -> BigInteger {
+        var quotient = lhs
+        quotient /= rhs
+        return quotient
+    }
+
+    static func /= (lhs: inout BigInteger, rhs: BigInteger) {
+        lhs.formResult("/=") { amplify_mp_div($0, &rhs.storage.value, $1, nil) }
+    }
+
+    static func % (lhs: BigInteger, rhs: BigInteger) -> BigInteger {
+        BigInteger(lhs.storage % rhs.storage)
+    }
+
+    static func % (lhs: BigInteger, rhs: Int) -> BigInteger {
+        lhs % BigInteger(rhs)
+    }
+
+    /// Truncated remainder like `%`, the sign follows lhs
+    static func %= (lhs: inout BigInteger, rhs: BigInteger) {
+        lhs.formResult("%=") { amplify_mp_div($0, &rhs.storage.value, nil, $1) }
+    }
+
+    // MARK: - Exponentional
+
+    func pow(_ power: BigInteger, modulus: BigInteger) -> BigInteger {
+        BigInteger(storage.pow(power.storage, modulus: modulus.storage))
+    }
+
+    /// See `AmplifyBigInt.powCooperatively(_:modulus:)`
+    func powCooperatively(_ power: BigInteger, modulus: BigInteger) async throws -> BigInteger {
+        BigInteger(try await storage.powCooperatively(power.storage, modulus: modulus.storage))
+    }
+
+    /// self = self^power mod modulus
+    mutating func formPower(_ power: BigInteger, modulus: BigInteger) {
+        formResult("formPower") { amplify_mp_exptmod($0, &power.storage.value, &modulus.storage.value, $1) }
+    }
+}
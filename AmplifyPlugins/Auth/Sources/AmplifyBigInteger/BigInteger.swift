@@ -0,0 +1,141 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import Foundation
+import libtommathAmplify
+
+/// Arbitrary precision integer with value semantics
+///
+/// The digits live in an `AmplifyBigInt` that copies share until one of them
+/// is mutated. A compound assignment such as `x *= y` on a value that is not
+/// shared computes into its own digit buffer, so a chain of them allocates
+/// neither objects nor digits once the buffer has grown to size.
+public struct BigInteger {
+
+    var storage: AmplifyBigInt
+
+    public init() {
+        self.storage = AmplifyBigInt()
+    }
+
+    /// Wraps `reference` without copying its digits
+    public init(_ reference: AmplifyBigInt) {
+        self.storage = reference
+    }
+
+    public init?(_ numericString: String, radix: Int = 10) {
+        guard let storage = AmplifyBigInt(numericString, radix: radix) else {
+            return nil
+        }
+        self.storage = storage
+    }
+
+    /// Creates a signed big integer from the bytes provided, see `AmplifyBigInt.init(_:)`
+    public init(_ data: [UInt8]) {
+        self.storage = AmplifyBigInt(data)
+    }
+
+    public init(unsignedData data: [UInt8]) {
+        self.storage = AmplifyBigInt(unsignedData: data)
+    }
+
+    public init(_ int: Int) {
+        self.storage = AmplifyBigInt(int)
+    }
+
+    /// The number as an `AmplifyBigInt` for the C bindings, read-only
+    ///
+    /// The reference shares the digits of this value and of every copy of it,
+    /// so it must not be passed to anything that mutates or consumes its
+    /// argument, such as `AmplifySRPKeyPool.put(privateKey:publicKey:)`. Use
+    /// `copiedReference` for those.
+    public var reference: AmplifyBigInt {
+        storage
+    }
+
+    /// The number as a new `AmplifyBigInt` with its own copy of the digits
+    public var copiedReference: AmplifyBigInt {
+        AmplifyBigInt(storage)
+    }
+
+    public func asString(radix: Int = 10) -> String {
+        storage.asString(radix: radix)
+    }
+
+    public var bytesCount: Int {
+        storage.bytesCount
+    }
+
+    public var byteArray: [UInt8] {
+        storage.byteArray
+    }
+
+    public var unsignedBytesCount: Int {
+        storage.unsignedBytesCount
+    }
+
+    public var unsignedByteArray: [UInt8] {
+        storage.unsignedByteArray
+    }
+
+    /// Stores the result of `operation` in self
+    ///
+    /// `operation` gets the current digits and the ones to write to, which are
+    /// the same buffer unless the storage is shared with another value.
+    mutating func formResult(
+        _ name: String,
+        _ operation: (UnsafePointer<amplify_mp_int>, UnsafeMutablePointer<amplify_mp_int>) -> amplify_mp_err
+    ) {
+        let isUnique = isKnownUniquelyReferenced(&storage)
+        let output = isUnique ? storage : AmplifyBigInt()
+        let result = withUnsafeMutablePointer(to: &output.value) { outputValue in
+            isUnique ? operation(outputValue, outputValue) : operation(&storage.value, outputValue)
+        }
+        guard result == AMPLIFY_MP_OKAY else {
+            fatalError("Error occurred during \(name) operation: \(result)")
+        }
+        storage = output
+    }
+}
+
+extension BigInteger: ExpressibleByIntegerLiteral {
+
+    public init(integerLiteral value: Int) {
+        self.init(value)
+    }
+}
+
+extension BigInteger: Comparable {
+
+    public static func == (lhs: BigInteger, rhs: BigInteger) -> Bool {
+        lhs.storage == rhs.storage
+    }
+
+    public static func < (lhs: BigInteger, rhs: BigInteger) -> Bool {
+        lhs.storage < rhs.storage
+    }
+}
+
+extension BigInteger: CustomStringConvertible {
+
+    public var description: String {
+        asString(radix: 10)
+    }
+}
+
+public extension BigInteger {
+
+    /// Uniformly distributed random number in `0 ..< upperBound`, see `AmplifyBigInt.random(below:)`
+    static func random(below upperBound: BigInteger) -> BigInteger {
+        BigInteger(AmplifyBigInt.random(below: upperBound.storage))
+    }
+
+    /// See `AmplifyBigInt.isValidSRPGroup(prime:generator:)`
+    static func isValidSRPGroup(prime: BigInteger, generator: BigInteger) -> Bool {
+        AmplifyBigInt.isValidSRPGroup(prime: prime.storage, generator: generator.storage)
+    }
+}
@@ -9,7 +9,7 @@ import AmplifyBigInteger
 import CryptoKit
 import Foundation
 
-public typealias BigInt = AmplifyBigInt
+public typealias BigInt = BigInteger
 
 // swiftlint:disable identifier_name
 public struct SRPClientState {
@@ -17,39 +17,30 @@ public struct SRPClientState {
     public let privateA: BigInt
     public let publicA: BigInt
 
-    public init(commonState: SRPCommonState) {
-        self.privateA = SRPClientState.calculatePrivateA(prime: commonState.prime)
-        self.publicA = SRPClientState.calculatePublicA(
-            privateA: privateA,
-            generator: commonState.generator,
-            prime: commonState.prime
+    /// Creates the ephemeral key pair of a login
+    ///
+    /// The pair is taken from `keyPool` when it holds one of the same group,
+    /// otherwise it is computed here with `randomSource`.
+    public init(
+        commonState: SRPCommonState,
+        randomSource: SRPRandomSource = SecureSRPRandomSource(),
+        keyPool: SRPEphemeralKeyPool? = nil
+    ) {
+        if let keyPool, keyPool.matches(commonState), let pair = keyPool.take() {
+            self.privateA = pair.privateA
+            self.publicA = pair.publicA
+            return
+        }
+        self.privateA = SRPClientState.calculatePrivateA(
+            prime: commonState.prime,
+            randomSource: randomSource
         )
+        self.publicA = commonState.power(privateA)
     }
 
-    private static func calculatePrivateA(prime N: BigInt) -> BigInt {
+    static func calculatePrivateA(prime N: BigInt, randomSource: SRPRandomSource) -> BigInt {
         let byteSize = 256 / 8
-        var randomInt: BigInt
-        repeat {
-            randomInt = generateRandomUnsigned(of: byteSize)
-        } while randomInt >= N
-        return randomInt
-    }
-
-    private static func calculatePublicA(
-        privateA: BigInt,
-        generator: BigInt,
-        prime: BigInt
-    ) -> BigInt {
-        return generator.pow(privateA, modulus: prime)
-    }
-
-    private static func generateRandomUnsigned(of byteSize: Int) -> BigInt {
-        var randomBytes = [UInt8](repeating: 0, count: byteSize)
-        let result = SecRandomCopyBytes(kSecRandomDefault, byteSize, &randomBytes)
-        guard result == errSecSuccess else {
-            fatalError("Error occured in generating random bytes")
-        }
-        return BigInt(unsignedData: randomBytes)
+        return randomSource.randomUnsigned(byteCount: byteSize, below: N)
     }
 
     public static func calculcateU(publicClientKey: [UInt8], publicServerKey: [UInt8]) -> BigInt {
@@ -83,22 +74,29 @@ public struct SRPClientState {
 
         let u = calculcateU(publicClientKey: signedPubClient, publicServerKey: signedPubServer)
 
-        // calculate S = (B - k*g^x)^(privateClientKey+u*x)
-        let base = publicServerKey - (commonState.k * commonState.generator.pow(x, modulus: commonState.prime))
-        let exp = privateClientKey + (u * x)
-        let S = base.pow(exp, modulus: commonState.prime)
-        return S
+        // calculate S = (B - k*g^x)^(privateClientKey+u*x), the intermediates are
+        // owned here, so every step reuses their digits
+        var base = commonState.power(x)
+        base *= commonState.k
+        base -= publicServerKey
+        base.negate()
+        var exp = u
+        exp *= x
+        exp += privateClientKey
+        base.formPower(exp, modulus: commonState.prime)
+        return base
     }
 
     public static func calculateDevicePasswordVerifier(
         deviceGroupKey: String,
         deviceKey: String,
         password: String,
-        commonState: SRPCommonState
+        commonState: SRPCommonState,
+        randomSource: SRPRandomSource = SecureSRPRandomSource()
     ) -> (salt: BigInt, passwordVerifier: BigInt) {
 
             // Salt (16 random bytes)
-            let salt = generateRandomUnsigned(of: 16)
+            let salt = BigInt(unsignedData: randomSource.randomBytes(count: 16))
 
             // FULL_PASSWORD = SHA256_HASH(DeviceGroupKey + username + ":" + RANDOM_PASSWORD)
             let fullPassword = [UInt8]("\(deviceGroupKey)\(deviceKey):\(password)".utf8)
@@ -110,7 +108,7 @@ public struct SRPClientState {
             let x = BigInt(unsignedData: [UInt8](hashedSaltAndFullPassword))
 
             // PasswordVerifier = g(salt + FULL_PASSWORD) (mod N)
-            let passwordVerifier = commonState.generator.pow(x, modulus: commonState.prime)
+            let passwordVerifier = commonState.power(x)
 
             return (salt, passwordVerifier)
         }
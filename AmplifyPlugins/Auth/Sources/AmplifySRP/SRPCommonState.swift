@@ -21,10 +21,34 @@ public struct SRPCommonState {
     /// SRP-6 multiplier (known as the k Value)
     public let k: BigInt
 
+    /// k and the powers of g computed ahead, nil if N is not odd
+    public let group: AmplifySRPGroup?
+
+    /// The shared ephemeral key pool of the group, see `SRPEphemeralKeyPool.shared(for:)`
+    let keyPoolSlot = SRPEphemeralKeyPool.Slot()
+
     public init(prime N: BigInt, generator g: BigInt) {
         self.prime = N
         self.generator = g
-        self.k = SRPCommonState.calculateMultiplier(prime: N, generator: g)
+        self.group = AmplifySRPGroup(prime: N.reference, generator: g.reference)
+        if let group {
+            self.k = BigInt(group.multiplier)
+        } else {
+            self.k = SRPCommonState.calculateMultiplier(prime: N, generator: g)
+        }
+    }
+
+    /// Returns g^exponent mod N
+    public func power(_ exponent: BigInt) -> BigInt {
+        guard let group else {
+            return generator.pow(exponent, modulus: prime)
+        }
+        return BigInt(group.power(exponent.reference))
+    }
+
+    /// True if N is a safe prime of at least 1024 bits and 1 < g < N - 1
+    public var isValidGroup: Bool {
+        BigInt.isValidSRPGroup(prime: prime, generator: generator)
     }
 
     static func calculateMultiplier(prime N: BigInt, generator g: BigInt) -> BigInt {
@@ -38,4 +62,44 @@ public struct SRPCommonState {
         return BigInt(unsignedData: hashBytes)
     }
 }
+
+public extension SRPCommonState {
+
+    private static let sharedLock = NSLock()
+    private static var sharedStates: [SHA256.Digest: SRPCommonState] = [:]
+
+    /// The process wide state of the group N, g given in hex, created on first
+    /// use, nil if either value is not a hex number
+    ///
+    /// Later calls with the same group do no big number work at all, they
+    /// find k and the table of powers of g under the digest of the two strings.
+    static func shared(primeHexValue: String, generatorHexValue: String) -> SRPCommonState? {
+        var digest = SHA256()
+        digest.update(data: Data(primeHexValue.utf8))
+        digest.update(data: Data(":".utf8))
+        digest.update(data: Data(generatorHexValue.utf8))
+        let key = digest.finalize()
+
+        sharedLock.lock()
+        let cached = sharedStates[key]
+        sharedLock.unlock()
+        if let cached {
+            return cached
+        }
+
+        // the group is computed outside the lock, a thread losing the race uses the first one stored
+        guard let prime = BigInt(primeHexValue, radix: 16),
+              let generator = BigInt(generatorHexValue, radix: 16) else {
+            return nil
+        }
+        let state = SRPCommonState(prime: prime, generator: generator)
+        sharedLock.lock()
+        defer { sharedLock.unlock() }
+        if let stored = sharedStates[key] {
+            return stored
+        }
+        sharedStates[key] = state
+        return state
+    }
+}
 // swiftlint:enable identifier_name
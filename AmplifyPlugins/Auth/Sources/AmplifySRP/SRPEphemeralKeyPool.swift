@@ -0,0 +1,143 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import Foundation
+
+/// SRP ephemeral key pairs of one group, computed ahead of time
+///
+/// A = g^a mod N is the dominant cost of starting an SRP login. The pool
+/// computes pairs on a utility queue until it holds `depth` of them and
+/// hands every pair out once, so logins arriving in bursts find their keys
+/// ready. Taking a pair starts the next refill.
+public final class SRPEphemeralKeyPool: @unchecked Sendable {
+
+    /// Number of pairs kept ready
+    public let depth: Int
+
+    let prime: BigInt
+    let generator: BigInt
+
+    private let randomSource: SRPRandomSource
+
+    // only used on refillQueue
+    private let context: AmplifySRPClientContext
+
+    // guarded by lock
+    private let pairs: AmplifySRPKeyPool
+    private var isRefilling = false
+
+    private let lock = NSLock()
+    private let refillQueue = DispatchQueue(label: "com.amazonaws.amplify.srp.keypool", qos: .utility)
+
+    public init(
+        commonState: SRPCommonState,
+        depth: Int = 2,
+        randomSource: SRPRandomSource = SecureSRPRandomSource()
+    ) {
+        precondition(depth > 0, "SRPEphemeralKeyPool depth must be positive")
+        self.depth = depth
+        self.prime = commonState.prime
+        self.generator = commonState.generator
+        self.randomSource = randomSource
+        if let group = commonState.group {
+            self.context = AmplifySRPClientContext(group: group)
+        } else {
+            self.context = AmplifySRPClientContext(
+                prime: commonState.prime.reference,
+                generator: commonState.generator.reference
+            )
+        }
+        self.pairs = AmplifySRPKeyPool(capacity: depth)
+        refill()
+    }
+
+    /// Number of pairs ready to be taken
+    public var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return pairs.count
+    }
+
+    /// True if the pool computes its pairs in the group of `commonState`
+    public func matches(_ commonState: SRPCommonState) -> Bool {
+        prime == commonState.prime && generator == commonState.generator
+    }
+
+    /// Removes a precomputed pair from the pool, nil if none is ready yet
+    public func take() -> (privateA: BigInt, publicA: BigInt)? {
+        lock.lock()
+        let pair = pairs.take()
+        lock.unlock()
+        refill()
+        return pair.map { (BigInt($0.privateKey), BigInt($0.publicKey)) }
+    }
+
+    private func refill() {
+        lock.lock()
+        defer { lock.unlock() }
+        guard !isRefilling, pairs.count < depth else {
+            return
+        }
+        isRefilling = true
+        refillQueue.async { [weak self] in
+            self?.fill()
+        }
+    }
+
+    private func fill() {
+        var isFull = false
+        while !isFull {
+            // the exponentiation runs outside the lock, only the move into the ring is guarded
+            let privateA = SRPClientState.calculatePrivateA(prime: prime, randomSource: randomSource)
+            let publicA = context.power(privateA.reference)
+
+            lock.lock()
+            pairs.put(privateKey: privateA.copiedReference, publicKey: publicA)
+            isFull = pairs.count >= depth
+            if isFull {
+                isRefilling = false
+            }
+            lock.unlock()
+        }
+    }
+}
+
+public extension SRPEphemeralKeyPool {
+
+    /// The pool of the group of `commonState`, created on first use
+    ///
+    /// The pool hangs on the state and its copies, so finding it takes no big
+    /// number work. The states of `SRPCommonState.shared` live for the whole
+    /// process, and so does the one pool of each of their groups.
+    static func shared(for commonState: SRPCommonState) -> SRPEphemeralKeyPool {
+        commonState.keyPoolSlot.pool(for: commonState)
+    }
+}
+
+extension SRPEphemeralKeyPool {
+
+    /// The pool of one `SRPCommonState` and its copies
+    final class Slot: @unchecked Sendable {
+
+        // guarded by lock
+        private var pool: SRPEphemeralKeyPool?
+
+        private let lock = NSLock()
+
+        func pool(for commonState: SRPCommonState) -> SRPEphemeralKeyPool {
+            lock.lock()
+            defer { lock.unlock() }
+            if let pool {
+                return pool
+            }
+            let pool = SRPEphemeralKeyPool(commonState: commonState)
+            self.pool = pool
+            return pool
+        }
+    }
+}
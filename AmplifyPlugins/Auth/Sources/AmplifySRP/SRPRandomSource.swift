@@ -0,0 +1,60 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import Foundation
+import Security
+
+/// Source of the random private keys and salts used by the SRP client
+public protocol SRPRandomSource {
+
+    /// Returns `count` cryptographically secure random bytes.
+    func randomBytes(count: Int) -> [UInt8]
+
+    /// Returns a random unsigned number of at most `byteCount` bytes that is smaller than `upperBound`.
+    func randomUnsigned(byteCount: Int, below upperBound: BigInt) -> BigInt
+}
+
+public extension SRPRandomSource {
+
+    func randomUnsigned(byteCount: Int, below upperBound: BigInt) -> BigInt {
+        var randomInt: BigInt
+        repeat {
+            randomInt = BigInt(unsignedData: randomBytes(count: byteCount))
+        } while randomInt >= upperBound
+        return randomInt
+    }
+}
+
+/// Reads every request from `SecRandomCopyBytes`.
+public struct SecureSRPRandomSource: SRPRandomSource {
+
+    public init() { }
+
+    public func randomBytes(count: Int) -> [UInt8] {
+        var randomBytes = [UInt8](repeating: 0, count: count)
+        let result = SecRandomCopyBytes(kSecRandomDefault, count, &randomBytes)
+        guard result == errSecSuccess else {
+            fatalError("Error occured in generating random bytes")
+        }
+        return randomBytes
+    }
+}
+
+/// Serves requests from a buffered per-thread ChaCha20 generator that is
+/// reseeded from the platform source, avoiding a system call per key.
+///
+/// The source draws from the generator directly and leaves the random source
+/// of the big integer library alone, see `AmplifyRandomGenerator.installBufferedGenerator()`.
+public struct BufferedSRPRandomSource: SRPRandomSource {
+
+    public init() { }
+
+    public func randomBytes(count: Int) -> [UInt8] {
+        AmplifyRandomGenerator.bufferedRandomBytes(count: count)
+    }
+}
@@ -9,7 +9,11 @@
 int AMPLIFY_KARATSUBA_MUL_CUTOFF = AMPLIFY_MP_DEFAULT_KARATSUBA_MUL_CUTOFF,
     AMPLIFY_KARATSUBA_SQR_CUTOFF = AMPLIFY_MP_DEFAULT_KARATSUBA_SQR_CUTOFF,
     AMPLIFY_TOOM_MUL_CUTOFF = AMPLIFY_MP_DEFAULT_TOOM_MUL_CUTOFF,
-    AMPLIFY_TOOM_SQR_CUTOFF = AMPLIFY_MP_DEFAULT_TOOM_SQR_CUTOFF;
+    AMPLIFY_TOOM_SQR_CUTOFF = AMPLIFY_MP_DEFAULT_TOOM_SQR_CUTOFF,
+    AMPLIFY_TOOM4_MUL_CUTOFF = AMPLIFY_MP_DEFAULT_TOOM4_MUL_CUTOFF,
+    AMPLIFY_TOOM4_SQR_CUTOFF = AMPLIFY_MP_DEFAULT_TOOM4_SQR_CUTOFF,
+    AMPLIFY_FFT_MUL_CUTOFF = AMPLIFY_MP_DEFAULT_FFT_MUL_CUTOFF,
+    AMPLIFY_FFT_SQR_CUTOFF = AMPLIFY_MP_DEFAULT_FFT_SQR_CUTOFF;
 #endif
 
 #endif
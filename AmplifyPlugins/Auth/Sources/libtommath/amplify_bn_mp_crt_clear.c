@@ -0,0 +1,20 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_CRT_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+void amplify_mp_crt_clear(amplify_mp_crt_ctx *ctx)
+{
+   int i;
+
+   for (i = 0; i < ctx->count; i++) {
+      amplify_s_mp_mont_clear(&ctx->f[i].mont);
+      amplify_mp_clear_multi(&ctx->f[i].p, &ctx->f[i].pm1, &ctx->f[i].m, &ctx->f[i].c, NULL);
+   }
+   AMPLIFY_MP_FREE_BUFFER(ctx->f, (size_t)ctx->count * sizeof(*ctx->f));
+   ctx->f = NULL;
+   ctx->count = 0;
+   amplify_mp_clear(&ctx->P);
+}
+#endif
@@ -0,0 +1,62 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_CRT_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* The factors live in one zeroed array, amplify_mp_crt_clear can release it
+ * after a failure at any point since clearing a zeroed amplify_mp_int is a no-op.
+ */
+amplify_mp_err amplify_mp_crt_init(amplify_mp_crt_ctx *ctx, const amplify_mp_int *p, int count)
+{
+   struct amplify_s_mp_crt_factor *f;
+   amplify_mp_bool prime;
+   amplify_mp_err err;
+   int i;
+
+   if (count < 1) {
+      return AMPLIFY_MP_VAL;
+   }
+   for (i = 0; i < count; i++) {
+      if (AMPLIFY_MP_IS_EVEN(&p[i]) || (amplify_mp_cmp_d(&p[i], 2uL) != AMPLIFY_MP_GT)) {
+         return AMPLIFY_MP_VAL;
+      }
+
+      /* exponents are reduced modulo p[i] - 1, which is only sound for a prime */
+      if ((err = amplify_mp_prime_is_prime(&p[i], amplify_mp_prime_rabin_miller_trials(amplify_mp_count_bits(&p[i])),
+                                           &prime)) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+      if (prime == AMPLIFY_MP_NO) {
+         return AMPLIFY_MP_VAL;
+      }
+   }
+
+   f = (struct amplify_s_mp_crt_factor *) AMPLIFY_MP_CALLOC((size_t)count, sizeof(*f));
+   if (f == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   ctx->f = f;
+   ctx->count = count;
+   if ((err = amplify_mp_init_set(&ctx->P, 1u)) != AMPLIFY_MP_OKAY) {
+      goto LBL_ERR;
+   }
+
+   for (i = 0; i < count; i++) {
+      if ((err = amplify_mp_init_multi(&f[i].p, &f[i].pm1, &f[i].m, &f[i].c, NULL)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      if ((err = amplify_mp_copy(&p[i], &f[i].p)) != AMPLIFY_MP_OKAY)                goto LBL_ERR;
+      if ((err = amplify_mp_sub_d(&p[i], 1u, &f[i].pm1)) != AMPLIFY_MP_OKAY)         goto LBL_ERR;
+      if ((err = amplify_mp_copy(&ctx->P, &f[i].m)) != AMPLIFY_MP_OKAY)              goto LBL_ERR;
+
+      /* AMPLIFY_MP_VAL unless the factor is coprime with the ones before it */
+      if ((err = amplify_mp_invmod(&f[i].m, &f[i].p, &f[i].c)) != AMPLIFY_MP_OKAY)   goto LBL_ERR;
+      if ((err = amplify_mp_mul(&ctx->P, &f[i].p, &ctx->P)) != AMPLIFY_MP_OKAY)      goto LBL_ERR;
+      if ((err = amplify_s_mp_mont_init(&f[i].mont, &f[i].p)) != AMPLIFY_MP_OKAY)    goto LBL_ERR;
+   }
+   return AMPLIFY_MP_OKAY;
+
+LBL_ERR:
+   amplify_mp_crt_clear(ctx);
+   return err;
+}
+#endif
@@ -7,7 +7,7 @@
 #ifdef AMPLIFY_BN_MP_DIV_SMALL
 
 /* slower bit-bang division... also smaller */
-amplify_mp_err amplify_mp_div(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c, amplify_mp_int *d)
+static amplify_mp_err s_mp_div(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c, amplify_mp_int *d)
 {
    amplify_mp_int ta, tb, tq, q;
    int     n, n2;
@@ -84,7 +84,7 @@ LBL_ERR:
  * The overall algorithm is as described as
  * 14.20 from HAC but fixed to treat these cases.
 */
-amplify_mp_err amplify_mp_div(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c, amplify_mp_int *d)
+static amplify_mp_err s_mp_div(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c, amplify_mp_int *d)
 {
    amplify_mp_int  q, x, y, t1, t2;
    int     n, t, i, norm;
@@ -248,4 +248,9 @@ LBL_Q:
 
 #endif
 
+amplify_mp_err amplify_mp_div(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c, amplify_mp_int *d)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_DIV, a->used + b->used, s_mp_div(a, b, c, d));
+}
+
 #endif
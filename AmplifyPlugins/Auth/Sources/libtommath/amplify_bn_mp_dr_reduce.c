@@ -18,7 +18,7 @@
  *
  * Input x must be in the range 0 <= x <= (n-1)**2
  */
-amplify_mp_err amplify_mp_dr_reduce(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit k)
+static amplify_mp_err s_mp_dr_reduce(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit k)
 {
    amplify_mp_err      err;
    int i, m;
@@ -76,4 +76,9 @@ top:
    }
    return AMPLIFY_MP_OKAY;
 }
+
+amplify_mp_err amplify_mp_dr_reduce(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit k)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_REDUCE, x->used, s_mp_dr_reduce(x, n, k));
+}
 #endif
@@ -9,7 +9,7 @@
  * embedded in the normal function but that wasted alot of stack space
  * for nothing (since 99% of the time the Montgomery code would be called)
  */
-amplify_mp_err amplify_mp_exptmod(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y)
+static amplify_mp_err s_mp_exptmod(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y)
 {
    int dr;
 
@@ -31,8 +31,11 @@ amplify_mp_err amplify_mp_exptmod(const amplify_mp_int *G, const amplify_mp_int
          return err;
       }
 
-      /* first compute 1/G mod P */
-      if ((err = amplify_mp_invmod(G, P, &tmpG)) != AMPLIFY_MP_OKAY) {
+      /* first compute 1/G mod P, of the reduced G since amplify_mp_invmod gets negative input wrong */
+      if ((err = amplify_mp_mod(G, P, &tmpG)) != AMPLIFY_MP_OKAY) {
+         goto LBL_ERR;
+      }
+      if ((err = amplify_mp_invmod(&tmpG, P, &tmpG)) != AMPLIFY_MP_OKAY) {
          goto LBL_ERR;
       }
 
@@ -42,7 +45,7 @@ amplify_mp_err amplify_mp_exptmod(const amplify_mp_int *G, const amplify_mp_int
       }
 
       /* and now compute (1/G)**|X| instead of G**X [X < 0] */
-      err = amplify_mp_exptmod(&tmpG, &tmpX, P, Y);
+      err = s_mp_exptmod(&tmpG, &tmpX, P, Y);
 LBL_ERR:
       amplify_mp_clear_multi(&tmpG, &tmpX, NULL);
       return err;
@@ -62,9 +65,18 @@ LBL_ERR:
       dr = (amplify_mp_reduce_is_2k(P) == AMPLIFY_MP_YES) ? 2 : 0;
    }
 
+   /* odd modulus and an accelerated row kernel, Montgomery on full 64-bit limbs */
+   if (AMPLIFY_MP_LIMB64 && AMPLIFY_MP_HAS(S_MP_EXPTMOD_LIMB64) && AMPLIFY_MP_IS_ODD(P) && (dr == 0) &&
+       (amplify_s_mp_addmul_row64_kernel() != NULL)) {
+      return amplify_s_mp_exptmod_limb64(G, X, P, Y);
+   }
+
    /* if the modulus is odd or dr != 0 use the montgomery method */
    if (AMPLIFY_MP_HAS(S_MP_EXPTMOD_FAST) && (AMPLIFY_MP_IS_ODD(P) || (dr != 0))) {
       return amplify_s_mp_exptmod_fast(G, X, P, Y, dr);
+   } else if (AMPLIFY_MP_HAS(S_MP_EXPTMOD_EVEN) && !AMPLIFY_MP_IS_ZERO(P)) {
+      /* even modulus, Montgomery on its odd part and CRT with the power of two */
+      return amplify_s_mp_exptmod_even(G, X, P, Y);
    } else if (AMPLIFY_MP_HAS(S_MP_EXPTMOD)) {
       /* otherwise use the generic Barrett reduction technique */
       return amplify_s_mp_exptmod(G, X, P, Y, 0);
@@ -74,4 +86,9 @@ LBL_ERR:
    }
 }
 
+amplify_mp_err amplify_mp_exptmod(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_EXPTMOD, G->used + X->used + P->used, s_mp_exptmod(G, X, P, Y));
+}
+
 #endif
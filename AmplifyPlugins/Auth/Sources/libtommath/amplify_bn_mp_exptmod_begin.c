@@ -0,0 +1,101 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_EXPTMOD_BEGIN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+#ifdef AMPLIFY_MP_LOW_MEM
+#   define MAX_WINSIZE 4
+#else
+#   define MAX_WINSIZE 6
+#endif
+
+amplify_mp_err amplify_mp_exptmod_begin(amplify_mp_exptmod_state *st, const amplify_mp_int *G, const amplify_mp_int *X,
+                                        const amplify_mp_int *P)
+{
+   amplify_mp_int G2;
+   int    bits, j;
+   amplify_mp_err err;
+
+   st->M = NULL;
+   st->mont = AMPLIFY_MP_NO;
+   st->winsize = 0;
+   st->bit = -1;
+   if ((err = amplify_mp_init_multi(&st->P, &st->X, &st->res, &G2, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   if (P->sign == AMPLIFY_MP_NEG) {
+      err = AMPLIFY_MP_VAL;
+      goto LBL_ERR;
+   }
+
+   /* only Montgomery's method is sliced, other moduli are done right away */
+   if (AMPLIFY_MP_IS_EVEN(P) || (amplify_mp_cmp_d(P, 1uL) != AMPLIFY_MP_GT)) {
+      if ((err = amplify_mp_exptmod(G, X, P, &st->res)) != AMPLIFY_MP_OKAY) {
+         goto LBL_ERR;
+      }
+      amplify_mp_clear(&G2);
+      return AMPLIFY_MP_OKAY;
+   }
+
+   if ((err = amplify_mp_copy(P, &st->P)) != AMPLIFY_MP_OKAY)                  goto LBL_ERR;
+   if ((err = amplify_mp_montgomery_setup(P, &st->rho)) != AMPLIFY_MP_OKAY)    goto LBL_ERR;
+
+   /* res = G mod P, or 1/G for negative X, of the reduced G since amplify_mp_invmod gets negative input wrong */
+   if ((err = amplify_mp_mod(G, P, &st->res)) != AMPLIFY_MP_OKAY)              goto LBL_ERR;
+   if (X->sign == AMPLIFY_MP_NEG) {
+      if ((err = amplify_mp_invmod(&st->res, P, &st->res)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      if ((err = amplify_mp_abs(X, &st->X)) != AMPLIFY_MP_OKAY)                goto LBL_ERR;
+   } else {
+      if ((err = amplify_mp_copy(X, &st->X)) != AMPLIFY_MP_OKAY)               goto LBL_ERR;
+   }
+
+   bits = amplify_mp_count_bits(&st->X);
+   if (bits <= 7) {
+      st->winsize = 2;
+   } else if (bits <= 36) {
+      st->winsize = 3;
+   } else if (bits <= 140) {
+      st->winsize = 4;
+   } else if (bits <= 450) {
+      st->winsize = 5;
+   } else {
+      st->winsize = 6;
+   }
+   st->winsize = AMPLIFY_MP_MIN(st->winsize, MAX_WINSIZE);
+
+   /* zeroed entries are safe to clear, so a partial table unwinds in clear */
+   st->M = (amplify_mp_int *) AMPLIFY_MP_CALLOC((size_t)1 << (st->winsize - 1), sizeof(amplify_mp_int));
+   if (st->M == NULL) {
+      err = AMPLIFY_MP_MEM;
+      goto LBL_ERR;
+   }
+   for (j = 0; j < (1 << (st->winsize - 1)); j++) {
+      if ((err = amplify_mp_init_size(&st->M[j], P->alloc)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   }
+
+   /* M[0] = G * R mod P, res = R mod P */
+   if ((err = amplify_mp_montgomery_calc_normalization(&G2, P)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   if ((err = amplify_mp_mulmod(&st->res, &G2, P, &st->M[0])) != AMPLIFY_MP_OKAY)  goto LBL_ERR;
+   amplify_mp_exch(&G2, &st->res);
+   st->mont = AMPLIFY_MP_YES;
+
+   /* M[j] = G**(2j+1) */
+   if ((err = amplify_mp_sqr(&st->M[0], &G2)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_montgomery_reduce(&G2, P, st->rho)) != AMPLIFY_MP_OKAY)     goto LBL_ERR;
+   for (j = 1; j < (1 << (st->winsize - 1)); j++) {
+      if ((err = amplify_mp_mul(&st->M[j - 1], &G2, &st->M[j])) != AMPLIFY_MP_OKAY)  goto LBL_ERR;
+      if ((err = amplify_mp_montgomery_reduce(&st->M[j], P, st->rho)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   }
+
+   st->bit = bits - 1;
+   amplify_mp_clear(&G2);
+   return AMPLIFY_MP_OKAY;
+
+LBL_ERR:
+   amplify_mp_clear(&G2);
+   amplify_mp_exptmod_clear(st);
+   return err;
+}
+#endif
@@ -0,0 +1,23 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_EXPTMOD_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+void amplify_mp_exptmod_clear(amplify_mp_exptmod_state *st)
+{
+   int i;
+
+   /* amplify_mp_clear wipes the digits, the exponent included */
+   if (st->M != NULL) {
+      for (i = 0; i < (1 << (st->winsize - 1)); i++) {
+         amplify_mp_clear(&st->M[i]);
+      }
+      AMPLIFY_MP_FREE_BUFFER(st->M, ((size_t)1 << (st->winsize - 1)) * sizeof(amplify_mp_int));
+      st->M = NULL;
+   }
+   amplify_mp_clear_multi(&st->P, &st->X, &st->res, NULL);
+   st->mont = AMPLIFY_MP_NO;
+   st->bit = -1;
+}
+#endif
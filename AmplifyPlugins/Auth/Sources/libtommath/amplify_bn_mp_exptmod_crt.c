@@ -0,0 +1,220 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_EXPTMOD_CRT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* Y = G**X mod P from the powers modulo the factors of P.
+ *
+ * Each factor p costs an exponentiation of a number of half (third, ...) the
+ * size of P to an exponent reduced modulo p - 1, so two factors take about a
+ * quarter of the work of amplify_mp_exptmod on one thread.  The workers take
+ * the factors one at a time, the calling one included, and write disjoint
+ * residues; the context is only read.  Garner's method joins the residues on
+ * the calling thread once all of them are in.
+ */
+
+#ifndef AMPLIFY_MP_CRT_MAX_THREADS
+#  define AMPLIFY_MP_CRT_MAX_THREADS 16
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <pthread.h>
+#  define S_THREADS
+#endif
+
+typedef struct {
+   const amplify_mp_crt_ctx *ctx;
+   const amplify_mp_int *G, *X;
+   amplify_mp_int *r;           /* r[i] = G**X mod p[i] */
+   int next;                    /* the next factor to take */
+   amplify_mp_err err;          /* the first failure */
+#ifdef S_THREADS
+   amplify_mp_bool shared;      /* the fields above are guarded by lock */
+   pthread_mutex_t lock;
+#endif
+} s_job;
+
+static void s_lock(s_job *job)
+{
+#ifdef S_THREADS
+   if (job->shared == AMPLIFY_MP_YES) {
+      (void)pthread_mutex_lock(&job->lock);
+   }
+#else
+   (void)job;
+#endif
+}
+
+static void s_unlock(s_job *job)
+{
+#ifdef S_THREADS
+   if (job->shared == AMPLIFY_MP_YES) {
+      (void)pthread_mutex_unlock(&job->lock);
+   }
+#else
+   (void)job;
+#endif
+}
+
+/* r = G**X mod f->p */
+static amplify_mp_err s_exptmod_factor(const struct amplify_s_mp_crt_factor *f, const amplify_mp_int *G, const amplify_mp_int *X,
+                                       amplify_mp_int *r)
+{
+   amplify_mp_int g, e;
+   amplify_mp_err err;
+
+   if ((err = amplify_mp_init_multi(&g, &e, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   if ((err = amplify_mp_mod(G, &f->p, &g)) != AMPLIFY_MP_OKAY)                goto LBL_ERR;
+
+   /* the exponent can only be reduced for the units, a multiple of p stays 0 */
+   if (AMPLIFY_MP_IS_ZERO(&g)) {
+      amplify_mp_set(r, AMPLIFY_MP_IS_ZERO(X) ? 1u : 0u);
+      goto LBL_ERR;
+   }
+   if ((err = amplify_mp_mod(X, &f->pm1, &e)) != AMPLIFY_MP_OKAY)              goto LBL_ERR;
+
+   if (AMPLIFY_MP_LIMB64 && AMPLIFY_MP_HAS(S_MP_EXPTMOD_LIMB64) &&
+       (amplify_s_mp_addmul_row64_kernel() != NULL)) {
+      err = amplify_s_mp_exptmod_limb64(&g, &e, &f->p, r);
+   } else {
+      if ((err = amplify_s_mp_mont_to(&f->mont, &g, &g)) != AMPLIFY_MP_OKAY)    goto LBL_ERR;
+      if ((err = amplify_s_mp_mont_exptmod(&f->mont, &g, &e, r)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      err = amplify_s_mp_mont_from(&f->mont, r, r);
+   }
+
+LBL_ERR:
+   amplify_mp_clear_multi(&g, &e, NULL);
+   return err;
+}
+
+static void *s_worker(void *arg)
+{
+   s_job *job = (s_job *)arg;
+   amplify_mp_err err;
+   int i;
+
+   for (;;) {
+      s_lock(job);
+      i = job->next++;
+      err = job->err;
+      s_unlock(job);
+      if ((i >= job->ctx->count) || (err != AMPLIFY_MP_OKAY)) {
+         break;
+      }
+
+      err = s_exptmod_factor(&job->ctx->f[i], job->G, job->X, &job->r[i]);
+      if (err != AMPLIFY_MP_OKAY) {
+         s_lock(job);
+         if (job->err == AMPLIFY_MP_OKAY) {
+            job->err = err;
+         }
+         s_unlock(job);
+      }
+   }
+   return NULL;
+}
+
+/* Y = the number below P with Y = r[i] mod p[i] for every i */
+static amplify_mp_err s_garner(const amplify_mp_crt_ctx *ctx, const amplify_mp_int *r, amplify_mp_int *Y)
+{
+   amplify_mp_int t;
+   amplify_mp_err err;
+   int i;
+
+   if ((err = amplify_mp_init(&t)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   if ((err = amplify_mp_copy(&r[0], Y)) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   for (i = 1; i < ctx->count; i++) {
+      const struct amplify_s_mp_crt_factor *f = &ctx->f[i];
+
+      /* Y += m * ((r[i] - Y) * m**-1 mod p), Y stays below m * p */
+      if ((err = amplify_mp_sub(&r[i], Y, &t)) != AMPLIFY_MP_OKAY)             goto LBL_ERR;
+      if ((err = amplify_mp_mulmod(&t, &f->c, &f->p, &t)) != AMPLIFY_MP_OKAY)  goto LBL_ERR;
+      if ((err = amplify_mp_mul(&t, &f->m, &t)) != AMPLIFY_MP_OKAY)            goto LBL_ERR;
+      if ((err = amplify_mp_add(Y, &t, Y)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+   }
+
+LBL_ERR:
+   amplify_mp_clear(&t);
+   return err;
+}
+
+amplify_mp_err amplify_mp_exptmod_crt(const amplify_mp_crt_ctx *ctx, const amplify_mp_int *G, const amplify_mp_int *X,
+                                      amplify_mp_int *Y, int threads)
+{
+#ifdef S_THREADS
+   pthread_t tid[AMPLIFY_MP_CRT_MAX_THREADS - 1];
+#endif
+   amplify_mp_int *r;
+   amplify_mp_err err;
+   s_job job;
+   int i, n = 0;
+
+   if (X->sign == AMPLIFY_MP_NEG) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   /* zeroed, so that all of them can be cleared whatever fails */
+   r = (amplify_mp_int *) AMPLIFY_MP_CALLOC((size_t)ctx->count, sizeof(amplify_mp_int));
+   if (r == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   for (i = 0; i < ctx->count; i++) {
+      if ((err = amplify_mp_init_size(&r[i], ctx->f[i].p.used)) != AMPLIFY_MP_OKAY) {
+         goto LBL_ERR;
+      }
+   }
+
+   job.ctx = ctx;
+   job.G = G;
+   job.X = X;
+   job.r = r;
+   job.next = 0;
+   job.err = AMPLIFY_MP_OKAY;
+
+#ifdef S_THREADS
+   threads = AMPLIFY_MP_MIN(AMPLIFY_MP_MIN(threads, ctx->count), AMPLIFY_MP_CRT_MAX_THREADS);
+   job.shared = (threads > 1) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
+   if ((job.shared == AMPLIFY_MP_YES) && (pthread_mutex_init(&job.lock, NULL) != 0)) {
+      err = AMPLIFY_MP_ERR;
+      goto LBL_ERR;
+   }
+
+   /* fewer threads than asked for is fine, the caller always works along */
+   for (n = 0; n < (threads - 1); ++n) {
+      if (pthread_create(&tid[n], NULL, s_worker, &job) != 0) {
+         break;
+      }
+   }
+   (void)s_worker(&job);
+   for (i = 0; i < n; ++i) {
+      (void)pthread_join(tid[i], NULL);
+   }
+   if (job.shared == AMPLIFY_MP_YES) {
+      (void)pthread_mutex_destroy(&job.lock);
+   }
+#else
+   (void)threads;
+   (void)n;
+   (void)s_worker(&job);
+#endif
+
+   err = job.err;
+   if (err == AMPLIFY_MP_OKAY) {
+      err = s_garner(ctx, r, Y);
+   }
+
+LBL_ERR:
+   for (i = 0; i < ctx->count; i++) {
+      amplify_mp_clear(&r[i]);
+   }
+   AMPLIFY_MP_FREE_BUFFER(r, (size_t)ctx->count * sizeof(amplify_mp_int));
+   return err;
+}
+#endif
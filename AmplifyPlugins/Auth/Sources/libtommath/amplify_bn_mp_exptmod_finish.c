@@ -0,0 +1,25 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_EXPTMOD_FINISH_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_mp_exptmod_finish(amplify_mp_exptmod_state *st, amplify_mp_int *Y)
+{
+   amplify_mp_err err = AMPLIFY_MP_OKAY;
+
+   if (st->bit >= 0) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   /* out of the Montgomery domain */
+   if (st->mont == AMPLIFY_MP_YES) {
+      err = amplify_mp_montgomery_reduce(&st->res, &st->P, st->rho);
+   }
+   if (err == AMPLIFY_MP_OKAY) {
+      amplify_mp_exch(&st->res, Y);
+   }
+   amplify_mp_exptmod_clear(st);
+   return err;
+}
+#endif
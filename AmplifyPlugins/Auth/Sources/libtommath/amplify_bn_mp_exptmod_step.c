@@ -0,0 +1,68 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_EXPTMOD_STEP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* res = res * b / R mod P */
+static amplify_mp_err s_mul(amplify_mp_exptmod_state *st, const amplify_mp_int *b)
+{
+   amplify_mp_err err;
+   if ((err = amplify_mp_mul(&st->res, b, &st->res)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_mp_montgomery_reduce(&st->res, &st->P, st->rho);
+}
+
+/* res = res * res / R mod P */
+static amplify_mp_err s_sqr(amplify_mp_exptmod_state *st)
+{
+   amplify_mp_err err;
+   if ((err = amplify_mp_sqr(&st->res, &st->res)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_mp_montgomery_reduce(&st->res, &st->P, st->rho);
+}
+
+/* scans at most budget windows of X, a zero bit between windows counts as one */
+amplify_mp_err amplify_mp_exptmod_step(amplify_mp_exptmod_state *st, int budget, amplify_mp_bool *done)
+{
+   int    i, j, w, x;
+   amplify_mp_err err;
+
+   if (budget < 1) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   i = st->bit;
+   while ((i >= 0) && (budget-- > 0)) {
+      if (amplify_s_mp_get_bit(&st->X, (unsigned int)i) == AMPLIFY_MP_NO) {
+         if ((err = s_sqr(st)) != AMPLIFY_MP_OKAY) {
+            return err;
+         }
+         st->bit = --i;
+         continue;
+      }
+
+      /* longest window X[i..j] of at most winsize bits that ends in a one */
+      j = AMPLIFY_MP_MAX(i - st->winsize + 1, 0);
+      while (amplify_s_mp_get_bit(&st->X, (unsigned int)j) == AMPLIFY_MP_NO) {
+         ++j;
+      }
+      w = 0;
+      for (x = i; x >= j; x--) {
+         w = (w << 1) | ((amplify_s_mp_get_bit(&st->X, (unsigned int)x) == AMPLIFY_MP_YES) ? 1 : 0);
+         if ((err = s_sqr(st)) != AMPLIFY_MP_OKAY) {
+            return err;
+         }
+      }
+      if ((err = s_mul(st, &st->M[w >> 1])) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+      st->bit = i = j - 1;
+   }
+
+   *done = (st->bit < 0) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
+   return AMPLIFY_MP_OKAY;
+}
+#endif
@@ -5,25 +5,12 @@
 /* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
 
 /* computes xR**-1 == x (mod N) via Montgomery Reduction */
-amplify_mp_err amplify_mp_montgomery_reduce(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit rho)
+static amplify_mp_err s_mp_montgomery_reduce(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit rho, int digs)
 {
-   int      ix, digs;
+   int      ix;
    amplify_mp_err   err;
    amplify_mp_digit mu;
 
-   /* can the fast reduction [comba] method be used?
-    *
-    * Note that unlike in mul you're safely allowed *less*
-    * than the available columns [255 per default] since carries
-    * are fixed up in the inner loop.
-    */
-   digs = (n->used * 2) + 1;
-   if ((digs < AMPLIFY_MP_WARRAY) &&
-       (x->used <= AMPLIFY_MP_WARRAY) &&
-       (n->used < AMPLIFY_MP_MAXFAST)) {
-      return amplify_s_mp_montgomery_reduce_fast(x, n, rho);
-   }
-
    /* grow the input as required */
    if (x->alloc < digs) {
       if ((err = amplify_mp_grow(x, digs)) != AMPLIFY_MP_OKAY) {
@@ -100,4 +87,22 @@ amplify_mp_err amplify_mp_montgomery_reduce(amplify_mp_int *x, const amplify_mp_
 
    return AMPLIFY_MP_OKAY;
 }
+
+amplify_mp_err amplify_mp_montgomery_reduce(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit rho)
+{
+   /* can the fast reduction [comba] method be used?
+    *
+    * Note that unlike in mul you're safely allowed *less*
+    * than the available columns [255 per default] since carries
+    * are fixed up in the inner loop.
+    */
+   int digs = (n->used * 2) + 1;
+   if ((digs < AMPLIFY_MP_WARRAY) &&
+       (x->used <= AMPLIFY_MP_WARRAY) &&
+       (n->used < AMPLIFY_MP_MAXFAST)) {
+      return amplify_s_mp_montgomery_reduce_fast(x, n, rho);
+   }
+
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_REDUCE, x->used, s_mp_montgomery_reduce(x, n, rho, digs));
+}
 #endif
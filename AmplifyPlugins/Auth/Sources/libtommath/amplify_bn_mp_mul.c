@@ -5,7 +5,7 @@
 /* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
 
 /* high level multiplication (handles sign) */
-amplify_mp_err amplify_mp_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+static amplify_mp_err s_mp_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
 {
    amplify_mp_err err;
    int min_len = AMPLIFY_MP_MIN(a->used, b->used),
@@ -13,7 +13,28 @@ amplify_mp_err amplify_mp_mul(const amplify_mp_int *a, const amplify_mp_int *b,
        digs = a->used + b->used + 1;
    amplify_mp_sign neg = (a->sign == b->sign) ? AMPLIFY_MP_ZPOS : AMPLIFY_MP_NEG;
 
-   if (AMPLIFY_MP_HAS(S_MP_BALANCE_MUL) &&
+   if (AMPLIFY_MP_HAS(S_MP_FFT_MUL) &&
+       /* the transform takes lopsided operands as they are */
+       (min_len >= AMPLIFY_MP_FFT_MUL_CUTOFF) &&
+       ((a->used + b->used) <= AMPLIFY_MP_FFT_MAX_DIGITS)) {
+      err = amplify_s_mp_fft_mul(a, b, c);
+   } else if (AMPLIFY_MP_HAS(S_MP_TOOM32_MUL) &&
+              /* Unbalanced Toom-Cook, chosen by the number of sub-products:
+               * a 3:2 split needs four of max_len/3 digits where balanced
+               * Toom-3 needs five, a 4:2 split needs five of max_len/4 digits
+               * where slicing into min_len pieces needs two to three full
+               * products. Past 1:3 the slices win again.
+               */
+              (min_len >= AMPLIFY_MP_KARATSUBA_MUL_CUTOFF) &&
+              ((2 * max_len) >= (3 * min_len)) &&
+              (max_len < (2 * min_len))) {
+      err = amplify_s_mp_toom32_mul(a, b, c);
+   } else if (AMPLIFY_MP_HAS(S_MP_TOOM42_MUL) &&
+              (min_len >= AMPLIFY_MP_KARATSUBA_MUL_CUTOFF) &&
+              (max_len >= (2 * min_len)) &&
+              (max_len <= (3 * min_len))) {
+      err = amplify_s_mp_toom42_mul(a, b, c);
+   } else if (AMPLIFY_MP_HAS(S_MP_BALANCE_MUL) &&
        /* Check sizes. The smaller one needs to be larger than the Karatsuba cut-off.
         * The bigger one needs to be at least about one AMPLIFY_MP_KARATSUBA_MUL_CUTOFF bigger
         * to make some sense, but it depends on architecture, OS, position of the
@@ -23,9 +44,12 @@ amplify_mp_err amplify_mp_mul(const amplify_mp_int *a, const amplify_mp_int *b,
         */
        (min_len >= AMPLIFY_MP_KARATSUBA_MUL_CUTOFF) &&
        ((max_len / 2) >= AMPLIFY_MP_KARATSUBA_MUL_CUTOFF) &&
-       /* Not much effect was observed below a ratio of 1:2, but again: YMMV. */
+       /* Below a ratio of 1:3 the unbalanced Toom-Cook variants above are cheaper. */
        (max_len >= (2 * min_len))) {
       err = s_amplify_mp_balance_mul(a,b,c);
+   } else if (AMPLIFY_MP_HAS(S_MP_TOOM4_MUL) &&
+              (min_len >= AMPLIFY_MP_TOOM4_MUL_CUTOFF)) {
+      err = amplify_s_mp_toom4_mul(a, b, c);
    } else if (AMPLIFY_MP_HAS(S_MP_TOOM_MUL) &&
               (min_len >= AMPLIFY_MP_TOOM_MUL_CUTOFF)) {
       err = amplify_s_mp_toom_mul(a, b, c);
@@ -50,4 +74,9 @@ amplify_mp_err amplify_mp_mul(const amplify_mp_int *a, const amplify_mp_int *b,
    c->sign = (c->used > 0) ? neg : AMPLIFY_MP_ZPOS;
    return err;
 }
+
+amplify_mp_err amplify_mp_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_MUL, a->used + b->used, s_mp_mul(a, b, c));
+}
 #endif
@@ -10,11 +10,11 @@
 amplify_mp_err amplify_mp_pack(void *rop, size_t maxcount, size_t *written, amplify_mp_order order, size_t size,
                amplify_mp_endian endian, size_t nails, const amplify_mp_int *op)
 {
-   amplify_mp_err err;
-   size_t odd_nails, nail_bytes, i, j, count;
-   unsigned char odd_nail_mask;
+   size_t count;
 
-   amplify_mp_int t;
+   if (nails >= (size * 8u)) {
+      return AMPLIFY_MP_VAL;
+   }
 
    count = amplify_mp_pack_count(op, nails, size);
 
@@ -22,49 +22,17 @@ amplify_mp_err amplify_mp_pack(void *rop, size_t maxcount, size_t *written, ampl
       return AMPLIFY_MP_BUF;
    }
 
-   if ((err = amplify_mp_init_copy(&t, op)) != AMPLIFY_MP_OKAY) {
-      return err;
-   }
-
    if (endian == AMPLIFY_MP_NATIVE_ENDIAN) {
       AMPLIFY_MP_GET_ENDIANNESS(endian);
    }
 
-   odd_nails = (nails % 8u);
-   odd_nail_mask = 0xff;
-   for (i = 0u; i < odd_nails; ++i) {
-      odd_nail_mask ^= (unsigned char)(1u << (7u - i));
-   }
-   nail_bytes = nails / 8u;
-
-   for (i = 0u; i < count; ++i) {
-      for (j = 0u; j < size; ++j) {
-         unsigned char *byte = (unsigned char *)rop +
-                               (((order == AMPLIFY_MP_LSB_FIRST) ? i : ((count - 1u) - i)) * size) +
-                               ((endian == AMPLIFY_MP_LITTLE_ENDIAN) ? j : ((size - 1u) - j));
-
-         if (j >= (size - nail_bytes)) {
-            *byte = 0;
-            continue;
-         }
-
-         *byte = (unsigned char)((j == ((size - nail_bytes) - 1u)) ? (t.dp[0] & odd_nail_mask) : (t.dp[0] & 0xFFuL));
-
-         if ((err = amplify_mp_div_2d(&t, (j == ((size - nail_bytes) - 1u)) ? (int)(8u - odd_nails) : 8, &t, NULL)) != AMPLIFY_MP_OKAY) {
-            goto LBL_ERR;
-         }
-
-      }
-   }
+   amplify_s_mp_to_bin(op, (unsigned char *)rop, count, order, size, endian, nails);
 
    if (written != NULL) {
       *written = count;
    }
-   err = AMPLIFY_MP_OKAY;
 
-LBL_ERR:
-   amplify_mp_clear(&t);
-   return err;
+   return AMPLIFY_MP_OKAY;
 }
 
 #endif
@@ -17,6 +17,7 @@ static unsigned int s_floor_ilog2(int value)
 
 amplify_mp_err amplify_mp_prime_is_prime(const amplify_mp_int *a, int t, amplify_mp_bool *result)
 {
+   amplify_s_mp_mont_ctx ctx;
    amplify_mp_int  b;
    int     ix, p_max = 0, size_a, len;
    amplify_mp_bool res;
@@ -75,14 +76,20 @@ amplify_mp_err amplify_mp_prime_is_prime(const amplify_mp_int *a, int t, amplify
       return AMPLIFY_MP_OKAY;
    }
 
+   /* one Montgomery context serves every test below */
+   if ((err = amplify_s_mp_mont_init(&ctx, a)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
    /*
        Run the Miller-Rabin test with base 2 for the BPSW test.
     */
    if ((err = amplify_mp_init_set(&b, 2uL)) != AMPLIFY_MP_OKAY) {
+      amplify_s_mp_mont_clear(&ctx);
       return err;
    }
 
-   if ((err = amplify_mp_prime_miller_rabin(a, &b, &res)) != AMPLIFY_MP_OKAY) {
+   if ((err = amplify_s_mp_prime_miller_rabin(&ctx, &b, &res)) != AMPLIFY_MP_OKAY) {
       goto LBL_B;
    }
    if (res == AMPLIFY_MP_NO) {
@@ -94,7 +101,7 @@ amplify_mp_err amplify_mp_prime_is_prime(const amplify_mp_int *a, int t, amplify
       It does not hurt, though, beside a bit of extra runtime.
    */
    b.dp[0]++;
-   if ((err = amplify_mp_prime_miller_rabin(a, &b, &res)) != AMPLIFY_MP_OKAY) {
+   if ((err = amplify_s_mp_prime_miller_rabin(&ctx, &b, &res)) != AMPLIFY_MP_OKAY) {
       goto LBL_B;
    }
    if (res == AMPLIFY_MP_NO) {
@@ -122,7 +129,7 @@ amplify_mp_err amplify_mp_prime_is_prime(const amplify_mp_int *a, int t, amplify
          goto LBL_B;
       }
 #else
-      if ((err = amplify_mp_prime_strong_lucas_selfridge(a, &res)) != AMPLIFY_MP_OKAY) {
+      if ((err = amplify_s_mp_prime_strong_lucas_selfridge(&ctx, &res)) != AMPLIFY_MP_OKAY) {
          goto LBL_B;
       }
       if (res == AMPLIFY_MP_NO) {
@@ -174,7 +181,7 @@ amplify_mp_err amplify_mp_prime_is_prime(const amplify_mp_int *a, int t, amplify
       /* we did bases 2 and 3  already, skip them */
       for (ix = 2; ix < p_max; ix++) {
          amplify_mp_set(&b, amplify_s_mp_prime_tab[ix]);
-         if ((err = amplify_mp_prime_miller_rabin(a, &b, &res)) != AMPLIFY_MP_OKAY) {
+         if ((err = amplify_s_mp_prime_miller_rabin(&ctx, &b, &res)) != AMPLIFY_MP_OKAY) {
             goto LBL_B;
          }
          if (res == AMPLIFY_MP_NO) {
@@ -296,7 +303,7 @@ amplify_mp_err amplify_mp_prime_is_prime(const amplify_mp_int *a, int t, amplify
             ix--;
             continue;
          }
-         if ((err = amplify_mp_prime_miller_rabin(a, &b, &res)) != AMPLIFY_MP_OKAY) {
+         if ((err = amplify_s_mp_prime_miller_rabin(&ctx, &b, &res)) != AMPLIFY_MP_OKAY) {
             goto LBL_B;
          }
          if (res == AMPLIFY_MP_NO) {
@@ -309,6 +316,7 @@ amplify_mp_err amplify_mp_prime_is_prime(const amplify_mp_int *a, int t, amplify
    *result = AMPLIFY_MP_YES;
 LBL_B:
    amplify_mp_clear(&b);
+   amplify_s_mp_mont_clear(&ctx);
    return err;
 }
 
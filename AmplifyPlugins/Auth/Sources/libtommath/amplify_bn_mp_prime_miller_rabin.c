@@ -11,20 +11,14 @@
  * Randomly the chance of error is no more than 1/4 and often
  * very much lower.
  */
-amplify_mp_err amplify_mp_prime_miller_rabin(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_bool *result)
+
+/* even or tiny moduli, which have no Montgomery context */
+static amplify_mp_err s_miller_rabin_generic(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_bool *result)
 {
    amplify_mp_int  n1, y, r;
    amplify_mp_err  err;
    int     s, j;
 
-   /* default */
-   *result = AMPLIFY_MP_NO;
-
-   /* ensure b > 1 */
-   if (amplify_mp_cmp_d(b, 1uL) != AMPLIFY_MP_GT) {
-      return AMPLIFY_MP_VAL;
-   }
-
    /* get n1 = a - 1 */
    if ((err = amplify_mp_init_copy(&n1, a)) != AMPLIFY_MP_OKAY) {
       return err;
@@ -89,4 +83,84 @@ LBL_N1:
    amplify_mp_clear(&n1);
    return err;
 }
+
+/* the same test of ctx->n, the exponentiation and the squaring chain stay
+ * in the Montgomery domain of ctx
+ */
+amplify_mp_err amplify_s_mp_prime_miller_rabin(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *b, amplify_mp_bool *result)
+{
+   amplify_mp_int  r, y;
+   amplify_mp_err  err;
+   int     s, j;
+
+   *result = AMPLIFY_MP_NO;
+
+   if ((err = amplify_mp_init_multi(&r, &y, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /* set 2**s * r = n - 1 */
+   if ((err = amplify_mp_sub_d(ctx->n, 1uL, &r)) != AMPLIFY_MP_OKAY)           goto LBL_ERR;
+   s = amplify_mp_cnt_lsb(&r);
+   if ((err = amplify_mp_div_2d(&r, s, &r, NULL)) != AMPLIFY_MP_OKAY)          goto LBL_ERR;
+
+   /* y = b*R mod n, bases beyond n are the only ones that need a division */
+   if (amplify_mp_cmp_mag(b, ctx->n) != AMPLIFY_MP_LT) {
+      if ((err = amplify_mp_mod(b, ctx->n, &y)) != AMPLIFY_MP_OKAY)            goto LBL_ERR;
+      if ((err = amplify_s_mp_mont_to(ctx, &y, &y)) != AMPLIFY_MP_OKAY)        goto LBL_ERR;
+   } else {
+      if ((err = amplify_s_mp_mont_to(ctx, b, &y)) != AMPLIFY_MP_OKAY)         goto LBL_ERR;
+   }
+
+   /* y = b**r */
+   if ((err = amplify_s_mp_mont_exptmod(ctx, &y, &r, &y)) != AMPLIFY_MP_OKAY)  goto LBL_ERR;
+
+   /* if y != 1 and y != n-1 square until it is n-1 */
+   if ((amplify_mp_cmp(&y, &ctx->one) != AMPLIFY_MP_EQ) && (amplify_mp_cmp(&y, &ctx->minus_one) != AMPLIFY_MP_EQ)) {
+      for (j = 1; j < s; j++) {
+         if ((err = amplify_s_mp_mont_sqr(ctx, &y, &y)) != AMPLIFY_MP_OKAY)   goto LBL_ERR;
+         if (amplify_mp_cmp(&y, &ctx->minus_one) == AMPLIFY_MP_EQ) {
+            break;
+         }
+         /* if y == 1 then composite */
+         if (amplify_mp_cmp(&y, &ctx->one) == AMPLIFY_MP_EQ) {
+            goto LBL_ERR;
+         }
+      }
+      if (j >= s) {
+         goto LBL_ERR;
+      }
+   }
+
+   /* probably prime now */
+   *result = AMPLIFY_MP_YES;
+LBL_ERR:
+   amplify_mp_clear_multi(&r, &y, NULL);
+   return err;
+}
+
+amplify_mp_err amplify_mp_prime_miller_rabin(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_bool *result)
+{
+   amplify_s_mp_mont_ctx ctx;
+   amplify_mp_err err;
+
+   /* default */
+   *result = AMPLIFY_MP_NO;
+
+   /* ensure b > 1 */
+   if (amplify_mp_cmp_d(b, 1uL) != AMPLIFY_MP_GT) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   if (AMPLIFY_MP_IS_EVEN(a) || (amplify_mp_cmp_d(a, 1uL) != AMPLIFY_MP_GT)) {
+      return s_miller_rabin_generic(a, b, result);
+   }
+
+   if ((err = amplify_s_mp_mont_init(&ctx, a)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   err = amplify_s_mp_prime_miller_rabin(&ctx, b, result);
+   amplify_s_mp_mont_clear(&ctx);
+   return err;
+}
 #endif
@@ -7,15 +7,19 @@
 /* finds the next prime after the number "a" using "t" trials
  * of Miller-Rabin.
  *
+ * Candidates are sieved a window at a time, see amplify_s_mp_prime_sieve,
+ * and only the survivors are handed to amplify_mp_prime_is_prime.
+ *
  * bbs_style = 1 means the prime must be congruent to 3 mod 4
  */
 amplify_mp_err amplify_mp_prime_next_prime(amplify_mp_int *a, int t, int bbs_style)
 {
-   int      x, y;
+   int      x, window;
    amplify_mp_ord   cmp;
    amplify_mp_err   err;
-   amplify_mp_bool  res = AMPLIFY_MP_NO;
-   amplify_mp_digit res_tab[PRIVATE_MP_PRIME_TAB_SIZE], step, kstep;
+   amplify_mp_bool  res = AMPLIFY_MP_NO, fresh;
+   amplify_mp_digit res_tab[PRIVATE_MP_PRIME_TAB_SIZE], kstep;
+   unsigned char    composite[AMPLIFY_MP_PRIME_SIEVE_WINDOW / 8];
    amplify_mp_int   b;
 
    /* force positive */
@@ -67,11 +71,9 @@ amplify_mp_err amplify_mp_prime_next_prime(amplify_mp_int *a, int t, int bbs_sty
       }
    }
 
-   /* generate the restable */
-   for (x = 1; x < PRIVATE_MP_PRIME_TAB_SIZE; x++) {
-      if ((err = amplify_mp_mod_d(a, amplify_s_mp_prime_tab[x], res_tab + x)) != AMPLIFY_MP_OKAY) {
-         return err;
-      }
+   /* the first candidate */
+   if ((err = amplify_amplify_mp_add_d(a, kstep, a)) != AMPLIFY_MP_OKAY) {
+      return err;
    }
 
    /* init temp used for Miller-Rabin Testing */
@@ -79,51 +81,46 @@ amplify_mp_err amplify_mp_prime_next_prime(amplify_mp_int *a, int t, int bbs_sty
       return err;
    }
 
+   fresh = AMPLIFY_MP_YES;
    for (;;) {
-      /* skip to the next non-trivially divisible candidate */
-      step = 0;
-      do {
-         /* y == 1 if any residue was zero [e.g. cannot be prime] */
-         y     =  0;
-
-         /* increase step to next candidate */
-         step += kstep;
-
-         /* compute the new residue without using division */
-         for (x = 1; x < PRIVATE_MP_PRIME_TAB_SIZE; x++) {
-            /* add the step to each residue */
-            res_tab[x] += kstep;
-
-            /* subtract the modulus [instead of using division] */
-            if (res_tab[x] >= amplify_s_mp_prime_tab[x]) {
-               res_tab[x]  -= amplify_s_mp_prime_tab[x];
-            }
-
-            /* set flag if zero */
-            if (res_tab[x] == 0u) {
-               y = 1;
-            }
+      /* sieve a window of candidates a + x*kstep; close to the table primes
+       * test candidates one by one instead
+       */
+      if (amplify_mp_cmp_d(a, (amplify_s_mp_prime_tab[PRIVATE_MP_PRIME_TAB_SIZE-1] * 2u) + 1u) == AMPLIFY_MP_GT) {
+         if ((err = amplify_s_mp_prime_sieve((fresh == AMPLIFY_MP_YES) ? a : NULL, res_tab, kstep, AMPLIFY_MP_NO,
+                                             composite)) != AMPLIFY_MP_OKAY) {
+            goto LBL_ERR;
          }
-      } while ((y == 1) && (step < (((amplify_mp_digit)1 << AMPLIFY_MP_DIGIT_BIT) - kstep)));
-
-      /* add the step */
-      if ((err = amplify_amplify_mp_add_d(a, step, a)) != AMPLIFY_MP_OKAY) {
-         goto LBL_ERR;
+         fresh  = AMPLIFY_MP_NO;
+         window = AMPLIFY_MP_PRIME_SIEVE_WINDOW;
+      } else {
+         composite[0] = 0u;
+         window = 1;
       }
 
-      /* if didn't pass sieve and step == AMPLIFY_MP_MAX then skip test */
-      if ((y == 1) && (step >= (((amplify_mp_digit)1 << AMPLIFY_MP_DIGIT_BIT) - kstep))) {
-         continue;
+      for (x = 0; x < window; x++) {
+         if ((composite[x >> 3] & (1u << (x & 7))) != 0u) {
+            continue;
+         }
+         if ((err = amplify_amplify_mp_add_d(a, (amplify_mp_digit)x * kstep, &b)) != AMPLIFY_MP_OKAY) {
+            goto LBL_ERR;
+         }
+         if ((err = amplify_mp_prime_is_prime(&b, t, &res)) != AMPLIFY_MP_OKAY) {
+            goto LBL_ERR;
+         }
+         if (res == AMPLIFY_MP_YES) {
+            amplify_mp_exch(a, &b);
+            goto LBL_DONE;
+         }
       }
 
-      if ((err = amplify_mp_prime_is_prime(a, t, &res)) != AMPLIFY_MP_OKAY) {
+      /* on to the next window */
+      if ((err = amplify_amplify_mp_add_d(a, (amplify_mp_digit)window * kstep, a)) != AMPLIFY_MP_OKAY) {
          goto LBL_ERR;
       }
-      if (res == AMPLIFY_MP_YES) {
-         break;
-      }
    }
 
+LBL_DONE:
    err = AMPLIFY_MP_OKAY;
 LBL_ERR:
    amplify_mp_clear(&b);
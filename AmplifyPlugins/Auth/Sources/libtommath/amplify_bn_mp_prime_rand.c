@@ -16,15 +16,23 @@
  * have passed to the callback (e.g. a state or something).  This function doesn't use "dat" itself
  * so it can be NULL
  *
+ * The random number only picks the start of a window of candidates which is
+ * sieved in one go, the first survivor that passes is returned.  With
+ * AMPLIFY_MP_PRIME_SAFE the sieve rejects candidates p for which either p or
+ * (p-1)/2 has a small factor.
+ *
  */
 
 /* This is possibly the mother of all prime generation functions, muahahahahaha! */
 amplify_mp_err amplify_s_mp_prime_random_ex(amplify_mp_int *a, int t, int size, int flags, private_amplify_mp_prime_callback cb, void *dat)
 {
-   unsigned char *tmp, maskAND, maskOR_msb, maskOR_lsb;
-   int bsize, maskOR_msb_offset;
-   amplify_mp_bool res;
+   unsigned char *tmp;
+   unsigned char composite[AMPLIFY_MP_PRIME_SIEVE_WINDOW / 8];
+   amplify_mp_digit res_tab[PRIVATE_MP_PRIME_TAB_SIZE], step;
+   int bsize, ix, window;
+   amplify_mp_bool res, safe;
    amplify_mp_err err;
+   amplify_mp_int b;
 
    /* sanity check the input */
    if ((size <= 1) || (t <= 0)) {
@@ -45,79 +53,55 @@ amplify_mp_err amplify_s_mp_prime_random_ex(amplify_mp_int *a, int t, int size,
       return AMPLIFY_MP_MEM;
    }
 
-   /* calc the maskAND value for the MSbyte*/
-   maskAND = ((size&7) == 0) ? 0xFFu : (unsigned char)(0xFFu >> (8 - (size & 7)));
-
-   /* calc the maskOR_msb */
-   maskOR_msb        = 0;
-   maskOR_msb_offset = ((size & 7) == 1) ? 1 : 0;
-   if ((flags & AMPLIFY_MP_PRIME_2MSB_ON) != 0) {
-      maskOR_msb       |= (unsigned char)(0x80 >> ((9 - size) & 7));
-   }
+   step = ((flags & AMPLIFY_MP_PRIME_BBS) != 0) ? 4u : 2u;
+   safe = ((flags & AMPLIFY_MP_PRIME_SAFE) != 0) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
 
-   /* get the maskOR_lsb */
-   maskOR_lsb         = 1u;
-   if ((flags & AMPLIFY_MP_PRIME_BBS) != 0) {
-      maskOR_lsb     |= 3u;
+   if ((err = amplify_mp_init(&b)) != AMPLIFY_MP_OKAY) {
+      AMPLIFY_MP_FREE_BUFFER(tmp, (size_t)bsize);
+      return err;
    }
 
+   res = AMPLIFY_MP_NO;
    do {
-      /* read the bytes */
-      if (cb(tmp, bsize, dat) != bsize) {
-         err = AMPLIFY_MP_VAL;
+      if ((err = amplify_s_mp_prime_start(a, tmp, size, flags, cb, dat)) != AMPLIFY_MP_OKAY) {
          goto error;
       }
 
-      /* work over the MSbyte */
-      tmp[0]    &= maskAND;
-      tmp[0]    |= (unsigned char)(1 << ((size - 1) & 7));
-
-      /* mix in the maskORs */
-      tmp[maskOR_msb_offset]   |= maskOR_msb;
-      tmp[bsize-1]             |= maskOR_lsb;
-
-      /* read it in */
-      /* TODO: casting only for now until all lengths have been changed to the type "size_t"*/
-      if ((err = amplify_mp_from_ubin(a, tmp, (size_t)bsize)) != AMPLIFY_MP_OKAY) {
-         goto error;
-      }
-
-      /* is it prime? */
-      if ((err = amplify_mp_prime_is_prime(a, t, &res)) != AMPLIFY_MP_OKAY) {
-         goto error;
-      }
-      if (res == AMPLIFY_MP_NO) {
-         continue;
+      /* sieve the window starting at the random number, tiny sizes are
+       * tested one candidate per draw
+       */
+      if (amplify_mp_cmp_d(a, (amplify_s_mp_prime_tab[PRIVATE_MP_PRIME_TAB_SIZE-1] * 2u) + 1u) == AMPLIFY_MP_GT) {
+         if ((err = amplify_s_mp_prime_sieve(a, res_tab, step, safe, composite)) != AMPLIFY_MP_OKAY) {
+            goto error;
+         }
+         window = AMPLIFY_MP_PRIME_SIEVE_WINDOW;
+      } else {
+         composite[0] = 0u;
+         window = 1;
       }
 
-      if ((flags & AMPLIFY_MP_PRIME_SAFE) != 0) {
-         /* see if (a-1)/2 is prime */
-         if ((err = amplify_mp_sub_d(a, 1uL, a)) != AMPLIFY_MP_OKAY) {
-            goto error;
+      for (ix = 0; (ix < window) && (res == AMPLIFY_MP_NO); ix++) {
+         if ((composite[ix >> 3] & (1u << (ix & 7))) != 0u) {
+            continue;
          }
-         if ((err = amplify_mp_div_2(a, a)) != AMPLIFY_MP_OKAY) {
+         if ((err = amplify_amplify_mp_add_d(a, (amplify_mp_digit)ix * step, &b)) != AMPLIFY_MP_OKAY) {
             goto error;
          }
-
-         /* is it prime? */
-         if ((err = amplify_mp_prime_is_prime(a, t, &res)) != AMPLIFY_MP_OKAY) {
+         /* the window must not leave the requested size */
+         if (amplify_mp_count_bits(&b) != size) {
+            break;
+         }
+         if ((err = amplify_s_mp_prime_is_candidate(&b, t, safe, NULL, NULL, &res)) != AMPLIFY_MP_OKAY) {
             goto error;
          }
       }
    } while (res == AMPLIFY_MP_NO);
 
-   if ((flags & AMPLIFY_MP_PRIME_SAFE) != 0) {
-      /* restore a to the original value */
-      if ((err = amplify_mp_mul_2(a, a)) != AMPLIFY_MP_OKAY) {
-         goto error;
-      }
-      if ((err = amplify_amplify_mp_add_d(a, 1uL, a)) != AMPLIFY_MP_OKAY) {
-         goto error;
-      }
-   }
+   amplify_mp_exch(a, &b);
 
    err = AMPLIFY_MP_OKAY;
 error:
+   amplify_mp_clear(&b);
    AMPLIFY_MP_FREE_BUFFER(tmp, (size_t)bsize);
    return err;
 }
@@ -0,0 +1,239 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_PRIME_RAND_PARALLEL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* amplify_mp_prime_rand on "threads" threads, the calling one included.
+ *
+ * The workers share one sieved window and take its surviving candidates one
+ * at a time; whichever worker runs past the end of the window draws and sieves
+ * the next one. The first confirmed prime wins, the others notice between test
+ * stages and give up on their candidate.
+ *
+ * Candidate draws and sieving happen under the lock, the tests themselves run
+ * concurrently and must be able to use the installed random source from
+ * several threads (the platform and ChaCha20 sources can).
+ */
+
+#ifndef AMPLIFY_MP_PRIME_MAX_THREADS
+#  define AMPLIFY_MP_PRIME_MAX_THREADS 64
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+
+typedef struct {
+   pthread_mutex_t lock;
+
+   /* the window being handed out */
+   amplify_mp_int base;
+   amplify_mp_digit res_tab[PRIVATE_MP_PRIME_TAB_SIZE];
+   unsigned char composite[AMPLIFY_MP_PRIME_SIEVE_WINDOW / 8];
+   unsigned char *tmp;
+   int ix, window;
+
+   int t, size, flags;
+   amplify_mp_digit step;
+   amplify_mp_bool safe;
+
+   /* set once by the first worker to finish */
+   amplify_mp_bool done;
+   amplify_mp_err err;
+   amplify_mp_int *result;
+} s_search;
+
+static int s_rand_cb(unsigned char *dst, int len, void *dat)
+{
+   (void)dat;
+   if (len <= 0) {
+      return len;
+   }
+   if (amplify_s_mp_rand_source(dst, (size_t)len) != AMPLIFY_MP_OKAY) {
+      return 0;
+   }
+   return len;
+}
+
+/* asked by amplify_s_mp_prime_is_candidate between its stages */
+static amplify_mp_bool s_cancelled(void *dat)
+{
+   s_search *s = (s_search *)dat;
+   amplify_mp_bool done;
+   (void)pthread_mutex_lock(&s->lock);
+   done = s->done;
+   (void)pthread_mutex_unlock(&s->lock);
+   return done;
+}
+
+/* records the outcome unless another worker got there first, "p" is taken */
+static void s_finish(s_search *s, amplify_mp_err err, amplify_mp_int *p)
+{
+   (void)pthread_mutex_lock(&s->lock);
+   if (s->done == AMPLIFY_MP_NO) {
+      s->done = AMPLIFY_MP_YES;
+      s->err = err;
+      if (p != NULL) {
+         amplify_mp_exch(s->result, p);
+      }
+   }
+   (void)pthread_mutex_unlock(&s->lock);
+}
+
+/* stores the next candidate in b, *have is NO once the search is over.
+ * Called with the lock held.
+ */
+static amplify_mp_err s_next(s_search *s, amplify_mp_int *b, amplify_mp_bool *have)
+{
+   amplify_mp_err err;
+   int ix;
+
+   *have = AMPLIFY_MP_NO;
+   while (s->done == AMPLIFY_MP_NO) {
+      if (s->ix >= s->window) {
+         if ((err = amplify_s_mp_prime_start(&s->base, s->tmp, s->size, s->flags, s_rand_cb, NULL)) != AMPLIFY_MP_OKAY) {
+            return err;
+         }
+         if (amplify_mp_cmp_d(&s->base, (amplify_s_mp_prime_tab[PRIVATE_MP_PRIME_TAB_SIZE-1] * 2u) + 1u) == AMPLIFY_MP_GT) {
+            if ((err = amplify_s_mp_prime_sieve(&s->base, s->res_tab, s->step, s->safe, s->composite)) != AMPLIFY_MP_OKAY) {
+               return err;
+            }
+            s->window = AMPLIFY_MP_PRIME_SIEVE_WINDOW;
+         } else {
+            s->composite[0] = 0u;
+            s->window = 1;
+         }
+         s->ix = 0;
+      }
+
+      ix = s->ix++;
+      if ((s->composite[ix >> 3] & (1u << (ix & 7))) != 0u) {
+         continue;
+      }
+      if ((err = amplify_amplify_mp_add_d(&s->base, (amplify_mp_digit)ix * s->step, b)) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+      /* the window must not leave the requested size */
+      if (amplify_mp_count_bits(b) != s->size) {
+         s->ix = s->window;
+         continue;
+      }
+      *have = AMPLIFY_MP_YES;
+      break;
+   }
+   return AMPLIFY_MP_OKAY;
+}
+
+static void *s_worker(void *arg)
+{
+   s_search *s = (s_search *)arg;
+   amplify_mp_bool have, res;
+   amplify_mp_err err;
+   amplify_mp_int b;
+
+   if ((err = amplify_mp_init(&b)) != AMPLIFY_MP_OKAY) {
+      s_finish(s, err, NULL);
+      return NULL;
+   }
+
+   for (;;) {
+      (void)pthread_mutex_lock(&s->lock);
+      err = s_next(s, &b, &have);
+      (void)pthread_mutex_unlock(&s->lock);
+      if ((err != AMPLIFY_MP_OKAY) || (have == AMPLIFY_MP_NO)) {
+         break;
+      }
+      if ((err = amplify_s_mp_prime_is_candidate(&b, s->t, s->safe, s_cancelled, s, &res)) != AMPLIFY_MP_OKAY) {
+         break;
+      }
+      if (res == AMPLIFY_MP_YES) {
+         s_finish(s, AMPLIFY_MP_OKAY, &b);
+         break;
+      }
+   }
+   if (err != AMPLIFY_MP_OKAY) {
+      s_finish(s, err, NULL);
+   }
+
+   amplify_mp_clear(&b);
+   return NULL;
+}
+
+amplify_mp_err amplify_mp_prime_rand_parallel(amplify_mp_int *a, int t, int size, int flags, int threads)
+{
+   pthread_t tid[AMPLIFY_MP_PRIME_MAX_THREADS - 1];
+   s_search s;
+   amplify_mp_err err;
+   int bsize, n, i;
+
+   if (threads <= 1) {
+      return amplify_mp_prime_rand(a, t, size, flags);
+   }
+
+   /* sanity check the input */
+   if ((size <= 1) || (t <= 0)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   /* AMPLIFY_MP_PRIME_SAFE implies AMPLIFY_MP_PRIME_BBS */
+   if ((flags & AMPLIFY_MP_PRIME_SAFE) != 0) {
+      flags |= AMPLIFY_MP_PRIME_BBS;
+   }
+
+   threads = AMPLIFY_MP_MIN(threads, AMPLIFY_MP_PRIME_MAX_THREADS);
+   bsize = (size>>3) + ((size&7)?1:0);
+
+   s.tmp = (unsigned char *) AMPLIFY_MP_MALLOC((size_t)bsize);
+   if (s.tmp == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   if ((err = amplify_mp_init(&s.base)) != AMPLIFY_MP_OKAY) {
+      AMPLIFY_MP_FREE_BUFFER(s.tmp, (size_t)bsize);
+      return err;
+   }
+   if (pthread_mutex_init(&s.lock, NULL) != 0) {
+      amplify_mp_clear(&s.base);
+      AMPLIFY_MP_FREE_BUFFER(s.tmp, (size_t)bsize);
+      return AMPLIFY_MP_ERR;
+   }
+
+   s.ix = s.window = 0;
+   s.t = t;
+   s.size = size;
+   s.flags = flags;
+   s.step = ((flags & AMPLIFY_MP_PRIME_BBS) != 0) ? 4u : 2u;
+   s.safe = ((flags & AMPLIFY_MP_PRIME_SAFE) != 0) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
+   s.done = AMPLIFY_MP_NO;
+   s.err = AMPLIFY_MP_ERR;
+   s.result = a;
+
+   /* fewer threads than asked for is fine, the caller always works along */
+   for (n = 0; n < (threads - 1); ++n) {
+      if (pthread_create(&tid[n], NULL, s_worker, &s) != 0) {
+         break;
+      }
+   }
+   (void)s_worker(&s);
+   for (i = 0; i < n; ++i) {
+      (void)pthread_join(tid[i], NULL);
+   }
+   err = s.err;
+
+   (void)pthread_mutex_destroy(&s.lock);
+   amplify_mp_clear(&s.base);
+   AMPLIFY_MP_FREE_BUFFER(s.tmp, (size_t)bsize);
+   return err;
+}
+
+#else
+
+/* no threads, search serially */
+amplify_mp_err amplify_mp_prime_rand_parallel(amplify_mp_int *a, int t, int size, int flags, int threads)
+{
+   (void)threads;
+   return amplify_mp_prime_rand(a, t, size, flags);
+}
+
+#endif
+
+#endif
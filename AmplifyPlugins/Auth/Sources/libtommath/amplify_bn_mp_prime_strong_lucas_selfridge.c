@@ -16,28 +16,55 @@
  */
 #ifndef AMPLIFY_MP_8BIT
 
-/*
- * multiply bigint a with int d and put the result in c
- * Like amplify_mp_mul_d() but with a signed long as the small input
- */
-static amplify_mp_err amplify_s_mp_mul_si(const amplify_mp_int *a, int32_t d, amplify_mp_int *c)
+/* c = a + b mod n for a, b in [0, n) */
+static amplify_mp_err s_addmod(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
 {
-   amplify_mp_int t;
    amplify_mp_err err;
+   if ((err = amplify_mp_add(a, b, c)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if (amplify_mp_cmp(c, ctx->n) != AMPLIFY_MP_LT) {
+      return amplify_mp_sub(c, ctx->n, c);
+   }
+   return AMPLIFY_MP_OKAY;
+}
 
-   if ((err = amplify_mp_init(&t)) != AMPLIFY_MP_OKAY) {
+/* c = a - b mod n for a, b in [0, n) */
+static amplify_mp_err s_submod(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   amplify_mp_err err;
+   if ((err = amplify_mp_sub(a, b, c)) != AMPLIFY_MP_OKAY) {
       return err;
    }
+   if (c->sign == AMPLIFY_MP_NEG) {
+      return amplify_mp_add(c, ctx->n, c);
+   }
+   return AMPLIFY_MP_OKAY;
+}
 
-   /*
-    * amplify_mp_digit might be smaller than a long, which excludes
-    * the use of amplify_mp_mul_d() here.
-    */
-   amplify_mp_set_i32(&t, d);
-   err = amplify_mp_mul(a, &t, c);
-   amplify_mp_clear(&t);
-   return err;
+/* a = a/2 mod n for a in [0, n), n odd */
+static amplify_mp_err s_halfmod(const amplify_s_mp_mont_ctx *ctx, amplify_mp_int *a)
+{
+   amplify_mp_err err;
+   if (AMPLIFY_MP_IS_ODD(a)) {
+      if ((err = amplify_mp_add(a, ctx->n, a)) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+   }
+   return amplify_mp_div_2(a, a);
 }
+
+/* c = d*R mod n for a small signed d */
+static amplify_mp_err s_mont_set_i32(const amplify_s_mp_mont_ctx *ctx, int32_t d, amplify_mp_int *c)
+{
+   amplify_mp_err err;
+   amplify_mp_set_i32(c, d);
+   if ((err = amplify_mp_mod(c, ctx->n, c)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_s_mp_mont_to(ctx, c, c);
+}
+
 /*
     Strong Lucas-Selfridge test.
     returns AMPLIFY_MP_YES if it is a strong L-S prime, AMPLIFY_MP_NO if it is composite
@@ -54,15 +81,18 @@ static amplify_mp_err amplify_s_mp_mul_si(const amplify_mp_int *a, int32_t d, am
 
     (If that name sounds familiar, he is the guy who found the fdiv bug in the
      Pentium (P5x, I think) Intel processor)
+
+    The sequences are evaluated in the Montgomery domain of ctx, halving and
+    the small multipliers are linear and carry over unchanged.
 */
-amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a, amplify_mp_bool *result)
+amplify_mp_err amplify_s_mp_prime_strong_lucas_selfridge(const amplify_s_mp_mont_ctx *ctx, amplify_mp_bool *result)
 {
+   const amplify_mp_int *a = ctx->n;
    /* CZ TODO: choose better variable names! */
-   amplify_mp_int Dz, gcd, Np1, Uz, Vz, U2mz, V2mz, Qmz, Q2mz, Qkdz, T1z, T2z, T3z, T4z, Q2kdz;
+   amplify_mp_int Dz, gcd, Np1, Uz, Vz, U2mz, V2mz, Qmz, Q2mz, Qkdz, T1z, T2z, T3z, T4z, Q2kdz, Dmz;
    /* CZ TODO: Some of them need the full 32 bit, hence the (temporary) exclusion of AMPLIFY_MP_8BIT */
-   int32_t D, Ds, J, sign, P, Q, r, s, u, Nbits;
+   int32_t D, Ds, J, sign, Q, r, s, u, Nbits;
    amplify_mp_err err;
-   amplify_mp_bool oddness;
 
    *result = AMPLIFY_MP_NO;
    /*
@@ -74,7 +104,7 @@ amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a,
    */
 
    if ((err = amplify_mp_init_multi(&Dz, &gcd, &Np1, &Uz, &Vz, &U2mz, &V2mz, &Qmz, &Q2mz, &Qkdz, &T1z, &T2z, &T3z, &T4z, &Q2kdz,
-                            NULL)) != AMPLIFY_MP_OKAY) {
+                            &Dmz, NULL)) != AMPLIFY_MP_OKAY) {
       return err;
    }
 
@@ -111,7 +141,7 @@ amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a,
 
 
 
-   P = 1;              /* Selfridge's choice */
+   /* P = 1 is Selfridge's choice */
    Q = (1 - Ds) / 4;   /* Required so D = P*P - 4*Q */
 
    /* NOTE: The conditions (a) N does not divide Q, and
@@ -166,15 +196,17 @@ amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a,
       combined with the previous totals for U and V, using the
       composition formulas for addition of indices. */
 
-   amplify_mp_set(&Uz, 1uL);    /* U=U_1 */
-   amplify_mp_set(&Vz, (amplify_mp_digit)P);    /* V=V_1 */
-   amplify_mp_set(&U2mz, 1uL);  /* U_1 */
-   amplify_mp_set(&V2mz, (amplify_mp_digit)P);  /* V_1 */
+   /* U_1 = V_1 = P = 1 */
+   if ((err = amplify_mp_copy(&ctx->one, &Uz)) != AMPLIFY_MP_OKAY)               goto LBL_LS_ERR;   /* U=U_1 */
+   if ((err = amplify_mp_copy(&ctx->one, &Vz)) != AMPLIFY_MP_OKAY)               goto LBL_LS_ERR;   /* V=V_1 */
+   if ((err = amplify_mp_copy(&ctx->one, &U2mz)) != AMPLIFY_MP_OKAY)             goto LBL_LS_ERR;   /* U_1 */
+   if ((err = amplify_mp_copy(&ctx->one, &V2mz)) != AMPLIFY_MP_OKAY)             goto LBL_LS_ERR;   /* V_1 */
 
-   amplify_mp_set_i32(&Qmz, Q);
-   if ((err = amplify_mp_mul_2(&Qmz, &Q2mz)) != AMPLIFY_MP_OKAY)                  goto LBL_LS_ERR;
+   if ((err = s_mont_set_i32(ctx, Q, &Qmz)) != AMPLIFY_MP_OKAY)                  goto LBL_LS_ERR;
+   if ((err = s_addmod(ctx, &Qmz, &Qmz, &Q2mz)) != AMPLIFY_MP_OKAY)              goto LBL_LS_ERR;
    /* Initializes calculation of Q^d */
-   amplify_mp_set_i32(&Qkdz, Q);
+   if ((err = amplify_mp_copy(&Qmz, &Qkdz)) != AMPLIFY_MP_OKAY)                  goto LBL_LS_ERR;
+   if ((err = s_mont_set_i32(ctx, Ds, &Dmz)) != AMPLIFY_MP_OKAY)                 goto LBL_LS_ERR;
 
    Nbits = amplify_mp_count_bits(&Dz);
 
@@ -187,18 +219,13 @@ amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a,
        * V_2m = V_m*V_m - 2*Q^m
        */
 
-      if ((err = amplify_mp_mul(&U2mz, &V2mz, &U2mz)) != AMPLIFY_MP_OKAY)         goto LBL_LS_ERR;
-      if ((err = amplify_mp_mod(&U2mz, a, &U2mz)) != AMPLIFY_MP_OKAY)             goto LBL_LS_ERR;
-      if ((err = amplify_mp_sqr(&V2mz, &V2mz)) != AMPLIFY_MP_OKAY)                goto LBL_LS_ERR;
-      if ((err = amplify_mp_sub(&V2mz, &Q2mz, &V2mz)) != AMPLIFY_MP_OKAY)         goto LBL_LS_ERR;
-      if ((err = amplify_mp_mod(&V2mz, a, &V2mz)) != AMPLIFY_MP_OKAY)             goto LBL_LS_ERR;
+      if ((err = amplify_s_mp_mont_mul(ctx, &U2mz, &V2mz, &U2mz)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
+      if ((err = amplify_s_mp_mont_sqr(ctx, &V2mz, &V2mz)) != AMPLIFY_MP_OKAY)    goto LBL_LS_ERR;
+      if ((err = s_submod(ctx, &V2mz, &Q2mz, &V2mz)) != AMPLIFY_MP_OKAY)         goto LBL_LS_ERR;
 
       /* Must calculate powers of Q for use in V_2m, also for Q^d later */
-      if ((err = amplify_mp_sqr(&Qmz, &Qmz)) != AMPLIFY_MP_OKAY)                  goto LBL_LS_ERR;
-
-      /* prevents overflow */ /* CZ  still necessary without a fixed prealloc'd mem.? */
-      if ((err = amplify_mp_mod(&Qmz, a, &Qmz)) != AMPLIFY_MP_OKAY)               goto LBL_LS_ERR;
-      if ((err = amplify_mp_mul_2(&Qmz, &Q2mz)) != AMPLIFY_MP_OKAY)               goto LBL_LS_ERR;
+      if ((err = amplify_s_mp_mont_sqr(ctx, &Qmz, &Qmz)) != AMPLIFY_MP_OKAY)      goto LBL_LS_ERR;
+      if ((err = s_addmod(ctx, &Qmz, &Qmz, &Q2mz)) != AMPLIFY_MP_OKAY)           goto LBL_LS_ERR;
 
       if (amplify_s_mp_get_bit(&Dz, (unsigned int)u) == AMPLIFY_MP_YES) {
          /* Formulas for addition of indices (carried out mod N);
@@ -208,40 +235,18 @@ amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a,
           *
           * Be careful with division by 2 (mod N)!
           */
-         if ((err = amplify_mp_mul(&U2mz, &Vz, &T1z)) != AMPLIFY_MP_OKAY)         goto LBL_LS_ERR;
-         if ((err = amplify_mp_mul(&Uz, &V2mz, &T2z)) != AMPLIFY_MP_OKAY)         goto LBL_LS_ERR;
-         if ((err = amplify_mp_mul(&V2mz, &Vz, &T3z)) != AMPLIFY_MP_OKAY)         goto LBL_LS_ERR;
-         if ((err = amplify_mp_mul(&U2mz, &Uz, &T4z)) != AMPLIFY_MP_OKAY)         goto LBL_LS_ERR;
-         if ((err = amplify_s_mp_mul_si(&T4z, Ds, &T4z)) != AMPLIFY_MP_OKAY)      goto LBL_LS_ERR;
-         if ((err = amplify_mp_add(&T1z, &T2z, &Uz)) != AMPLIFY_MP_OKAY)          goto LBL_LS_ERR;
-         if (AMPLIFY_MP_IS_ODD(&Uz)) {
-            if ((err = amplify_mp_add(&Uz, a, &Uz)) != AMPLIFY_MP_OKAY)           goto LBL_LS_ERR;
-         }
-         /* CZ
-          * This should round towards negative infinity because
-          * Thomas R. Nicely used GMP's mpz_fdiv_q_2exp().
-          * But amplify_mp_div_2() does not do so, it is truncating instead.
-          */
-         oddness = AMPLIFY_MP_IS_ODD(&Uz) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
-         if ((err = amplify_mp_div_2(&Uz, &Uz)) != AMPLIFY_MP_OKAY)               goto LBL_LS_ERR;
-         if ((Uz.sign == AMPLIFY_MP_NEG) && (oddness != AMPLIFY_MP_NO)) {
-            if ((err = amplify_mp_sub_d(&Uz, 1uL, &Uz)) != AMPLIFY_MP_OKAY)       goto LBL_LS_ERR;
-         }
-         if ((err = amplify_mp_add(&T3z, &T4z, &Vz)) != AMPLIFY_MP_OKAY)          goto LBL_LS_ERR;
-         if (AMPLIFY_MP_IS_ODD(&Vz)) {
-            if ((err = amplify_mp_add(&Vz, a, &Vz)) != AMPLIFY_MP_OKAY)           goto LBL_LS_ERR;
-         }
-         oddness = AMPLIFY_MP_IS_ODD(&Vz) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
-         if ((err = amplify_mp_div_2(&Vz, &Vz)) != AMPLIFY_MP_OKAY)               goto LBL_LS_ERR;
-         if ((Vz.sign == AMPLIFY_MP_NEG) && (oddness != AMPLIFY_MP_NO)) {
-            if ((err = amplify_mp_sub_d(&Vz, 1uL, &Vz)) != AMPLIFY_MP_OKAY)       goto LBL_LS_ERR;
-         }
-         if ((err = amplify_mp_mod(&Uz, a, &Uz)) != AMPLIFY_MP_OKAY)              goto LBL_LS_ERR;
-         if ((err = amplify_mp_mod(&Vz, a, &Vz)) != AMPLIFY_MP_OKAY)              goto LBL_LS_ERR;
+         if ((err = amplify_s_mp_mont_mul(ctx, &U2mz, &Vz, &T1z)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
+         if ((err = amplify_s_mp_mont_mul(ctx, &Uz, &V2mz, &T2z)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
+         if ((err = amplify_s_mp_mont_mul(ctx, &V2mz, &Vz, &T3z)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
+         if ((err = amplify_s_mp_mont_mul(ctx, &U2mz, &Uz, &T4z)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
+         if ((err = amplify_s_mp_mont_mul(ctx, &T4z, &Dmz, &T4z)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
+         if ((err = s_addmod(ctx, &T1z, &T2z, &Uz)) != AMPLIFY_MP_OKAY)          goto LBL_LS_ERR;
+         if ((err = s_halfmod(ctx, &Uz)) != AMPLIFY_MP_OKAY)                     goto LBL_LS_ERR;
+         if ((err = s_addmod(ctx, &T3z, &T4z, &Vz)) != AMPLIFY_MP_OKAY)          goto LBL_LS_ERR;
+         if ((err = s_halfmod(ctx, &Vz)) != AMPLIFY_MP_OKAY)                     goto LBL_LS_ERR;
 
          /* Calculating Q^d for later use */
-         if ((err = amplify_mp_mul(&Qkdz, &Qmz, &Qkdz)) != AMPLIFY_MP_OKAY)       goto LBL_LS_ERR;
-         if ((err = amplify_mp_mod(&Qkdz, a, &Qkdz)) != AMPLIFY_MP_OKAY)          goto LBL_LS_ERR;
+         if ((err = amplify_s_mp_mont_mul(ctx, &Qkdz, &Qmz, &Qkdz)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
       }
    }
 
@@ -264,25 +269,42 @@ amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a,
       Lucas pseudoprime. */
 
    /* Initialize 2*Q^(d*2^r) for V_2m */
-   if ((err = amplify_mp_mul_2(&Qkdz, &Q2kdz)) != AMPLIFY_MP_OKAY)                goto LBL_LS_ERR;
+   if ((err = s_addmod(ctx, &Qkdz, &Qkdz, &Q2kdz)) != AMPLIFY_MP_OKAY)           goto LBL_LS_ERR;
 
    for (r = 1; r < s; r++) {
-      if ((err = amplify_mp_sqr(&Vz, &Vz)) != AMPLIFY_MP_OKAY)                    goto LBL_LS_ERR;
-      if ((err = amplify_mp_sub(&Vz, &Q2kdz, &Vz)) != AMPLIFY_MP_OKAY)            goto LBL_LS_ERR;
-      if ((err = amplify_mp_mod(&Vz, a, &Vz)) != AMPLIFY_MP_OKAY)                 goto LBL_LS_ERR;
+      if ((err = amplify_s_mp_mont_sqr(ctx, &Vz, &Vz)) != AMPLIFY_MP_OKAY)        goto LBL_LS_ERR;
+      if ((err = s_submod(ctx, &Vz, &Q2kdz, &Vz)) != AMPLIFY_MP_OKAY)            goto LBL_LS_ERR;
       if (AMPLIFY_MP_IS_ZERO(&Vz)) {
          *result = AMPLIFY_MP_YES;
          goto LBL_LS_ERR;
       }
       /* Calculate Q^{d*2^r} for next r (final iteration irrelevant). */
       if (r < (s - 1)) {
-         if ((err = amplify_mp_sqr(&Qkdz, &Qkdz)) != AMPLIFY_MP_OKAY)             goto LBL_LS_ERR;
-         if ((err = amplify_mp_mod(&Qkdz, a, &Qkdz)) != AMPLIFY_MP_OKAY)          goto LBL_LS_ERR;
-         if ((err = amplify_mp_mul_2(&Qkdz, &Q2kdz)) != AMPLIFY_MP_OKAY)          goto LBL_LS_ERR;
+         if ((err = amplify_s_mp_mont_sqr(ctx, &Qkdz, &Qkdz)) != AMPLIFY_MP_OKAY) goto LBL_LS_ERR;
+         if ((err = s_addmod(ctx, &Qkdz, &Qkdz, &Q2kdz)) != AMPLIFY_MP_OKAY)     goto LBL_LS_ERR;
       }
    }
 LBL_LS_ERR:
-   amplify_mp_clear_multi(&Q2kdz, &T4z, &T3z, &T2z, &T1z, &Qkdz, &Q2mz, &Qmz, &V2mz, &U2mz, &Vz, &Uz, &Np1, &gcd, &Dz, NULL);
+   amplify_mp_clear_multi(&Dmz, &Q2kdz, &T4z, &T3z, &T2z, &T1z, &Qkdz, &Q2mz, &Qmz, &V2mz, &U2mz, &Vz, &Uz, &Np1, &gcd, &Dz, NULL);
+   return err;
+}
+
+amplify_mp_err amplify_mp_prime_strong_lucas_selfridge(const amplify_mp_int *a, amplify_mp_bool *result)
+{
+   amplify_s_mp_mont_ctx ctx;
+   amplify_mp_err err;
+
+   /* even numbers and 1 have no Montgomery context, only 2 is prime */
+   if (AMPLIFY_MP_IS_EVEN(a) || (amplify_mp_cmp_d(a, 1uL) != AMPLIFY_MP_GT)) {
+      *result = (amplify_mp_cmp_d(a, 2uL) == AMPLIFY_MP_EQ) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
+      return AMPLIFY_MP_OKAY;
+   }
+
+   if ((err = amplify_s_mp_mont_init(&ctx, a)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   err = amplify_s_mp_prime_strong_lucas_selfridge(&ctx, result);
+   amplify_s_mp_mont_clear(&ctx);
    return err;
 }
 #endif
@@ -30,6 +30,12 @@ amplify_mp_err amplify_mp_radix_size(const amplify_mp_int *a, int radix, int *si
       return AMPLIFY_MP_OKAY;
    }
 
+   /* and for hex, the digits of amplify_mp_write_hex */
+   if (radix == 16) {
+      *size = (((amplify_mp_count_bits(a) + 3) / 4) + ((a->sign == AMPLIFY_MP_NEG) ? 1 : 0) + 1);
+      return AMPLIFY_MP_OKAY;
+   }
+
    /* digs is the digit count */
    digs = 0;
 
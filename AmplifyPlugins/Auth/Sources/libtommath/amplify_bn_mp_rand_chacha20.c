@@ -0,0 +1,194 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_RAND_CHACHA20_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* Buffered per-thread ChaCha20 generator.
+ *
+ * Every thread keeps a 256-bit key that is seeded from amplify_s_mp_rand_platform
+ * and reseeded after AMPLIFY_MP_CHACHA20_RESEED bytes of output, or after a fork.
+ * Keystream is produced AMPLIFY_MP_CHACHA20_BLOCKS blocks at a time; the first
+ * 32 bytes of every refill replace the key ("fast key erasure") and bytes
+ * handed out are wiped from the buffer, so a captured state does not reveal
+ * earlier output.
+ *
+ * Install it with amplify_mp_rand_source(amplify_mp_rand_chacha20).
+ */
+
+#ifndef AMPLIFY_MP_CHACHA20_BLOCKS
+#  define AMPLIFY_MP_CHACHA20_BLOCKS 16
+#endif
+#ifndef AMPLIFY_MP_CHACHA20_RESEED
+#  define AMPLIFY_MP_CHACHA20_RESEED (1u << 20)
+#endif
+
+#define AMPLIFY_MP_CHACHA20_BUF (64 * AMPLIFY_MP_CHACHA20_BLOCKS)
+
+#ifdef AMPLIFY_MP_THREAD_LOCAL
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+/* bumped in the child after fork(), forcing every thread state to reseed */
+static volatile unsigned s_fork_generation = 1u;
+static pthread_once_t s_atfork_once = PTHREAD_ONCE_INIT;
+static void s_atfork_child(void)
+{
+   s_fork_generation++;
+}
+static void s_atfork_register(void)
+{
+   (void)pthread_atfork(NULL, NULL, s_atfork_child);
+}
+#  define AMPLIFY_MP_CHACHA20_GENERATION() (pthread_once(&s_atfork_once, s_atfork_register), s_fork_generation)
+#else
+#  define AMPLIFY_MP_CHACHA20_GENERATION() 1u
+#endif
+
+typedef struct {
+   uint32_t key[8];
+   unsigned char buf[AMPLIFY_MP_CHACHA20_BUF];
+   size_t avail;
+   size_t since_reseed;
+   unsigned generation;
+} s_chacha20_state;
+
+static AMPLIFY_MP_THREAD_LOCAL s_chacha20_state s_state;
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define QR(a, b, c, d)                                   \
+   a += b; d ^= a; d = ROTL32(d, 16);                    \
+   c += d; b ^= c; b = ROTL32(b, 12);                    \
+   a += b; d ^= a; d = ROTL32(d, 8);                     \
+   c += d; b ^= c; b = ROTL32(b, 7)
+
+static uint32_t s_load32_le(const unsigned char *p)
+{
+   return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void s_chacha20_block(const uint32_t key[8], uint32_t counter, unsigned char out[64])
+{
+   static const uint32_t sigma[4] = { 0x61707865u, 0x3320646eu, 0x79622d32u, 0x6b206574u };
+   uint32_t in[16], x[16];
+   int i;
+
+   for (i = 0; i < 4; ++i) {
+      in[i] = sigma[i];
+   }
+   for (i = 0; i < 8; ++i) {
+      in[4 + i] = key[i];
+   }
+   in[12] = counter;
+   in[13] = 0u;
+   in[14] = 0u;
+   in[15] = 0u;
+
+   for (i = 0; i < 16; ++i) {
+      x[i] = in[i];
+   }
+   for (i = 0; i < 10; ++i) {
+      QR(x[0], x[4], x[8],  x[12]);
+      QR(x[1], x[5], x[9],  x[13]);
+      QR(x[2], x[6], x[10], x[14]);
+      QR(x[3], x[7], x[11], x[15]);
+      QR(x[0], x[5], x[10], x[15]);
+      QR(x[1], x[6], x[11], x[12]);
+      QR(x[2], x[7], x[8],  x[13]);
+      QR(x[3], x[4], x[9],  x[14]);
+   }
+   for (i = 0; i < 16; ++i) {
+      uint32_t v = x[i] + in[i];
+      out[(4 * i) + 0] = (unsigned char)v;
+      out[(4 * i) + 1] = (unsigned char)(v >> 8);
+      out[(4 * i) + 2] = (unsigned char)(v >> 16);
+      out[(4 * i) + 3] = (unsigned char)(v >> 24);
+   }
+
+   AMPLIFY_MP_ZERO_BUFFER(x, sizeof(x));
+   AMPLIFY_MP_ZERO_BUFFER(in, sizeof(in));
+}
+
+/* regenerate the buffer and take the next key from its head */
+static void s_chacha20_refill(s_chacha20_state *st)
+{
+   int i;
+   for (i = 0; i < AMPLIFY_MP_CHACHA20_BLOCKS; ++i) {
+      s_chacha20_block(st->key, (uint32_t)i, st->buf + (64 * i));
+   }
+   for (i = 0; i < 8; ++i) {
+      st->key[i] = s_load32_le(st->buf + (4 * i));
+   }
+   AMPLIFY_MP_ZERO_BUFFER(st->buf, 32u);
+   st->avail = AMPLIFY_MP_CHACHA20_BUF - 32u;
+}
+
+/* mix fresh platform entropy into the key */
+static amplify_mp_err s_chacha20_reseed(s_chacha20_state *st, unsigned generation)
+{
+   unsigned char seed[32];
+   amplify_mp_err err;
+   int i;
+
+   if ((err = amplify_s_mp_rand_platform(seed, sizeof(seed))) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < 8; ++i) {
+      st->key[i] ^= s_load32_le(seed + (4 * i));
+   }
+   AMPLIFY_MP_ZERO_BUFFER(seed, sizeof(seed));
+
+   /* discard keystream derived from the old key */
+   AMPLIFY_MP_ZERO_BUFFER(st->buf, sizeof(st->buf));
+   st->since_reseed = 0u;
+   st->generation = generation;
+   s_chacha20_refill(st);
+   return AMPLIFY_MP_OKAY;
+}
+
+amplify_mp_err amplify_mp_rand_chacha20(void *out, size_t size)
+{
+   s_chacha20_state *st = &s_state;
+   unsigned char *q = (unsigned char *)out;
+   unsigned generation = AMPLIFY_MP_CHACHA20_GENERATION();
+   amplify_mp_err err;
+
+   if ((st->generation != generation) || (st->since_reseed >= AMPLIFY_MP_CHACHA20_RESEED)) {
+      if ((err = s_chacha20_reseed(st, generation)) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+   }
+
+   while (size > 0u) {
+      size_t n, i;
+      unsigned char *p;
+
+      if (st->avail == 0u) {
+         s_chacha20_refill(st);
+      }
+      n = AMPLIFY_MP_MIN(size, st->avail);
+      p = st->buf + (AMPLIFY_MP_CHACHA20_BUF - st->avail);
+      for (i = 0u; i < n; ++i) {
+         q[i] = p[i];
+      }
+      AMPLIFY_MP_ZERO_BUFFER(p, n);
+      st->avail -= n;
+      st->since_reseed += n;
+      q += n;
+      size -= n;
+   }
+
+   return AMPLIFY_MP_OKAY;
+}
+
+#else
+
+/* no thread local storage, hand every request to the platform source */
+amplify_mp_err amplify_mp_rand_chacha20(void *out, size_t size)
+{
+   return amplify_s_mp_rand_platform(out, size);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,48 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_RAND_RANGE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* makes a uniformly random r with 0 <= r < N
+ *
+ * Candidates with the bit length of N are drawn into the digits of "r"
+ * and rejected while r >= N, so a retry costs neither an allocation nor
+ * a copy. On average fewer than two draws are needed.
+ */
+amplify_mp_err amplify_mp_rand_range(amplify_mp_int *r, const amplify_mp_int *N)
+{
+   amplify_mp_err err;
+   amplify_mp_digit top_mask;
+   int digits, i;
+
+   if ((r == N) || (N->sign == AMPLIFY_MP_NEG) || AMPLIFY_MP_IS_ZERO(N)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   digits   = N->used;
+   top_mask = AMPLIFY_MP_MASK >> ((digits * AMPLIFY_MP_DIGIT_BIT) - amplify_mp_count_bits(N));
+
+   if ((err = amplify_mp_grow(r, digits)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   AMPLIFY_MP_ZERO_DIGITS(r->dp + digits, r->alloc - digits);
+   r->sign = AMPLIFY_MP_ZPOS;
+
+   do {
+      if ((err = amplify_s_mp_rand_source(r->dp, (size_t)digits * sizeof(amplify_mp_digit))) != AMPLIFY_MP_OKAY) {
+         amplify_mp_zero(r);
+         return err;
+      }
+      for (i = 0; i < (digits - 1); ++i) {
+         r->dp[i] &= AMPLIFY_MP_MASK;
+      }
+      r->dp[digits - 1] &= top_mask;
+
+      r->used = digits;
+      amplify_mp_clamp(r);
+   } while (amplify_mp_cmp_mag(r, N) != AMPLIFY_MP_LT);
+
+   return AMPLIFY_MP_OKAY;
+}
+#endif
@@ -0,0 +1,67 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_READ_HEX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* read "size" chars of hexadecimal [ASCII], an optional '-' followed by
+ * digits of either case
+ *
+ * Unlike amplify_mp_read_radix, which multiplies the whole number by the
+ * radix for every char, each nibble is or'ed straight into its digit.
+ */
+amplify_mp_err amplify_mp_read_hex(amplify_mp_int *a, const char *str, size_t size)
+{
+   amplify_mp_err   err;
+   amplify_mp_sign  neg = AMPLIFY_MP_ZPOS;
+   amplify_mp_digit d;
+   int              digs, ix = 0, bit = 0;
+   unsigned         ch;
+
+   if ((size > 0u) && (*str == '-')) {
+      neg = AMPLIFY_MP_NEG;
+      ++str;
+      --size;
+   }
+
+   if (size > ((size_t)INT_MAX / 4u)) {
+      return AMPLIFY_MP_VAL;
+   }
+   digs = (((int)size * 4) + (AMPLIFY_MP_DIGIT_BIT - 1)) / AMPLIFY_MP_DIGIT_BIT;
+   if ((err = amplify_mp_grow(a, digs)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   amplify_mp_zero(a);
+
+   /* least significant nibble first */
+   while (size-- > 0u) {
+      ch = (unsigned char)str[size];
+      if ((ch - (unsigned)'0') < 10u) {
+         d = (amplify_mp_digit)(ch - (unsigned)'0');
+      } else if (((ch | 0x20u) - (unsigned)'a') < 6u) {
+         d = (amplify_mp_digit)(((ch | 0x20u) - (unsigned)'a') + 10u);
+      } else {
+         amplify_mp_zero(a);
+         return AMPLIFY_MP_VAL;
+      }
+
+      a->dp[ix] |= (amplify_mp_digit)(d << bit) & AMPLIFY_MP_MASK;
+      if ((bit + 4) > AMPLIFY_MP_DIGIT_BIT) {
+         /* the nibble straddles two digits */
+         a->dp[ix + 1] |= d >> (AMPLIFY_MP_DIGIT_BIT - bit);
+      }
+      bit += 4;
+      if (bit >= AMPLIFY_MP_DIGIT_BIT) {
+         bit -= AMPLIFY_MP_DIGIT_BIT;
+         ++ix;
+      }
+   }
+
+   a->used = digs;
+   amplify_mp_clamp(a);
+   if (!AMPLIFY_MP_IS_ZERO(a)) {
+      a->sign = neg;
+   }
+   return AMPLIFY_MP_OKAY;
+}
+#endif
@@ -23,6 +23,15 @@ amplify_mp_err amplify_mp_read_radix(amplify_mp_int *a, const char *str, int rad
       return AMPLIFY_MP_VAL;
    }
 
+   if (AMPLIFY_MP_HAS(MP_READ_HEX) && (radix == 16)) {
+      /* the number ends where the loop below stops at the latest */
+      size_t size = 0u;
+      while ((str[size] != '\0') && (str[size] != '\r') && (str[size] != '\n')) {
+         ++size;
+      }
+      return amplify_mp_read_hex(a, str, size);
+   }
+
    /* if the leading digit is a
     * minus set the sign to negative.
     */
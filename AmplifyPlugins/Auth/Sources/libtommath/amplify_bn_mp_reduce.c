@@ -8,7 +8,7 @@
  * precomputed via amplify_mp_reduce_setup.
  * From HAC pp.604 Algorithm 14.42
  */
-amplify_mp_err amplify_mp_reduce(amplify_mp_int *x, const amplify_mp_int *m, const amplify_mp_int *mu)
+static amplify_mp_err s_mp_reduce(amplify_mp_int *x, const amplify_mp_int *m, const amplify_mp_int *mu)
 {
    amplify_mp_int  q;
    amplify_mp_err  err;
@@ -81,4 +81,9 @@ CLEANUP:
 
    return err;
 }
+
+amplify_mp_err amplify_mp_reduce(amplify_mp_int *x, const amplify_mp_int *m, const amplify_mp_int *mu)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_REDUCE, x->used, s_mp_reduce(x, m, mu));
+}
 #endif
@@ -5,7 +5,7 @@
 /* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
 
 /* reduces a modulo n where n is of the form 2**p - d */
-amplify_mp_err amplify_mp_reduce_2k(amplify_mp_int *a, const amplify_mp_int *n, amplify_mp_digit d)
+static amplify_mp_err s_mp_reduce_2k(amplify_mp_int *a, const amplify_mp_int *n, amplify_mp_digit d)
 {
    amplify_mp_int q;
    amplify_mp_err err;
@@ -46,4 +46,8 @@ LBL_ERR:
    return err;
 }
 
+amplify_mp_err amplify_mp_reduce_2k(amplify_mp_int *a, const amplify_mp_int *n, amplify_mp_digit d)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_REDUCE, a->used, s_mp_reduce_2k(a, n, d));
+}
 #endif
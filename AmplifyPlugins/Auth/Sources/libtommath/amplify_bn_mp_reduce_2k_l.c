@@ -8,7 +8,7 @@
    This differs from reduce_2k since "d" can be larger
    than a single digit.
 */
-amplify_mp_err amplify_mp_reduce_2k_l(amplify_mp_int *a, const amplify_mp_int *n, const amplify_mp_int *d)
+static amplify_mp_err s_mp_reduce_2k_l(amplify_mp_int *a, const amplify_mp_int *n, const amplify_mp_int *d)
 {
    amplify_mp_int q;
    amplify_mp_err err;
@@ -47,4 +47,8 @@ LBL_ERR:
    return err;
 }
 
+amplify_mp_err amplify_mp_reduce_2k_l(amplify_mp_int *a, const amplify_mp_int *n, const amplify_mp_int *d)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_REDUCE, a->used, s_mp_reduce_2k_l(a, n, d));
+}
 #endif
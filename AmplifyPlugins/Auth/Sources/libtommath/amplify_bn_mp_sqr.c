@@ -5,11 +5,18 @@
 /* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
 
 /* computes b = a*a */
-amplify_mp_err amplify_mp_sqr(const amplify_mp_int *a, amplify_mp_int *b)
+static amplify_mp_err s_mp_sqr(const amplify_mp_int *a, amplify_mp_int *b)
 {
    amplify_mp_err err;
-   if (AMPLIFY_MP_HAS(S_MP_TOOM_SQR) && /* use Toom-Cook? */
-       (a->used >= AMPLIFY_MP_TOOM_SQR_CUTOFF)) {
+   if (AMPLIFY_MP_HAS(S_MP_FFT_SQR) && /* number theoretic transform? */
+       (a->used >= AMPLIFY_MP_FFT_SQR_CUTOFF) &&
+       ((2 * a->used) <= AMPLIFY_MP_FFT_MAX_DIGITS)) {
+      err = amplify_s_mp_fft_sqr(a, b);
+   } else if (AMPLIFY_MP_HAS(S_MP_TOOM4_SQR) && /* Toom-Cook 4-way? */
+              (a->used >= AMPLIFY_MP_TOOM4_SQR_CUTOFF)) {
+      err = amplify_s_mp_toom4_sqr(a, b);
+   } else if (AMPLIFY_MP_HAS(S_MP_TOOM_SQR) && /* use Toom-Cook? */
+              (a->used >= AMPLIFY_MP_TOOM_SQR_CUTOFF)) {
       err = amplify_s_mp_toom_sqr(a, b);
    } else if (AMPLIFY_MP_HAS(S_MP_KARATSUBA_SQR) &&  /* Karatsuba? */
               (a->used >= AMPLIFY_MP_KARATSUBA_SQR_CUTOFF)) {
@@ -26,4 +33,9 @@ amplify_mp_err amplify_mp_sqr(const amplify_mp_int *a, amplify_mp_int *b)
    b->sign = AMPLIFY_MP_ZPOS;
    return err;
 }
+
+amplify_mp_err amplify_mp_sqr(const amplify_mp_int *a, amplify_mp_int *b)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_SQR, a->used, s_mp_sqr(a, b));
+}
 #endif
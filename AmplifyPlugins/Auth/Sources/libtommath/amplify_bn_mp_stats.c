@@ -0,0 +1,110 @@
+/* the counting heap wrappers below call the real heap macros */
+#define AMPLIFY_BN_MP_STATS_IMPL
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_STATS_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+#ifdef AMPLIFY_MP_STATS
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* without thread local storage all threads share (and race on) one set of counters */
+#ifdef AMPLIFY_MP_THREAD_LOCAL
+static AMPLIFY_MP_THREAD_LOCAL amplify_mp_stats s_stats;
+#else
+static amplify_mp_stats s_stats;
+#endif
+
+uint64_t amplify_s_mp_stats_now(void)
+{
+#if defined(_WIN32)
+   LARGE_INTEGER counter, frequency;
+   QueryPerformanceCounter(&counter);
+   QueryPerformanceFrequency(&frequency);
+   return (uint64_t)(((double)counter.QuadPart * 1e9) / (double)frequency.QuadPart);
+#else
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+void amplify_s_mp_stats_record(int op, size_t digits, uint64_t start)
+{
+   amplify_mp_op_stats *s = &s_stats.ops[op];
+   s->nanoseconds += amplify_s_mp_stats_now() - start;
+   s->digits += (uint64_t)digits;
+   s->calls++;
+}
+
+void *amplify_s_mp_stats_malloc(size_t size)
+{
+   s_stats.allocs++;
+   s_stats.alloc_bytes += (uint64_t)size;
+   return AMPLIFY_MP_MALLOC(size);
+}
+
+void *amplify_s_mp_stats_realloc(void *mem, size_t oldsize, size_t newsize)
+{
+   (void)oldsize; /* unused by the libc heap macros */
+   s_stats.reallocs++;
+   s_stats.realloc_bytes += (uint64_t)newsize;
+   return AMPLIFY_MP_REALLOC(mem, oldsize, newsize);
+}
+
+void *amplify_s_mp_stats_calloc(size_t nmemb, size_t size)
+{
+   s_stats.allocs++;
+   s_stats.alloc_bytes += (uint64_t)nmemb * (uint64_t)size;
+   return AMPLIFY_MP_CALLOC(nmemb, size);
+}
+
+void amplify_s_mp_stats_free(void *mem, size_t size)
+{
+   if (mem != NULL) {
+      s_stats.frees++;
+      s_stats.free_bytes += (uint64_t)size;
+   }
+   AMPLIFY_MP_FREE(mem, size);
+}
+
+amplify_mp_bool amplify_mp_stats_enabled(void)
+{
+   return AMPLIFY_MP_YES;
+}
+
+void amplify_mp_stats_snapshot(amplify_mp_stats *stats)
+{
+   *stats = s_stats;
+}
+
+void amplify_mp_stats_reset(void)
+{
+   AMPLIFY_MP_ZERO_BUFFER(&s_stats, sizeof(s_stats));
+}
+
+#else
+
+amplify_mp_bool amplify_mp_stats_enabled(void)
+{
+   return AMPLIFY_MP_NO;
+}
+
+void amplify_mp_stats_snapshot(amplify_mp_stats *stats)
+{
+   AMPLIFY_MP_ZERO_BUFFER(stats, sizeof(*stats));
+}
+
+void amplify_mp_stats_reset(void)
+{
+}
+
+#endif
+
+#endif
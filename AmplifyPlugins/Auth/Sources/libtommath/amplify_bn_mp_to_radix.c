@@ -9,7 +9,7 @@
  * Stores upto "size - 1" chars and always a NULL byte, puts the number of characters
  * written, including the '\0', in "written".
  */
-amplify_mp_err amplify_mp_to_radix(const amplify_mp_int *a, char *str, size_t maxlen, size_t *written, int radix)
+static amplify_mp_err s_mp_to_radix(const amplify_mp_int *a, char *str, size_t maxlen, size_t *written, int radix)
 {
    size_t  digs;
    amplify_mp_err  err;
@@ -25,6 +25,10 @@ amplify_mp_err amplify_mp_to_radix(const amplify_mp_int *a, char *str, size_t ma
       return AMPLIFY_MP_VAL;
    }
 
+   if (AMPLIFY_MP_HAS(MP_WRITE_HEX) && (radix == 16)) {
+      return amplify_mp_write_hex(a, str, maxlen, written);
+   }
+
    /* quick out if its zero */
    if (AMPLIFY_MP_IS_ZERO(a)) {
       *str++ = '0';
@@ -82,4 +86,9 @@ LBL_ERR:
    return err;
 }
 
+amplify_mp_err amplify_mp_to_radix(const amplify_mp_int *a, char *str, size_t maxlen, size_t *written, int radix)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_TO_RADIX, a->used, s_mp_to_radix(a, str, maxlen, written, radix));
+}
+
 #endif
@@ -0,0 +1,58 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_MP_WRITE_HEX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* stores a bignum as an upper case hexadecimal [ASCII] string, with the
+ * same contract as amplify_mp_to_radix
+ *
+ * The nibbles are read off the digits from the top, so there is no copy
+ * of the number and no division.
+ */
+amplify_mp_err amplify_mp_write_hex(const amplify_mp_int *a, char *str, size_t maxlen, size_t *written)
+{
+   amplify_mp_digit d;
+   size_t           len;
+   int              bit, ix, offset;
+
+   if (maxlen < 2u) {
+      return AMPLIFY_MP_BUF;
+   }
+
+   if (AMPLIFY_MP_IS_ZERO(a)) {
+      *str++ = '0';
+      *str = '\0';
+      if (written != NULL) {
+         *written = 2u;
+      }
+      return AMPLIFY_MP_OKAY;
+   }
+
+   bit = ((amplify_mp_count_bits(a) + 3) / 4) * 4;
+   len = ((size_t)bit / 4u) + ((a->sign == AMPLIFY_MP_NEG) ? 1u : 0u) + 1u;
+   if (maxlen < len) {
+      return AMPLIFY_MP_BUF;
+   }
+
+   if (a->sign == AMPLIFY_MP_NEG) {
+      *str++ = '-';
+   }
+   while ((bit -= 4) >= 0) {
+      ix = bit / AMPLIFY_MP_DIGIT_BIT;
+      offset = bit % AMPLIFY_MP_DIGIT_BIT;
+      d = a->dp[ix] >> offset;
+      if (((offset + 4) > AMPLIFY_MP_DIGIT_BIT) && ((ix + 1) < a->used)) {
+         /* the nibble straddles two digits */
+         d |= a->dp[ix + 1] << (AMPLIFY_MP_DIGIT_BIT - offset);
+      }
+      *str++ = amplify_mp_s_rmap[d & 15u];
+   }
+   *str = '\0';
+
+   if (written != NULL) {
+      *written = len;
+   }
+   return AMPLIFY_MP_OKAY;
+}
+#endif
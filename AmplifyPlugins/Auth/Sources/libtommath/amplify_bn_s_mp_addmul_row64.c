@@ -0,0 +1,24 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_ADDMUL_ROW64_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+#if AMPLIFY_MP_LIMB64
+/* t[0..len) += a[0..len) * b on full 64-bit limbs, returns the carry limb */
+uint64_t amplify_s_mp_addmul_row64(uint64_t *t, const uint64_t *a, int len, uint64_t b)
+{
+   amplify_mp_word r;
+   uint64_t u = 0;
+   int i;
+
+   for (i = 0; i < len; i++) {
+      r = ((amplify_mp_word)a[i] * (amplify_mp_word)b) + (amplify_mp_word)t[i] + (amplify_mp_word)u;
+      t[i] = (uint64_t)r;
+      u = (uint64_t)(r >> 64);
+   }
+   return u;
+}
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_ADDMUL_ROW64_ADX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+#if AMPLIFY_MP_X86_64_ADX
+/* amplify_s_mp_addmul_row64 for x86_64 CPUs with BMI2 and ADX
+ *
+ * MULX leaves the flags alone, so the low halves of the products go into t
+ * on the OF chain (ADOX) while the high halves are carried into the next
+ * limb on the CF chain (ADCX). The two chains run side by side, the portable
+ * version serializes them through one carry. The loop control has to stay
+ * off the flags too, hence LEA and JRCXZ, and it is unrolled four times.
+ *
+ * Only call this when amplify_s_mp_cpu_features() reports both extensions.
+ */
+uint64_t amplify_s_mp_addmul_row64_adx(uint64_t *t, const uint64_t *a, int len, uint64_t b)
+{
+   uint64_t u, lo, hi, n = (uint64_t)(len & 3), n4 = (uint64_t)(len >> 2);
+
+   if (len <= 0) {
+      return 0;
+   }
+
+   __asm__(
+      "xorl    %k[u], %k[u]\n\t"          /* u = 0, clears CF and OF */
+
+      /* len mod 4 single limbs */
+      "1:\n\t"
+      "jrcxz   2f\n\t"
+      "mulxq   (%[a]), %[lo], %[hi]\n\t"  /* hi:lo = a[i] * b */
+      "adcxq   %[u], %[lo]\n\t"           /* lo += previous hi + CF */
+      "adoxq   (%[t]), %[lo]\n\t"         /* lo += t[i] + OF */
+      "movq    %[lo], (%[t])\n\t"
+      "movq    %[hi], %[u]\n\t"
+      "leaq    8(%[a]), %[a]\n\t"
+      "leaq    8(%[t]), %[t]\n\t"
+      "leaq    -1(%[n]), %[n]\n\t"
+      "jmp     1b\n\t"
+
+      /* then four at a time, the high halves alternate between u and hi */
+      "2:\n\t"
+      "movq    %[n4], %[n]\n\t"
+      "3:\n\t"
+      "jrcxz   4f\n\t"
+      "mulxq   (%[a]), %[lo], %[hi]\n\t"
+      "adcxq   %[u], %[lo]\n\t"
+      "adoxq   (%[t]), %[lo]\n\t"
+      "movq    %[lo], (%[t])\n\t"
+      "mulxq   8(%[a]), %[lo], %[u]\n\t"
+      "adcxq   %[hi], %[lo]\n\t"
+      "adoxq   8(%[t]), %[lo]\n\t"
+      "movq    %[lo], 8(%[t])\n\t"
+      "mulxq   16(%[a]), %[lo], %[hi]\n\t"
+      "adcxq   %[u], %[lo]\n\t"
+      "adoxq   16(%[t]), %[lo]\n\t"
+      "movq    %[lo], 16(%[t])\n\t"
+      "mulxq   24(%[a]), %[lo], %[u]\n\t"
+      "adcxq   %[hi], %[lo]\n\t"
+      "adoxq   24(%[t]), %[lo]\n\t"
+      "movq    %[lo], 24(%[t])\n\t"
+      "leaq    32(%[a]), %[a]\n\t"
+      "leaq    32(%[t]), %[t]\n\t"
+      "leaq    -1(%[n]), %[n]\n\t"
+      "jmp     3b\n\t"
+
+      "4:\n\t"
+      "movl    $0, %k[lo]\n\t"
+      "adcxq   %[lo], %[u]\n\t"           /* fold both carries into the top limb */
+      "adoxq   %[lo], %[u]\n\t"
+      : [u] "=&r"(u), [lo] "=&r"(lo), [hi] "=&r"(hi), [a] "+r"(a), [t] "+r"(t), [n] "+c"(n)
+      : [n4] "r"(n4), "d"(b)
+      : "cc", "memory");
+
+   return u;
+}
+#endif
+
+#endif
@@ -0,0 +1,20 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_ADDMUL_ROW64_KERNEL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* the accelerated row kernel for this CPU, NULL if there is none and only
+ * the portable amplify_s_mp_addmul_row64 is left
+ */
+amplify_s_mp_addmul_row64_fn amplify_s_mp_addmul_row64_kernel(void)
+{
+#if AMPLIFY_MP_X86_64_ADX
+   if ((amplify_s_mp_cpu_features() & (AMPLIFY_MP_CPU_X86_BMI2 | AMPLIFY_MP_CPU_X86_ADX)) ==
+       (AMPLIFY_MP_CPU_X86_BMI2 | AMPLIFY_MP_CPU_X86_ADX)) {
+      return amplify_s_mp_addmul_row64_adx;
+   }
+#endif
+   return NULL;
+}
+#endif
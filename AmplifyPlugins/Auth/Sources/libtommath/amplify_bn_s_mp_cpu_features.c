@@ -0,0 +1,49 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_CPU_FEATURES_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+#if AMPLIFY_MP_X86_64_ADX
+#include <cpuid.h>
+#endif
+
+/* AMPLIFY_MP_CPU_* bits of the instruction set extensions the optimized
+ * kernels can use on this machine. CPUID can trap to the hypervisor, so the
+ * answer is kept per thread.
+ */
+static unsigned int s_detect(void)
+{
+   unsigned int features = 0u;
+#if AMPLIFY_MP_X86_64_ADX
+   unsigned int eax, ebx, ecx, edx;
+
+   if ((__get_cpuid_max(0u, NULL) >= 7u) && (__get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx) != 0)) {
+      if ((ebx & (1u << 8)) != 0u) {
+         features |= AMPLIFY_MP_CPU_X86_BMI2;
+      }
+      if ((ebx & (1u << 19)) != 0u) {
+         features |= AMPLIFY_MP_CPU_X86_ADX;
+      }
+   }
+#endif
+   return features;
+}
+
+unsigned int amplify_s_mp_cpu_features(void)
+{
+#ifdef AMPLIFY_MP_THREAD_LOCAL
+   static AMPLIFY_MP_THREAD_LOCAL unsigned int features = 0u;
+   static AMPLIFY_MP_THREAD_LOCAL int detected = 0;
+
+   if (detected == 0) {
+      features = s_detect();
+      detected = 1;
+   }
+   return features;
+#else
+   return s_detect();
+#endif
+}
+
+#endif
@@ -0,0 +1,30 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_DIFF_SPAN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* r[0..na) = |a[0..na) - b[0..nb)| for na >= nb, returns AMPLIFY_MP_YES if
+ * a < b. The spans need not be clamped, r must not overlap a or b.
+ */
+amplify_mp_bool amplify_s_mp_diff_span(amplify_mp_digit *r, const amplify_mp_digit *a, int na, const amplify_mp_digit *b, int nb)
+{
+   int i;
+
+   for (i = na - 1; i >= nb; i--) {
+      if (a[i] != 0u) {
+         (void)amplify_s_mp_sub_span(r, a, na, b, nb);
+         return AMPLIFY_MP_NO;
+      }
+   }
+   for (; (i >= 0) && (a[i] == b[i]); i--) {}
+
+   if ((i < 0) || (a[i] > b[i])) {
+      (void)amplify_s_mp_sub_span(r, a, na, b, nb);
+      return AMPLIFY_MP_NO;
+   }
+   (void)amplify_s_mp_sub_span(r, b, nb, a, nb);
+   AMPLIFY_MP_ZERO_DIGITS(r + nb, na - nb);
+   return AMPLIFY_MP_YES;
+}
+#endif
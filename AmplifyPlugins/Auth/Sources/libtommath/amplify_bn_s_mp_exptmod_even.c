@@ -0,0 +1,159 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_EXPTMOD_EVEN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* Y = G**X mod P for an even P = 2**k * m, m odd
+ *
+ * Instead of Barrett reduction modulo the whole of P the power is computed
+ * modulo m with Montgomery reduction and modulo 2**k by keeping only the
+ * low k bits of every product. The two are joined by CRT,
+ *
+ *    Y = r + m * (((s - r) * m**-1) mod 2**k)
+ *
+ * where r = G**X mod m and s = G**X mod 2**k.
+ */
+
+/* c = a * b mod 2**k, the digits above 2**k are never formed */
+static amplify_mp_err s_mul_2k(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c, int k)
+{
+   amplify_mp_err err;
+
+   if ((err = amplify_s_mp_mul_digs(a, b, c, (k + (AMPLIFY_MP_DIGIT_BIT - 1)) / AMPLIFY_MP_DIGIT_BIT)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_mp_mod_2d(c, k, c);
+}
+
+/* Y = G**X mod 2**k for a non-negative G */
+static amplify_mp_err s_exptmod_2k(const amplify_mp_int *G, const amplify_mp_int *X, int k, amplify_mp_int *Y)
+{
+   amplify_mp_int g, e;
+   amplify_mp_err err;
+   int x;
+
+   if ((err = amplify_mp_init_multi(&g, &e, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   if ((err = amplify_mp_mod_2d(G, k, &g)) != AMPLIFY_MP_OKAY)        goto LBL_ERR;
+
+   if (AMPLIFY_MP_IS_ODD(&g)) {
+      /* the odd residues mod 2**k have order 2**(k-2) for k >= 3, at most 2 below */
+      if ((err = amplify_mp_mod_2d(X, (k >= 3) ? (k - 2) : 1, &e)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   } else {
+      /* an even base to at least the k-th power has k factors of two */
+      amplify_mp_set_u32(&e, (uint32_t)k);
+      if (amplify_mp_cmp(X, &e) != AMPLIFY_MP_LT) {
+         amplify_mp_zero(Y);
+         err = AMPLIFY_MP_OKAY;
+         goto LBL_ERR;
+      }
+      if ((err = amplify_mp_copy(X, &e)) != AMPLIFY_MP_OKAY)          goto LBL_ERR;
+   }
+
+   /* left to right square and multiply over the reduced exponent */
+   amplify_mp_set(Y, 1u);
+   for (x = amplify_mp_count_bits(&e) - 1; x >= 0; x--) {
+      if ((err = s_mul_2k(Y, Y, Y, k)) != AMPLIFY_MP_OKAY)            goto LBL_ERR;
+      if (((e.dp[x / AMPLIFY_MP_DIGIT_BIT] >> (x % AMPLIFY_MP_DIGIT_BIT)) & 1u) != 0u) {
+         if ((err = s_mul_2k(Y, &g, Y, k)) != AMPLIFY_MP_OKAY)        goto LBL_ERR;
+      }
+   }
+   err = amplify_mp_mod_2d(Y, k, Y);
+
+LBL_ERR:
+   amplify_mp_clear_multi(&g, &e, NULL);
+   return err;
+}
+
+/* c = a**-1 mod 2**k for an odd a, Newton's iteration doubles the bits per step */
+static amplify_mp_err s_invmod_2k(const amplify_mp_int *a, int k, amplify_mp_int *c)
+{
+   amplify_mp_int t, u;
+   amplify_mp_err err;
+   int bits;
+
+   if ((err = amplify_mp_init_multi(&t, &u, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /* every odd a is its own inverse mod 8 */
+   bits = AMPLIFY_MP_MIN(k, 3);
+   if ((err = amplify_mp_mod_2d(a, bits, c)) != AMPLIFY_MP_OKAY)        goto LBL_ERR;
+
+   while (bits < k) {
+      bits = AMPLIFY_MP_MIN(2 * bits, k);
+
+      /* c = c * (2**bits + 2 - a * c) mod 2**bits */
+      if ((err = s_mul_2k(a, c, &t, bits)) != AMPLIFY_MP_OKAY)          goto LBL_ERR;
+      if ((err = amplify_mp_2expt(&u, bits)) != AMPLIFY_MP_OKAY)         goto LBL_ERR;
+      if ((err = amplify_amplify_mp_add_d(&u, 2u, &u)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      if ((err = amplify_mp_sub(&u, &t, &t)) != AMPLIFY_MP_OKAY)         goto LBL_ERR;
+      if ((err = s_mul_2k(c, &t, c, bits)) != AMPLIFY_MP_OKAY)          goto LBL_ERR;
+   }
+
+LBL_ERR:
+   amplify_mp_clear_multi(&t, &u, NULL);
+   return err;
+}
+
+amplify_mp_err amplify_s_mp_exptmod_even(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y)
+{
+   amplify_mp_int m, g, r, s, t;
+   amplify_mp_err err;
+   int k;
+
+   if (AMPLIFY_MP_IS_ZERO(P) || AMPLIFY_MP_IS_ODD(P) || (P->sign == AMPLIFY_MP_NEG) || (X->sign == AMPLIFY_MP_NEG)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   if ((err = amplify_mp_init_multi(&m, &g, &r, &s, &t, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /* P = 2**k * m */
+   k = amplify_mp_cnt_lsb(P);
+   if ((err = amplify_mp_div_2d(P, k, &m, NULL)) != AMPLIFY_MP_OKAY)    goto LBL_ERR;
+
+   /* a non-negative base, the same one for both halves */
+   if ((err = amplify_mp_mod(G, P, &g)) != AMPLIFY_MP_OKAY)             goto LBL_ERR;
+
+   /* s = g**X mod 2**k */
+   if ((err = s_exptmod_2k(&g, X, k, &s)) != AMPLIFY_MP_OKAY)           goto LBL_ERR;
+
+   /* P is a power of two */
+   if (amplify_mp_cmp_d(&m, 1u) == AMPLIFY_MP_EQ) {
+      amplify_mp_exch(&s, Y);
+      goto LBL_ERR;
+   }
+
+   /* r = g**X mod m, m is odd and greater than 1 */
+   if (AMPLIFY_MP_LIMB64 && AMPLIFY_MP_HAS(S_MP_EXPTMOD_LIMB64) &&
+       (amplify_s_mp_addmul_row64_kernel() != NULL)) {
+      err = amplify_s_mp_exptmod_limb64(&g, X, &m, &r);
+   } else {
+      err = amplify_s_mp_exptmod_fast(&g, X, &m, &r, 0);
+   }
+   if (err != AMPLIFY_MP_OKAY)                                          goto LBL_ERR;
+
+   /* s = (s - r) mod 2**k, kept non-negative */
+   if ((err = amplify_mp_mod_2d(&r, k, &t)) != AMPLIFY_MP_OKAY)         goto LBL_ERR;
+   if (amplify_mp_cmp(&s, &t) == AMPLIFY_MP_LT) {
+      if ((err = amplify_mp_2expt(&g, k)) != AMPLIFY_MP_OKAY)           goto LBL_ERR;
+      if ((err = amplify_mp_add(&s, &g, &s)) != AMPLIFY_MP_OKAY)        goto LBL_ERR;
+   }
+   if ((err = amplify_mp_sub(&s, &t, &s)) != AMPLIFY_MP_OKAY)           goto LBL_ERR;
+
+   /* Y = r + m * ((s * m**-1) mod 2**k) */
+   if ((err = s_invmod_2k(&m, k, &t)) != AMPLIFY_MP_OKAY)               goto LBL_ERR;
+   if ((err = s_mul_2k(&s, &t, &s, k)) != AMPLIFY_MP_OKAY)              goto LBL_ERR;
+   if ((err = amplify_mp_mul(&s, &m, &s)) != AMPLIFY_MP_OKAY)           goto LBL_ERR;
+   err = amplify_mp_add(&s, &r, Y);
+
+LBL_ERR:
+   amplify_mp_clear_multi(&m, &g, &r, &s, &t, NULL);
+   return err;
+}
+#endif
@@ -0,0 +1,289 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_EXPTMOD_LIMB64_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* Y = G**X mod P for odd P and X >= 0, on full 64-bit limbs
+ *
+ * The 60-bit digits leave the comba loops one short carry chain per column,
+ * there is nothing for wider multiply-accumulate instructions to chain. Here
+ * the operands are repacked into 64-bit limbs once, which also cuts the limb
+ * count by a fifteenth, and every product and Montgomery reduction is done
+ * as rows t += a * b[i] by the row kernel amplify_s_mp_addmul_row64_kernel
+ * picks for the CPU, the portable amplify_s_mp_addmul_row64 if it has none.
+ *
+ * The exponent is scanned left-to-right with a sliding window over the odd
+ * powers of G, as in amplify_s_mp_mont_exptmod.
+ */
+
+#if AMPLIFY_MP_LIMB64
+
+#ifdef AMPLIFY_MP_LOW_MEM
+#   define MAX_WINSIZE 4
+#else
+#   define MAX_WINSIZE 6
+#endif
+
+typedef struct {
+   const uint64_t *n;
+   uint64_t n0;                       /* -n^-1 mod 2^64 */
+   int len;
+   uint64_t *t;                       /* 2 * len + 1 limbs */
+   amplify_s_mp_addmul_row64_fn row;
+   int digits;                        /* of the modulus, the unit of the statistics */
+} s_mont64;
+
+/* r = t[len..2len] mod n, t[len..2len] < 2n */
+static void s_final(const s_mont64 *m, uint64_t *r)
+{
+   const uint64_t *t = m->t + m->len;
+   uint64_t borrow = 0;
+   int i;
+
+   if (t[m->len] == 0u) {
+      for (i = m->len - 1; (i >= 0) && (t[i] == m->n[i]); i--) {}
+      if ((i >= 0) && (t[i] < m->n[i])) {
+         for (i = 0; i < m->len; i++) {
+            r[i] = t[i];
+         }
+         return;
+      }
+   }
+   for (i = 0; i < m->len; i++) {
+      uint64_t x = t[i], y = m->n[i];
+      r[i] = x - y - borrow;
+      borrow = ((x < y) || ((x == y) && (borrow != 0u))) ? 1u : 0u;
+   }
+}
+
+/* t[k..2len] += c */
+static void s_carry(uint64_t *t, int k, int top, uint64_t c)
+{
+   for (; (c != 0u) && (k <= top); k++) {
+      t[k] += c;
+      c = (t[k] < c) ? 1u : 0u;
+   }
+}
+
+/* r = t * R**-1 mod n for the 2len limb product in m->t */
+static void s_reduce(const s_mont64 *m, uint64_t *r)
+{
+   uint64_t *t = m->t;
+   int i, len = m->len;
+
+   for (i = 0; i < len; i++) {
+      uint64_t mu = t[i] * m->n0;
+      s_carry(t, i + len, 2 * len, m->row(t + i, m->n, len, mu));
+   }
+   s_final(m, r);
+}
+
+/* m->t = a * b */
+static void s_product(const s_mont64 *m, const uint64_t *a, const uint64_t *b)
+{
+   int i, len = m->len;
+
+   for (i = 0; i <= (2 * len); i++) {
+      m->t[i] = 0u;
+   }
+   for (i = 0; i < len; i++) {
+      m->t[i + len] = m->row(m->t + i, a, len, b[i]);
+   }
+}
+
+/* m->t = a * a, the cross products once, doubled, plus the squares */
+static void s_square(const s_mont64 *m, const uint64_t *a)
+{
+   uint64_t *t = m->t, c;
+   int i, len = m->len;
+
+   for (i = 0; i <= (2 * len); i++) {
+      t[i] = 0u;
+   }
+   for (i = 0; i < (len - 1); i++) {
+      t[i + len] = m->row(t + (2 * i) + 1, a + i + 1, len - i - 1, a[i]);
+   }
+
+   c = 0u;
+   for (i = 0; i < (2 * len); i++) {
+      uint64_t x = t[i];
+      t[i] = (x << 1) | c;
+      c = x >> 63;
+   }
+
+   c = 0u;
+   for (i = 0; i < len; i++) {
+      amplify_mp_word sq = (amplify_mp_word)a[i] * (amplify_mp_word)a[i];
+      amplify_mp_word lo = (amplify_mp_word)t[2 * i] + (uint64_t)sq + c;
+      amplify_mp_word hi = (amplify_mp_word)t[(2 * i) + 1] + (uint64_t)(sq >> 64) + (uint64_t)(lo >> 64);
+      t[2 * i] = (uint64_t)lo;
+      t[(2 * i) + 1] = (uint64_t)hi;
+      c = (uint64_t)(hi >> 64);
+   }
+}
+
+/* r = a * b * R**-1 mod n, r may alias a or b. The products and reductions
+ * are counted as amplify_mp_mul and amplify_mp_montgomery_reduce would count them */
+static void s_mul(const s_mont64 *m, const uint64_t *a, const uint64_t *b, uint64_t *r)
+{
+   AMPLIFY_MP_STATS_VOID(AMPLIFY_MP_STATS_MUL, 2 * m->digits, s_product(m, a, b));
+   AMPLIFY_MP_STATS_VOID(AMPLIFY_MP_STATS_REDUCE, 2 * m->digits, s_reduce(m, r));
+}
+
+/* r = a * a * R**-1 mod n */
+static void s_sqr(const s_mont64 *m, const uint64_t *a, uint64_t *r)
+{
+   AMPLIFY_MP_STATS_VOID(AMPLIFY_MP_STATS_SQR, m->digits, s_square(m, a));
+   AMPLIFY_MP_STATS_VOID(AMPLIFY_MP_STATS_REDUCE, 2 * m->digits, s_reduce(m, r));
+}
+
+/* limbs[0..len) = a, a must fit */
+static amplify_mp_err s_load(uint64_t *limbs, int len, const amplify_mp_int *a)
+{
+   size_t written = 0;
+   amplify_mp_err err;
+   int i;
+
+   if ((err = amplify_mp_pack(limbs, (size_t)len, &written, AMPLIFY_MP_LSB_FIRST, sizeof(uint64_t),
+                              AMPLIFY_MP_NATIVE_ENDIAN, 0u, a)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   for (i = (int)written; i < len; i++) {
+      limbs[i] = 0u;
+   }
+   return AMPLIFY_MP_OKAY;
+}
+
+amplify_mp_err amplify_s_mp_exptmod_limb64(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y)
+{
+   s_mont64 m;
+   amplify_mp_int tmp;
+   uint64_t *buf, *n, *M, *g2, *res, inv;
+   size_t size;
+   int bits, winsize, len, i, j, w, x;
+   amplify_mp_err err;
+
+   if ((X->sign == AMPLIFY_MP_NEG) || !AMPLIFY_MP_IS_ODD(P)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   bits = amplify_mp_count_bits(X);
+   if (bits <= 7) {
+      winsize = 2;
+   } else if (bits <= 36) {
+      winsize = 3;
+   } else if (bits <= 140) {
+      winsize = 4;
+   } else if (bits <= 450) {
+      winsize = 5;
+   } else {
+      winsize = 6;
+   }
+   winsize = AMPLIFY_MP_MIN(winsize, MAX_WINSIZE);
+
+   /* n, the odd powers of G, G**2, the result and the product */
+   len = (amplify_mp_count_bits(P) + 63) / 64;
+   size = (size_t)(len * (3 + (1 << (winsize - 1))) + ((2 * len) + 1)) * sizeof(uint64_t);
+   buf = (uint64_t *) AMPLIFY_MP_MALLOC(size);
+   if (buf == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   n = buf;
+   g2 = n + len;
+   res = g2 + len;
+   m.t = res + len;
+   M = m.t + ((2 * len) + 1);
+
+   /* -1/n mod 2**64 by Newton iteration, every step doubles the correct low bits */
+   if ((err = s_load(n, len, P)) != AMPLIFY_MP_OKAY) {
+      goto LBL_BUF;
+   }
+   inv = n[0];
+   for (i = 0; i < 5; ++i) {
+      inv *= 2u - (n[0] * inv);
+   }
+   m.n = n;
+   m.n0 = (uint64_t)0u - inv;
+   m.len = len;
+   m.digits = P->used;
+   if ((m.row = amplify_s_mp_addmul_row64_kernel()) == NULL) {
+      m.row = amplify_s_mp_addmul_row64;
+   }
+
+   /* g2 = R**2 mod n, M[0] = G mod n */
+   if ((err = amplify_mp_init(&tmp)) != AMPLIFY_MP_OKAY) {
+      goto LBL_BUF;
+   }
+   if ((err = amplify_mp_2expt(&tmp, 128 * len)) != AMPLIFY_MP_OKAY)       goto LBL_ERR;
+   if ((err = amplify_mp_mod(&tmp, P, &tmp)) != AMPLIFY_MP_OKAY)           goto LBL_ERR;
+   if ((err = s_load(g2, len, &tmp)) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   if ((err = amplify_mp_mod(G, P, &tmp)) != AMPLIFY_MP_OKAY)              goto LBL_ERR;
+   if ((err = s_load(M, len, &tmp)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+
+   /* into the Montgomery domain: res = R mod n, M[0] = G * R mod n */
+   for (i = 0; i < len; i++) {
+      res[i] = 0u;
+   }
+   res[0] = 1u;
+   s_mul(&m, res, g2, res);
+   s_mul(&m, M, g2, M);
+
+   /* M[i] = G**(2i+1) */
+   s_sqr(&m, M, g2);
+   for (j = 1; j < (1 << (winsize - 1)); j++) {
+      s_mul(&m, M + ((j - 1) * len), g2, M + (j * len));
+   }
+
+   i = bits - 1;
+   while (i >= 0) {
+      if (amplify_s_mp_get_bit(X, (unsigned int)i) == AMPLIFY_MP_NO) {
+         s_sqr(&m, res, res);
+         --i;
+         continue;
+      }
+
+      /* longest window X[i..j] of at most winsize bits that ends in a one */
+      j = AMPLIFY_MP_MAX(i - winsize + 1, 0);
+      while (amplify_s_mp_get_bit(X, (unsigned int)j) == AMPLIFY_MP_NO) {
+         ++j;
+      }
+      w = 0;
+      for (x = i; x >= j; x--) {
+         w = (w << 1) | ((amplify_s_mp_get_bit(X, (unsigned int)x) == AMPLIFY_MP_YES) ? 1 : 0);
+         s_sqr(&m, res, res);
+      }
+      s_mul(&m, res, M + ((w >> 1) * len), res);
+      i = j - 1;
+   }
+
+   /* out of the Montgomery domain */
+   for (i = 0; i < len; i++) {
+      g2[i] = 0u;
+   }
+   g2[0] = 1u;
+   s_mul(&m, res, g2, res);
+
+   err = amplify_mp_unpack(Y, (size_t)len, AMPLIFY_MP_LSB_FIRST, sizeof(uint64_t), AMPLIFY_MP_NATIVE_ENDIAN, 0u, res);
+
+LBL_ERR:
+   amplify_mp_clear(&tmp);
+LBL_BUF:
+   AMPLIFY_MP_FREE_BUFFER(buf, size);
+   return err;
+}
+
+#else
+
+amplify_mp_err amplify_s_mp_exptmod_limb64(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y)
+{
+   (void)G;
+   (void)X;
+   (void)P;
+   (void)Y;
+   return AMPLIFY_MP_VAL;
+}
+
+#endif
+
+#endif
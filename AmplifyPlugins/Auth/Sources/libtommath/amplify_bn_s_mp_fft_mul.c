@@ -0,0 +1,268 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_FFT_MUL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* multiplication using a number theoretic transform, O(N log N)
+ *
+ * The operands are cut into coefficients of AMPLIFY_MP_FFT_BITS bits and
+ * convolved modulo three primes below 2^31, the exact convolution is put
+ * back together with Garner's algorithm. The primes have a product of about
+ * 2^89, enough for coefficients of up to 31 bits and transforms of up to
+ * 2^24 points, which bounds the operands to AMPLIFY_MP_FFT_MAX_DIGITS.
+ *
+ * Arithmetic modulo the primes is done in 32-bit Montgomery form. The forward
+ * transform is decimation in frequency and leaves its output in bit reversed
+ * order, the inverse transform is decimation in time and takes it that way,
+ * so no reordering pass is needed.
+ *
+ * Squares when a == b.
+ */
+
+typedef struct {
+   uint32_t p;      /* k*2^s + 1 */
+   uint32_t g;      /* generator of the multiplicative group */
+   uint32_t pinv;   /* -p^-1 mod 2^32 */
+   uint32_t r2;     /* 2^64 mod p */
+} s_ntt_prime;
+
+/* 15*2^27+1, 7*2^26+1, 45*2^24+1 */
+static const uint32_t s_primes[3][2] = {
+   { 2013265921u, 31u },
+   { 469762049u,  3u },
+   { 754974721u,  11u }
+};
+
+#define S_NTT_MAX_LOG 24
+
+static uint32_t s_powmod(uint32_t b, uint32_t e, uint32_t p)
+{
+   uint64_t r = 1u, x = b;
+   while (e != 0u) {
+      if ((e & 1u) != 0u) {
+         r = (r * x) % p;
+      }
+      x = (x * x) % p;
+      e >>= 1;
+   }
+   return (uint32_t)r;
+}
+
+/* x * 2^-32 mod p for x < p * 2^32 */
+static uint32_t s_redc(uint64_t x, const s_ntt_prime *P)
+{
+   uint32_t m = (uint32_t)x * P->pinv;
+   uint64_t t = (x + ((uint64_t)m * P->p)) >> 32;
+   return (uint32_t)((t >= P->p) ? (t - P->p) : t);
+}
+
+static uint32_t s_mulm(uint32_t a, uint32_t b, const s_ntt_prime *P)
+{
+   return s_redc((uint64_t)a * b, P);
+}
+
+static uint32_t s_addm(uint32_t a, uint32_t b, uint32_t p)
+{
+   uint32_t r = a + b;
+   return (r >= p) ? (r - p) : r;
+}
+
+static uint32_t s_subm(uint32_t a, uint32_t b, uint32_t p)
+{
+   return (a >= b) ? (a - b) : ((a + p) - b);
+}
+
+static void s_prime_setup(int i, s_ntt_prime *P)
+{
+   uint32_t inv;
+   uint64_t r;
+   int k;
+
+   P->p = s_primes[i][0];
+   P->g = s_primes[i][1];
+
+   /* Newton iteration, every step doubles the correct low bits */
+   inv = P->p;
+   for (k = 0; k < 5; ++k) {
+      inv *= 2u - (P->p * inv);
+   }
+   P->pinv = (uint32_t)0u - inv;
+
+   r = ((uint64_t)1u << 32) % P->p;
+   P->r2 = (uint32_t)((r * r) % P->p);
+}
+
+/* twiddle factors in Montgomery form, stage by stage: w[len + j] is the j-th
+ * power of a primitive (2*len)-th root of unity, for len = 1, 2, ..., n/2
+ */
+static void s_roots(uint32_t *w, size_t n, uint32_t root, const s_ntt_prime *P)
+{
+   uint32_t rm = s_mulm(root, P->r2, P);
+   size_t len, j;
+
+   for (len = n >> 1; len > 0u; len >>= 1) {
+      w[len] = s_mulm(1u, P->r2, P);
+      for (j = 1u; j < len; ++j) {
+         w[len + j] = s_mulm(w[len + j - 1u], rm, P);
+      }
+      rm = s_mulm(rm, rm, P);
+   }
+}
+
+/* forward transform, natural order in, bit reversed order out */
+static void s_dif(uint32_t *a, size_t n, const uint32_t *w, const s_ntt_prime *P)
+{
+   size_t len, i, j;
+
+   for (len = n >> 1; len > 0u; len >>= 1) {
+      for (i = 0u; i < n; i += 2u * len) {
+         for (j = 0u; j < len; ++j) {
+            uint32_t u = a[i + j], v = a[i + j + len];
+            a[i + j] = s_addm(u, v, P->p);
+            a[i + j + len] = s_mulm(s_subm(u, v, P->p), w[len + j], P);
+         }
+      }
+   }
+}
+
+/* inverse transform without the 1/n, bit reversed order in, natural order out */
+static void s_dit(uint32_t *a, size_t n, const uint32_t *w, const s_ntt_prime *P)
+{
+   size_t len, i, j;
+
+   for (len = 1u; len < n; len <<= 1) {
+      for (i = 0u; i < n; i += 2u * len) {
+         for (j = 0u; j < len; ++j) {
+            uint32_t u = a[i + j], v = s_mulm(a[i + j + len], w[len + j], P);
+            a[i + j] = s_addm(u, v, P->p);
+            a[i + j + len] = s_subm(u, v, P->p);
+         }
+      }
+   }
+}
+
+#define S_COEFFS_PER_DIGIT (AMPLIFY_MP_DIGIT_BIT / AMPLIFY_MP_FFT_BITS)
+#define S_COEFF_MASK       (((amplify_mp_digit)1 << AMPLIFY_MP_FFT_BITS) - 1u)
+
+/* f = the coefficients of a reduced mod p, zero padded to n */
+static void s_load(const amplify_mp_int *a, uint32_t *f, size_t n, uint32_t p)
+{
+   size_t k, na = (size_t)a->used * S_COEFFS_PER_DIGIT;
+
+   for (k = 0u; k < na; ++k) {
+      amplify_mp_digit d = a->dp[k / S_COEFFS_PER_DIGIT] >> ((k % S_COEFFS_PER_DIGIT) * AMPLIFY_MP_FFT_BITS);
+      f[k] = (uint32_t)((uint32_t)(d & S_COEFF_MASK) % p);
+   }
+   for (; k < n; ++k) {
+      f[k] = 0u;
+   }
+}
+
+amplify_mp_err amplify_s_mp_fft_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   s_ntt_prime P[3];
+   uint32_t *buf, *r[3], *fb, *w, *wi, inv01, inv012, p01_2;
+   uint64_t p01, lo, hi;
+   size_t n, ncoeff, k, words;
+   amplify_mp_bool sqr = (a == b) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
+   amplify_mp_int t;
+   amplify_mp_err err;
+   int i, lg;
+
+   ncoeff = (size_t)(a->used + b->used) * S_COEFFS_PER_DIGIT;
+   for (n = 1u, lg = 0; n < ncoeff; n <<= 1, ++lg) {}
+   if (lg > S_NTT_MAX_LOG) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   /* three results, both twiddle tables and the second operand */
+   words = (sqr == AMPLIFY_MP_YES) ? (5u * n) : (6u * n);
+   buf = (uint32_t *) AMPLIFY_MP_MALLOC(words * sizeof(uint32_t));
+   if (buf == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   r[0] = buf;
+   r[1] = buf + n;
+   r[2] = buf + (2u * n);
+   w = buf + (3u * n);
+   wi = w + n;
+   fb = wi + n;
+
+   if ((err = amplify_mp_init_size(&t, a->used + b->used)) != AMPLIFY_MP_OKAY) {
+      AMPLIFY_MP_FREE_BUFFER(buf, words * sizeof(uint32_t));
+      return err;
+   }
+
+   for (i = 0; i < 3; ++i) {
+      uint32_t root, scale;
+
+      s_prime_setup(i, &P[i]);
+      root = s_powmod(P[i].g, (P[i].p - 1u) >> lg, P[i].p);
+      s_roots(w, n, root, &P[i]);
+      s_roots(wi, n, s_powmod(root, P[i].p - 2u, P[i].p), &P[i]);
+
+      /* 1/n, times 2^64 to cancel the two Montgomery reductions below */
+      scale = (uint32_t)(((uint64_t)s_powmod((uint32_t)n, P[i].p - 2u, P[i].p) * P[i].r2) % P[i].p);
+
+      s_load(a, r[i], n, P[i].p);
+      s_dif(r[i], n, w, &P[i]);
+      if (sqr == AMPLIFY_MP_YES) {
+         for (k = 0u; k < n; ++k) {
+            r[i][k] = s_mulm(s_mulm(r[i][k], r[i][k], &P[i]), scale, &P[i]);
+         }
+      } else {
+         s_load(b, fb, n, P[i].p);
+         s_dif(fb, n, w, &P[i]);
+         for (k = 0u; k < n; ++k) {
+            r[i][k] = s_mulm(s_mulm(r[i][k], fb[k], &P[i]), scale, &P[i]);
+         }
+      }
+      s_dit(r[i], n, wi, &P[i]);
+   }
+
+   /* Garner: x = x0 + p0*(x1 + p1*x2) */
+   inv01 = s_powmod(P[0].p % P[1].p, P[1].p - 2u, P[1].p);
+   p01 = (uint64_t)P[0].p * P[1].p;
+   p01_2 = (uint32_t)(p01 % P[2].p);
+   inv012 = s_powmod(p01_2, P[2].p - 2u, P[2].p);
+
+   /* carry propagation in base 2^AMPLIFY_MP_FFT_BITS through a 128-bit hi:lo */
+   lo = hi = 0u;
+   for (k = 0u; k < ncoeff; ++k) {
+      uint64_t x0, x1, x2, low, mid, s;
+
+      x0 = r[0][k];
+      x1 = ((uint64_t)s_subm(r[1][k], (uint32_t)(x0 % P[1].p), P[1].p) * inv01) % P[1].p;
+      s = (x0 + (x1 * P[0].p)) % P[2].p;
+      x2 = ((uint64_t)s_subm(r[2][k], (uint32_t)s, P[2].p) * inv012) % P[2].p;
+
+      /* hi:lo += x0 + p0*x1 + p01*x2, where p01*x2 needs up to 92 bits */
+      low = (p01 & 0xFFFFFFFFu) * x2;
+      mid = (p01 >> 32) * x2;
+      s = x0 + (x1 * P[0].p);
+      lo += s;
+      hi += (lo < s) ? 1u : 0u;
+      lo += low;
+      hi += (lo < low) ? 1u : 0u;
+      lo += mid << 32;
+      hi += (lo < (mid << 32)) ? 1u : 0u;
+      hi += mid >> 32;
+
+      if ((k % S_COEFFS_PER_DIGIT) == 0u) {
+         t.dp[k / S_COEFFS_PER_DIGIT] = 0u;
+      }
+      t.dp[k / S_COEFFS_PER_DIGIT] |= ((amplify_mp_digit)lo & S_COEFF_MASK) << ((k % S_COEFFS_PER_DIGIT) * AMPLIFY_MP_FFT_BITS);
+      lo = (lo >> AMPLIFY_MP_FFT_BITS) | (hi << (64 - AMPLIFY_MP_FFT_BITS));
+      hi >>= AMPLIFY_MP_FFT_BITS;
+   }
+   t.used = a->used + b->used;
+   amplify_mp_clamp(&t);
+   amplify_mp_exch(&t, c);
+
+   amplify_mp_clear(&t);
+   AMPLIFY_MP_FREE_BUFFER(buf, words * sizeof(uint32_t));
+   return AMPLIFY_MP_OKAY;
+}
+
+#endif
@@ -0,0 +1,115 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_FROM_BIN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* linear time import of "count" words of "size" bytes each.
+ *
+ * Bits are shifted into an accumulator starting at the least
+ * significant byte and a digit is emitted whenever AMPLIFY_MP_DIGIT_BIT
+ * bits are available, so every input byte is touched exactly once.
+ *
+ * "endian" must already be resolved, i.e. not AMPLIFY_MP_NATIVE_ENDIAN.
+ */
+amplify_mp_err amplify_s_mp_from_bin(amplify_mp_int *a, const unsigned char *buf, size_t count, amplify_mp_order order,
+                                     size_t size, amplify_mp_endian endian, size_t nails)
+{
+   amplify_mp_err err;
+   amplify_mp_word acc;
+   size_t bits_per_word, nail_bytes, odd_nails, i, j, digits;
+   unsigned char odd_nail_mask;
+   int bits, x;
+
+   if ((nails >= (size * 8u)) && (count > 0u)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   bits_per_word = (size * 8u) - nails;
+   if ((count != 0u) && (bits_per_word > (((size_t)INT_MAX - (size_t)AMPLIFY_MP_DIGIT_BIT) / count))) {
+      return AMPLIFY_MP_VAL;
+   }
+   digits = ((count * bits_per_word) + (size_t)AMPLIFY_MP_DIGIT_BIT - 1u) / (size_t)AMPLIFY_MP_DIGIT_BIT;
+
+   /* make sure there are at least two digits */
+   if (a->alloc < AMPLIFY_MP_MAX((int)digits, 2)) {
+      if ((err = amplify_mp_grow(a, AMPLIFY_MP_MAX((int)digits, 2))) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+   }
+
+   /* zero the int */
+   amplify_mp_zero(a);
+
+   acc  = 0u;
+   bits = 0;
+   x    = 0;
+
+   if ((nails == 0u) && (order == AMPLIFY_MP_MSB_FIRST) && ((size == 1u) || (endian == AMPLIFY_MP_BIG_ENDIAN))) {
+      /* the input is one contiguous big endian byte string */
+      const unsigned char *p = buf + (count * size);
+      size_t n = count * size;
+
+#ifdef AMPLIFY_MP_64BIT
+      /* consume 64 bits at a time, compilers fold this into a single byte-swapping load */
+      while (n >= 8u) {
+         uint64_t w;
+         p -= 8;
+         w = ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) | ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+             ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) | ((uint64_t)p[6] << 8)  | (uint64_t)p[7];
+         acc  |= (amplify_mp_word)w << bits;
+         bits += 64;
+         while (bits >= AMPLIFY_MP_DIGIT_BIT) {
+            a->dp[x++] = (amplify_mp_digit)acc & AMPLIFY_MP_MASK;
+            acc      >>= AMPLIFY_MP_DIGIT_BIT;
+            bits      -= AMPLIFY_MP_DIGIT_BIT;
+         }
+         n -= 8u;
+      }
+#endif
+      while (n-- > 0u) {
+         acc  |= (amplify_mp_word)*--p << bits;
+         bits += 8;
+         while (bits >= AMPLIFY_MP_DIGIT_BIT) {
+            a->dp[x++] = (amplify_mp_digit)acc & AMPLIFY_MP_MASK;
+            acc      >>= AMPLIFY_MP_DIGIT_BIT;
+            bits      -= AMPLIFY_MP_DIGIT_BIT;
+         }
+      }
+   } else {
+      odd_nails = (nails % 8u);
+      odd_nail_mask = (unsigned char)(0xFFu >> odd_nails);
+      nail_bytes = nails / 8u;
+
+      /* words from least to most significant, bytes likewise */
+      for (i = 0u; i < count; ++i) {
+         const unsigned char *w = buf + (((order == AMPLIFY_MP_LSB_FIRST) ? i : ((count - 1u) - i)) * size);
+         for (j = 0u; j < (size - nail_bytes); ++j) {
+            unsigned char byte = w[(endian == AMPLIFY_MP_LITTLE_ENDIAN) ? j : ((size - 1u) - j)];
+            int nbits = 8;
+
+            if (j == ((size - nail_bytes) - 1u)) {
+               byte  &= odd_nail_mask;
+               nbits -= (int)odd_nails;
+            }
+
+            acc  |= (amplify_mp_word)byte << bits;
+            bits += nbits;
+            while (bits >= AMPLIFY_MP_DIGIT_BIT) {
+               a->dp[x++] = (amplify_mp_digit)acc & AMPLIFY_MP_MASK;
+               acc      >>= AMPLIFY_MP_DIGIT_BIT;
+               bits      -= AMPLIFY_MP_DIGIT_BIT;
+            }
+         }
+      }
+   }
+
+   if (bits > 0) {
+      a->dp[x++] = (amplify_mp_digit)acc & AMPLIFY_MP_MASK;
+   }
+
+   a->used = x;
+   amplify_mp_clamp(a);
+   return AMPLIFY_MP_OKAY;
+}
+#endif
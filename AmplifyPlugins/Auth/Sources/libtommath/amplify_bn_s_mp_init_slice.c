@@ -0,0 +1,25 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_INIT_SLICE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* initializes "out" to the magnitude of digits [from, from + count) of a,
+ * digits past a->used read as zero; used to split operands for Toom-Cook
+ */
+amplify_mp_err amplify_s_mp_init_slice(amplify_mp_int *out, const amplify_mp_int *a, int from, int count)
+{
+   amplify_mp_err err;
+   int ix;
+
+   if ((err = amplify_mp_init_size(out, AMPLIFY_MP_MAX(count, 1))) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   for (ix = 0; (ix < count) && ((from + ix) < a->used); ix++) {
+      out->dp[ix] = a->dp[from + ix];
+   }
+   out->used = ix;
+   amplify_mp_clamp(out);
+   return AMPLIFY_MP_OKAY;
+}
+#endif
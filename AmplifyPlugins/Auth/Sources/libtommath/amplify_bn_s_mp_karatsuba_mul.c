@@ -9,167 +9,182 @@
  *
  * Let B represent the radix [e.g. 2**AMPLIFY_MP_DIGIT_BIT] and
  * let n represent half of the number of digits in
- * the min(a,b)
+ * the max(a,b)
  *
  * a = a1 * B**n + a0
  * b = b1 * B**n + b0
  *
  * Then, a * b =>
-   a1b1 * B**2n + ((a1 + a0)(b1 + b0) - (a0b0 + a1b1)) * B + a0b0
+   a1b1 * B**2n + (a0b0 + a1b1 - (a0 - a1)(b0 - b1)) * B**n + a0b0
  *
  * Note that a1b1 and a0b0 are used twice and only need to be
  * computed once.  So in total three half size (half # of
  * digit) multiplications are performed, a0b0, a1b1 and
- * (a1+b1)(a0+b0)
+ * (a0-a1)(b0-b1)
  *
  * Note that a multiplication of half the digits requires
  * 1/4th the number of single precision multiplications so in
  * total after one call 25% of the single precision multiplications
- * are saved.  Note also that the call to amplify_mp_mul can end up back
- * in this function if the a0, a1, b0, or b1 are above the threshold.
- * This is known as divide-and-conquer and leads to the famous
- * O(N**lg(3)) or O(N**1.584) work which is asymptopically lower than
- * the standard O(N**2) that the baseline/comba methods use.
+ * are saved.  This is known as divide-and-conquer and leads to the
+ * famous O(N**lg(3)) or O(N**1.584) work which is asymptopically lower
+ * than the standard O(N**2) that the baseline/comba methods use.
  * Generally though the overhead of this method doesn't pay off
  * until a certain size (N ~ 80) is reached.
+ *
+ * The recursion works on raw digit spans. The differences |a0 - a1| and
+ * |b0 - b1| fit in n digits, so nothing grows from level to level and one
+ * scratch area sized up front serves all of them: no allocation, clamping
+ * or zeroing happens below the top.
  */
-amplify_mp_err amplify_s_mp_karatsuba_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
-{
-   amplify_mp_int  x0, x1, y0, y1, t1, x0y0, x1y1;
-   int     B;
-   amplify_mp_err  err = AMPLIFY_MP_MEM; /* default the return code to an error */
 
-   /* min # of digits */
-   B = AMPLIFY_MP_MIN(a->used, b->used);
+/* the recursion stops below the cutoff, it needs at least two digits to split */
+#define S_LEAF AMPLIFY_MP_MAX(AMPLIFY_MP_KARATSUBA_MUL_CUTOFF, 2)
 
-   /* now divide in two */
-   B = B >> 1;
-
-   /* init copy all the temps */
-   if (amplify_mp_init_size(&x0, B) != AMPLIFY_MP_OKAY) {
-      goto LBL_ERR;
-   }
-   if (amplify_mp_init_size(&x1, a->used - B) != AMPLIFY_MP_OKAY) {
-      goto X0;
-   }
-   if (amplify_mp_init_size(&y0, B) != AMPLIFY_MP_OKAY) {
-      goto X1;
-   }
-   if (amplify_mp_init_size(&y1, b->used - B) != AMPLIFY_MP_OKAY) {
-      goto Y0;
+/* r[0..na+nb) = a * b for na >= nb, schoolbook */
+static void s_mul_base(amplify_mp_digit *r, const amplify_mp_digit *a, int na, const amplify_mp_digit *b, int nb)
+{
+   amplify_mp_word _W;
+   int ix, iy;
+
+   if (nb == 0) {
+      AMPLIFY_MP_ZERO_DIGITS(r, na);
+      return;
+   }
+
+   /* comba, see amplify_s_mp_mul_digs_fast, the columns sum at most nb products */
+   if (nb < AMPLIFY_MP_MAXFAST) {
+      _W = 0;
+      for (ix = 0; ix < ((na + nb) - 1); ix++) {
+         int ty = AMPLIFY_MP_MIN(nb - 1, ix),
+             tx = ix - ty,
+             iz = AMPLIFY_MP_MIN(na - tx, ty + 1);
+         const amplify_mp_digit *tmpx = a + tx, *tmpy = b + ty;
+
+         for (iy = 0; iy < iz; ++iy) {
+            _W += (amplify_mp_word)*tmpx++ * (amplify_mp_word)*tmpy--;
+         }
+         r[ix] = (amplify_mp_digit)_W & AMPLIFY_MP_MASK;
+         _W = _W >> (amplify_mp_word)AMPLIFY_MP_DIGIT_BIT;
+      }
+      r[ix] = (amplify_mp_digit)_W;
+      return;
+   }
+
+   /* row by row, see amplify_s_mp_mul_digs */
+   AMPLIFY_MP_ZERO_DIGITS(r, na);
+   for (ix = 0; ix < nb; ix++) {
+      amplify_mp_digit u = 0;
+      for (iy = 0; iy < na; iy++) {
+         _W = (amplify_mp_word)r[ix + iy] + ((amplify_mp_word)a[iy] * (amplify_mp_word)b[ix]) + (amplify_mp_word)u;
+         r[ix + iy] = (amplify_mp_digit)(_W & (amplify_mp_word)AMPLIFY_MP_MASK);
+         u = (amplify_mp_digit)(_W >> (amplify_mp_word)AMPLIFY_MP_DIGIT_BIT);
+      }
+      r[ix + na] = u;
    }
+}
 
-   /* init temps */
-   if (amplify_mp_init_size(&t1, B * 2) != AMPLIFY_MP_OKAY) {
-      goto Y1;
-   }
-   if (amplify_mp_init_size(&x0y0, B * 2) != AMPLIFY_MP_OKAY) {
-      goto T1;
+/* digits of scratch s_mul needs for an na x nb product */
+static int s_scratch(int na, int nb)
+{
+   int n;
+
+   if (nb < S_LEAF) {
+      return 0;
    }
-   if (amplify_mp_init_size(&x1y1, B * 2) != AMPLIFY_MP_OKAY) {
-      goto X0Y0;
+   n = (na + 1) / 2;
+   if (nb <= n) {
+      return (2 * nb) + AMPLIFY_MP_MAX(s_scratch(nb, nb), s_scratch(nb, na % nb));
    }
+   return (2 * n) + AMPLIFY_MP_MAX((2 * n) + 1, AMPLIFY_MP_MAX(s_scratch(n, n), s_scratch(na - n, nb - n)));
+}
 
-   /* now shift the digits */
-   x0.used = y0.used = B;
-   x1.used = a->used - B;
-   y1.used = b->used - B;
-
-   {
-      int x;
-      amplify_mp_digit *tmpa, *tmpb, *tmpx, *tmpy;
-
-      /* we copy the digits directly instead of using higher level functions
-       * since we also need to shift the digits
-       */
-      tmpa = a->dp;
-      tmpb = b->dp;
-
-      tmpx = x0.dp;
-      tmpy = y0.dp;
-      for (x = 0; x < B; x++) {
-         *tmpx++ = *tmpa++;
-         *tmpy++ = *tmpb++;
+/* r[0..na+nb) = a * b for na >= nb, r must not overlap a, b or t */
+static void s_mul(amplify_mp_digit *r, const amplify_mp_digit *a, int na, const amplify_mp_digit *b, int nb, amplify_mp_digit *t)
+{
+   amplify_mp_digit *z;
+   amplify_mp_bool neg, negb;
+   int n, s, u, len, off;
+
+   if (nb < S_LEAF) {
+      s_mul_base(r, a, na, b, nb);
+      return;
+   }
+
+   n = (na + 1) / 2;
+
+   /* too lopsided to split evenly, multiply nb sized slices of a */
+   if (nb <= n) {
+      AMPLIFY_MP_ZERO_DIGITS(r, na + nb);
+      for (off = 0; off < na; off += nb) {
+         len = AMPLIFY_MP_MIN(nb, na - off);
+         if (len == nb) {
+            s_mul(t, a + off, len, b, nb, t + (len + nb));
+         } else {
+            s_mul(t, b, nb, a + off, len, t + (len + nb));
+         }
+         (void)amplify_s_mp_add_span(r + off, r + off, (na + nb) - off, t, len + nb);
       }
+      return;
+   }
 
-      tmpx = x1.dp;
-      for (x = B; x < a->used; x++) {
-         *tmpx++ = *tmpa++;
-      }
+   s = na - n;
+   u = nb - n;
 
-      tmpy = y1.dp;
-      for (x = B; x < b->used; x++) {
-         *tmpy++ = *tmpb++;
-      }
-   }
+   /* t = (a0 - a1)(b0 - b1), the differences are staged in r */
+   neg = amplify_s_mp_diff_span(r, a, n, a + n, s);
+   negb = amplify_s_mp_diff_span(r + n, b, n, b + n, u);
+   s_mul(t, r, n, r + n, n, t + (2 * n));
 
-   /* only need to clamp the lower words since by definition the
-    * upper words x1/y1 must have a known number of digits
-    */
-   amplify_mp_clamp(&x0);
-   amplify_mp_clamp(&y0);
+   /* r = a1b1 * B**2n + a0b0 */
+   s_mul(r, a, n, b, n, t + (2 * n));
+   s_mul(r + (2 * n), a + n, s, b + n, u, t + (2 * n));
 
-   /* now calc the products x0y0 and x1y1 */
-   /* after this x0 is no longer required, free temp [x0==t2]! */
-   if (amplify_mp_mul(&x0, &y0, &x0y0) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* x0y0 = x0*y0 */
-   }
-   if (amplify_mp_mul(&x1, &y1, &x1y1) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* x1y1 = x1*y1 */
+   /* z = a0b0 + a1b1 - (a0 - a1)(b0 - b1) */
+   z = t + (2 * n);
+   z[2 * n] = amplify_s_mp_add_span(z, r, 2 * n, r + (2 * n), s + u);
+   if (neg != negb) {
+      (void)amplify_s_mp_add_span(z, z, (2 * n) + 1, t, 2 * n);
+   } else {
+      (void)amplify_s_mp_sub_span(z, z, (2 * n) + 1, t, 2 * n);
    }
 
-   /* now calc x1+x0 and y1+y0 */
-   if (amplify_s_mp_add(&x1, &x0, &t1) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t1 = x1 - x0 */
-   }
-   if (amplify_s_mp_add(&y1, &y0, &x0) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t2 = y1 - y0 */
-   }
-   if (amplify_mp_mul(&t1, &x0, &t1) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t1 = (x1 + x0) * (y1 + y0) */
-   }
+   /* the product fits in na + nb digits, so z can only spill zeros past it */
+   len = AMPLIFY_MP_MIN((2 * n) + 1, (na + nb) - n);
+   (void)amplify_s_mp_add_span(r + n, r + n, (na + nb) - n, z, len);
+}
 
-   /* add x0y0 */
-   if (amplify_mp_add(&x0y0, &x1y1, &x0) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t2 = x0y0 + x1y1 */
-   }
-   if (amplify_s_mp_sub(&t1, &x0, &t1) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t1 = (x1+x0)*(y1+y0) - (x1y1 + x0y0) */
-   }
+amplify_mp_err amplify_s_mp_karatsuba_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   amplify_mp_int  t;
+   amplify_mp_digit *scratch;
+   amplify_mp_err  err;
+   size_t  size;
 
-   /* shift by B */
-   if (amplify_mp_lshd(&t1, B) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t1 = (x0y0 + x1y1 - (x1-x0)*(y1-y0))<<B */
-   }
-   if (amplify_mp_lshd(&x1y1, B * 2) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* x1y1 = x1y1 << 2*B */
+   /* Make sure that a is the larger one */
+   if (a->used < b->used) {
+      const amplify_mp_int *x = a;
+      a = b;
+      b = x;
    }
 
-   if (amplify_mp_add(&x0y0, &t1, &t1) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t1 = x0y0 + t1 */
+   size = (size_t)AMPLIFY_MP_MAX(s_scratch(a->used, b->used), 1) * sizeof(amplify_mp_digit);
+   scratch = (amplify_mp_digit *) AMPLIFY_MP_MALLOC(size);
+   if (scratch == NULL) {
+      return AMPLIFY_MP_MEM;
    }
-   if (amplify_mp_add(&t1, &x1y1, c) != AMPLIFY_MP_OKAY) {
-      goto X1Y1;          /* t1 = x0y0 + t1 + x1y1 */
+
+   if ((err = amplify_mp_init_size(&t, a->used + b->used)) != AMPLIFY_MP_OKAY) {
+      goto LBL_ERR;
    }
 
-   /* Algorithm succeeded set the return code to AMPLIFY_MP_OKAY */
-   err = AMPLIFY_MP_OKAY;
-
-X1Y1:
-   amplify_mp_clear(&x1y1);
-X0Y0:
-   amplify_mp_clear(&x0y0);
-T1:
-   amplify_mp_clear(&t1);
-Y1:
-   amplify_mp_clear(&y1);
-Y0:
-   amplify_mp_clear(&y0);
-X1:
-   amplify_mp_clear(&x1);
-X0:
-   amplify_mp_clear(&x0);
+   s_mul(t.dp, a->dp, a->used, b->dp, b->used, scratch);
+   t.used = a->used + b->used;
+   amplify_mp_clamp(&t);
+   amplify_mp_exch(&t, c);
+
+   amplify_mp_clear(&t);
 LBL_ERR:
+   AMPLIFY_MP_FREE_BUFFER(scratch, size);
    return err;
 }
 #endif
@@ -9,103 +9,139 @@
  *
  * See comments of karatsuba_mul for details.  It
  * is essentially the same algorithm but merely
- * tuned to perform recursive squarings.
+ * tuned to perform recursive squarings, the middle
+ * term a0a0 + a1a1 - (a0 - a1)**2 never needs a sign.
  */
-amplify_mp_err amplify_s_mp_karatsuba_sqr(const amplify_mp_int *a, amplify_mp_int *b)
-{
-   amplify_mp_int  x0, x1, t1, t2, x0x0, x1x1;
-   int     B;
-   amplify_mp_err  err = AMPLIFY_MP_MEM;
 
-   /* min # of digits */
-   B = a->used;
+/* the recursion stops below the cutoff, it needs at least two digits to split */
+#define S_LEAF AMPLIFY_MP_MAX(AMPLIFY_MP_KARATSUBA_SQR_CUTOFF, 2)
 
-   /* now divide in two */
-   B = B >> 1;
-
-   /* init copy all the temps */
-   if (amplify_mp_init_size(&x0, B) != AMPLIFY_MP_OKAY)
-      goto LBL_ERR;
-   if (amplify_mp_init_size(&x1, a->used - B) != AMPLIFY_MP_OKAY)
-      goto X0;
-
-   /* init temps */
-   if (amplify_mp_init_size(&t1, a->used * 2) != AMPLIFY_MP_OKAY)
-      goto X1;
-   if (amplify_mp_init_size(&t2, a->used * 2) != AMPLIFY_MP_OKAY)
-      goto T1;
-   if (amplify_mp_init_size(&x0x0, B * 2) != AMPLIFY_MP_OKAY)
-      goto T2;
-   if (amplify_mp_init_size(&x1x1, (a->used - B) * 2) != AMPLIFY_MP_OKAY)
-      goto X0X0;
-
-   {
-      int x;
-      amplify_mp_digit *dst, *src;
-
-      src = a->dp;
-
-      /* now shift the digits */
-      dst = x0.dp;
-      for (x = 0; x < B; x++) {
-         *dst++ = *src++;
+/* r[0..2n) = a * a, schoolbook */
+static void s_sqr_base(amplify_mp_digit *r, const amplify_mp_digit *a, int n)
+{
+   amplify_mp_word _W, W1;
+   int ix, iy, iz;
+
+   /* comba, see amplify_s_mp_sqr_fast */
+   if (n < (AMPLIFY_MP_MAXFAST / 2)) {
+      W1 = 0;
+      for (ix = 0; ix < (2 * n); ix++) {
+         int ty = AMPLIFY_MP_MIN(n - 1, ix),
+             tx = ix - ty,
+             iw = AMPLIFY_MP_MIN(n - tx, ty + 1);
+         const amplify_mp_digit *tmpx = a + tx, *tmpy = a + ty;
+
+         /* the off diagonal products, doubled */
+         iw = AMPLIFY_MP_MIN(iw, ((ty - tx) + 1) >> 1);
+         _W = 0;
+         for (iz = 0; iz < iw; iz++) {
+            _W += (amplify_mp_word)*tmpx++ * (amplify_mp_word)*tmpy--;
+         }
+         _W = _W + _W + W1;
+
+         /* even columns have the square term in them */
+         if (((unsigned)ix & 1u) == 0u) {
+            _W += (amplify_mp_word)a[ix >> 1] * (amplify_mp_word)a[ix >> 1];
+         }
+         r[ix] = (amplify_mp_digit)_W & AMPLIFY_MP_MASK;
+         W1 = _W >> (amplify_mp_word)AMPLIFY_MP_DIGIT_BIT;
       }
+      return;
+   }
 
-      dst = x1.dp;
-      for (x = B; x < a->used; x++) {
-         *dst++ = *src++;
+   /* row by row, see amplify_s_mp_sqr */
+   AMPLIFY_MP_ZERO_DIGITS(r, 2 * n);
+   for (ix = 0; ix < n; ix++) {
+      amplify_mp_digit u, *tmpt;
+
+      _W = (amplify_mp_word)r[2 * ix] + ((amplify_mp_word)a[ix] * (amplify_mp_word)a[ix]);
+      r[2 * ix] = (amplify_mp_digit)(_W & (amplify_mp_word)AMPLIFY_MP_MASK);
+      u = (amplify_mp_digit)(_W >> (amplify_mp_word)AMPLIFY_MP_DIGIT_BIT);
+
+      tmpt = r + ((2 * ix) + 1);
+      for (iy = ix + 1; iy < n; iy++) {
+         W1 = (amplify_mp_word)a[ix] * (amplify_mp_word)a[iy];
+         _W = (amplify_mp_word)*tmpt + W1 + W1 + (amplify_mp_word)u;
+         *tmpt++ = (amplify_mp_digit)(_W & (amplify_mp_word)AMPLIFY_MP_MASK);
+         u = (amplify_mp_digit)(_W >> (amplify_mp_word)AMPLIFY_MP_DIGIT_BIT);
       }
+      /* the partial sums never exceed the square, so this stops inside r */
+      while (u != 0u) {
+         _W = (amplify_mp_word)*tmpt + (amplify_mp_word)u;
+         *tmpt++ = (amplify_mp_digit)(_W & (amplify_mp_word)AMPLIFY_MP_MASK);
+         u = (amplify_mp_digit)(_W >> (amplify_mp_word)AMPLIFY_MP_DIGIT_BIT);
+      }
+   }
+}
+
+/* digits of scratch s_sqr needs for an n digit square */
+static int s_scratch(int n)
+{
+   int h;
+
+   if (n < S_LEAF) {
+      return 0;
    }
+   h = (n + 1) / 2;
+   return (2 * h) + AMPLIFY_MP_MAX((2 * h) + 1, s_scratch(h));
+}
+
+/* r[0..2n) = a * a, r must not overlap a or t */
+static void s_sqr(amplify_mp_digit *r, const amplify_mp_digit *a, int n, amplify_mp_digit *t)
+{
+   amplify_mp_digit *z;
+   int h, s;
+
+   if (n < S_LEAF) {
+      s_sqr_base(r, a, n);
+      return;
+   }
+
+   h = (n + 1) / 2;
+   s = n - h;
+
+   /* t = (a0 - a1)**2, the difference is staged in r */
+   (void)amplify_s_mp_diff_span(r, a, h, a + h, s);
+   s_sqr(t, r, h, t + (2 * h));
+
+   /* r = a1a1 * B**2h + a0a0 */
+   s_sqr(r, a, h, t + (2 * h));
+   s_sqr(r + (2 * h), a + h, s, t + (2 * h));
+
+   /* z = a0a0 + a1a1 - (a0 - a1)**2 */
+   z = t + (2 * h);
+   z[2 * h] = amplify_s_mp_add_span(z, r, 2 * h, r + (2 * h), 2 * s);
+   (void)amplify_s_mp_sub_span(z, z, (2 * h) + 1, t, 2 * h);
+
+   /* the square fits in 2n digits, so z can only spill zeros past it */
+   (void)amplify_s_mp_add_span(r + h, r + h, (2 * n) - h, z, AMPLIFY_MP_MIN((2 * h) + 1, (2 * n) - h));
+}
+
+amplify_mp_err amplify_s_mp_karatsuba_sqr(const amplify_mp_int *a, amplify_mp_int *b)
+{
+   amplify_mp_int  t;
+   amplify_mp_digit *scratch;
+   amplify_mp_err  err;
+   size_t  size;
+
+   size = (size_t)AMPLIFY_MP_MAX(s_scratch(a->used), 1) * sizeof(amplify_mp_digit);
+   scratch = (amplify_mp_digit *) AMPLIFY_MP_MALLOC(size);
+   if (scratch == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+
+   if ((err = amplify_mp_init_size(&t, 2 * a->used)) != AMPLIFY_MP_OKAY) {
+      goto LBL_ERR;
+   }
+
+   s_sqr(t.dp, a->dp, a->used, scratch);
+   t.used = 2 * a->used;
+   amplify_mp_clamp(&t);
+   amplify_mp_exch(&t, b);
 
-   x0.used = B;
-   x1.used = a->used - B;
-
-   amplify_mp_clamp(&x0);
-
-   /* now calc the products x0*x0 and x1*x1 */
-   if (amplify_mp_sqr(&x0, &x0x0) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* x0x0 = x0*x0 */
-   if (amplify_mp_sqr(&x1, &x1x1) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* x1x1 = x1*x1 */
-
-   /* now calc (x1+x0)**2 */
-   if (amplify_s_mp_add(&x1, &x0, &t1) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* t1 = x1 - x0 */
-   if (amplify_mp_sqr(&t1, &t1) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* t1 = (x1 - x0) * (x1 - x0) */
-
-   /* add x0y0 */
-   if (amplify_s_mp_add(&x0x0, &x1x1, &t2) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* t2 = x0x0 + x1x1 */
-   if (amplify_s_mp_sub(&t1, &t2, &t1) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* t1 = (x1+x0)**2 - (x0x0 + x1x1) */
-
-   /* shift by B */
-   if (amplify_mp_lshd(&t1, B) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* t1 = (x0x0 + x1x1 - (x1-x0)*(x1-x0))<<B */
-   if (amplify_mp_lshd(&x1x1, B * 2) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* x1x1 = x1x1 << 2*B */
-
-   if (amplify_mp_add(&x0x0, &t1, &t1) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* t1 = x0x0 + t1 */
-   if (amplify_mp_add(&t1, &x1x1, b) != AMPLIFY_MP_OKAY)
-      goto X1X1;           /* t1 = x0x0 + t1 + x1x1 */
-
-   err = AMPLIFY_MP_OKAY;
-
-X1X1:
-   amplify_mp_clear(&x1x1);
-X0X0:
-   amplify_mp_clear(&x0x0);
-T2:
-   amplify_mp_clear(&t2);
-T1:
-   amplify_mp_clear(&t1);
-X1:
-   amplify_mp_clear(&x1);
-X0:
-   amplify_mp_clear(&x0);
+   amplify_mp_clear(&t);
 LBL_ERR:
+   AMPLIFY_MP_FREE_BUFFER(scratch, size);
    return err;
 }
 #endif
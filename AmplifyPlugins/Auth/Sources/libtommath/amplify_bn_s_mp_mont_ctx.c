@@ -0,0 +1,83 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_MONT_CTX_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* Montgomery arithmetic modulo a fixed odd n
+ *
+ * The context is set up once per modulus, afterwards every product costs one
+ * multiplication and one Montgomery reduction, no division.  Values in the
+ * domain are x*R mod n with R = 2^(AMPLIFY_MP_DIGIT_BIT * n->used), all of
+ * them in [0, n).
+ */
+
+amplify_mp_err amplify_s_mp_mont_init(amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *n)
+{
+   amplify_mp_err err;
+
+   if (AMPLIFY_MP_IS_EVEN(n) || (amplify_mp_cmp_d(n, 1uL) != AMPLIFY_MP_GT)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   ctx->n = n;
+   if ((err = amplify_mp_montgomery_setup(n, &ctx->rho)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_init_multi(&ctx->one, &ctx->minus_one, &ctx->rr, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /* R mod n, n - (R mod n) and R^2 mod n, the only division of the context */
+   if ((err = amplify_mp_montgomery_calc_normalization(&ctx->one, n)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   if ((err = amplify_mp_sub(n, &ctx->one, &ctx->minus_one)) != AMPLIFY_MP_OKAY)          goto LBL_ERR;
+   if ((err = amplify_mp_sqrmod(&ctx->one, n, &ctx->rr)) != AMPLIFY_MP_OKAY)              goto LBL_ERR;
+
+   return AMPLIFY_MP_OKAY;
+
+LBL_ERR:
+   amplify_s_mp_mont_clear(ctx);
+   return err;
+}
+
+void amplify_s_mp_mont_clear(amplify_s_mp_mont_ctx *ctx)
+{
+   amplify_mp_clear_multi(&ctx->one, &ctx->minus_one, &ctx->rr, NULL);
+}
+
+/* c = a*b/R mod n */
+amplify_mp_err amplify_s_mp_mont_mul(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   amplify_mp_err err;
+   if ((err = amplify_mp_mul(a, b, c)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_mp_montgomery_reduce(c, ctx->n, ctx->rho);
+}
+
+/* c = a*a/R mod n */
+amplify_mp_err amplify_s_mp_mont_sqr(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *c)
+{
+   amplify_mp_err err;
+   if ((err = amplify_mp_sqr(a, c)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_mp_montgomery_reduce(c, ctx->n, ctx->rho);
+}
+
+/* c = a*R mod n for 0 <= a < n */
+amplify_mp_err amplify_s_mp_mont_to(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *c)
+{
+   return amplify_s_mp_mont_mul(ctx, a, &ctx->rr, c);
+}
+
+/* c = a/R mod n */
+amplify_mp_err amplify_s_mp_mont_from(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *c)
+{
+   amplify_mp_err err;
+   if ((err = amplify_mp_copy(a, c)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   return amplify_mp_montgomery_reduce(c, ctx->n, ctx->rho);
+}
+#endif
@@ -0,0 +1,94 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_MONT_EXPTMOD_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* Y = G**X in the Montgomery domain of ctx, G and Y are in the domain, X >= 0
+ *
+ * Left-to-right sliding window over the odd powers of G, like
+ * amplify_s_mp_exptmod_fast but without setting up the reduction again.
+ */
+
+#ifdef AMPLIFY_MP_LOW_MEM
+#   define MAX_WINSIZE 4
+#else
+#   define MAX_WINSIZE 6
+#endif
+
+amplify_mp_err amplify_s_mp_mont_exptmod(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *G, const amplify_mp_int *X, amplify_mp_int *Y)
+{
+   amplify_mp_int M[1 << (MAX_WINSIZE - 1)], G2, res;
+   int    bits, winsize, i, j, w, x;
+   amplify_mp_err err;
+
+   if (X->sign == AMPLIFY_MP_NEG) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   bits = amplify_mp_count_bits(X);
+   if (bits <= 7) {
+      winsize = 2;
+   } else if (bits <= 36) {
+      winsize = 3;
+   } else if (bits <= 140) {
+      winsize = 4;
+   } else if (bits <= 450) {
+      winsize = 5;
+   } else {
+      winsize = 6;
+   }
+   winsize = AMPLIFY_MP_MIN(winsize, MAX_WINSIZE);
+
+   if ((err = amplify_mp_init_multi(&G2, &res, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   for (i = 0; i < (1 << (winsize - 1)); i++) {
+      if ((err = amplify_mp_init_size(&M[i], ctx->n->alloc)) != AMPLIFY_MP_OKAY) {
+         goto LBL_M;
+      }
+   }
+
+   /* M[i] = G**(2i+1) */
+   if ((err = amplify_mp_copy(G, &M[0])) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   if ((err = amplify_s_mp_mont_sqr(ctx, G, &G2)) != AMPLIFY_MP_OKAY)         goto LBL_ERR;
+   for (j = 1; j < (1 << (winsize - 1)); j++) {
+      if ((err = amplify_s_mp_mont_mul(ctx, &M[j - 1], &G2, &M[j])) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   }
+
+   if ((err = amplify_mp_copy(&ctx->one, &res)) != AMPLIFY_MP_OKAY)          goto LBL_ERR;
+
+   i = bits - 1;
+   while (i >= 0) {
+      if (amplify_s_mp_get_bit(X, (unsigned int)i) == AMPLIFY_MP_NO) {
+         if ((err = amplify_s_mp_mont_sqr(ctx, &res, &res)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+         --i;
+         continue;
+      }
+
+      /* longest window X[i..j] of at most winsize bits that ends in a one */
+      j = AMPLIFY_MP_MAX(i - winsize + 1, 0);
+      while (amplify_s_mp_get_bit(X, (unsigned int)j) == AMPLIFY_MP_NO) {
+         ++j;
+      }
+      w = 0;
+      for (x = i; x >= j; x--) {
+         w = (w << 1) | ((amplify_s_mp_get_bit(X, (unsigned int)x) == AMPLIFY_MP_YES) ? 1 : 0);
+         if ((err = amplify_s_mp_mont_sqr(ctx, &res, &res)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      }
+      if ((err = amplify_s_mp_mont_mul(ctx, &res, &M[w >> 1], &res)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      i = j - 1;
+   }
+
+   amplify_mp_exch(&res, Y);
+
+LBL_ERR:
+   i = 1 << (winsize - 1);
+LBL_M:
+   while (--i >= 0) {
+      amplify_mp_clear(&M[i]);
+   }
+   amplify_mp_clear_multi(&G2, &res, NULL);
+   return err;
+}
+#endif
@@ -12,7 +12,7 @@
  *
  * Based on Algorithm 14.32 on pp.601 of HAC.
 */
-amplify_mp_err amplify_s_mp_montgomery_reduce_fast(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit rho)
+static amplify_mp_err s_mp_montgomery_reduce_fast(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit rho)
 {
    int     ix, olduse;
    amplify_mp_err  err;
@@ -157,4 +157,9 @@ amplify_mp_err amplify_s_mp_montgomery_reduce_fast(amplify_mp_int *x, const ampl
    }
    return AMPLIFY_MP_OKAY;
 }
+
+amplify_mp_err amplify_s_mp_montgomery_reduce_fast(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit rho)
+{
+   AMPLIFY_MP_STATS_TIMED(AMPLIFY_MP_STATS_REDUCE, x->used, s_mp_montgomery_reduce_fast(x, n, rho));
+}
 #endif
@@ -0,0 +1,48 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_PRIME_IS_CANDIDATE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* p passes amplify_mp_prime_is_prime and, with "safe", so does (p-1)/2.
+ * A Miller-Rabin round to base 2 on p weeds out most composites before the
+ * full test of (p-1)/2.
+ *
+ * If "cancelled" is not NULL it is asked with "dat" after every stage, once
+ * it returns AMPLIFY_MP_YES the candidate is given up with result set to 0.
+ */
+amplify_mp_err amplify_s_mp_prime_is_candidate(const amplify_mp_int *p, int t, amplify_mp_bool safe,
+      private_amplify_mp_prime_cancelled cancelled, void *dat, amplify_mp_bool *result)
+{
+   amplify_mp_int q;
+   amplify_mp_err err;
+
+   *result = AMPLIFY_MP_NO;
+
+   if (safe == AMPLIFY_MP_NO) {
+      return amplify_mp_prime_is_prime(p, t, result);
+   }
+
+   if ((err = amplify_mp_init_set(&q, 2uL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_prime_miller_rabin(p, &q, result)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   if (*result == AMPLIFY_MP_NO)                                                goto LBL_ERR;
+   if ((cancelled != NULL) && (cancelled(dat) == AMPLIFY_MP_YES))               goto LBL_NO;
+
+   if ((err = amplify_mp_sub_d(p, 1uL, &q)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&q, &q)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_prime_is_prime(&q, t, result)) != AMPLIFY_MP_OKAY)     goto LBL_ERR;
+   if (*result == AMPLIFY_MP_NO)                                                goto LBL_ERR;
+   if ((cancelled != NULL) && (cancelled(dat) == AMPLIFY_MP_YES))               goto LBL_NO;
+
+   err = amplify_mp_prime_is_prime(p, t, result);
+   goto LBL_ERR;
+
+LBL_NO:
+   *result = AMPLIFY_MP_NO;
+LBL_ERR:
+   amplify_mp_clear(&q);
+   return err;
+}
+#endif
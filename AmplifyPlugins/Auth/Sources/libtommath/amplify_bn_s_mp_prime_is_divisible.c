@@ -4,33 +4,204 @@
 /* SPDX-License-Identifier: Unlicense */
 /* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
 
+/* For the odd prime p = amplify_s_mp_prime_tab[ix] the residue r is divisible
+ * by p iff r * s_inv[ix] mod 2^64 <= s_lim[ix], where s_inv[ix] = p^-1 mod 2^64
+ * and s_lim[ix] = floor((2^64 - 1) / p).  Entry 0 belongs to 2 and is unused.
+ */
+static const uint64_t s_inv[] = {
+   0x0000000000000000u, 0xAAAAAAAAAAAAAAABu, 0xCCCCCCCCCCCCCCCDu, 0x6DB6DB6DB6DB6DB7u,
+   0x2E8BA2E8BA2E8BA3u, 0x4EC4EC4EC4EC4EC5u, 0xF0F0F0F0F0F0F0F1u, 0x86BCA1AF286BCA1Bu,
+   0xD37A6F4DE9BD37A7u, 0x34F72C234F72C235u, 0xEF7BDEF7BDEF7BDFu, 0x14C1BACF914C1BADu,
+   0x8F9C18F9C18F9C19u, 0x82FA0BE82FA0BE83u, 0x51B3BEA3677D46CFu, 0x21CFB2B78C13521Du,
+   0xCBEEA4E1A08AD8F3u, 0x4FBCDA3AC10C9715u, 0xF0B7672A07A44C6Bu, 0x193D4BB7E327A977u,
+   0x7E3F1F8FC7E3F1F9u, 0x9B8B577E613716AFu, 0xA3784A062B2E43DBu, 0xF47E8FD1FA3F47E9u,
+   0xA3A0FD5C5F02A3A1u, 0x3A4C0A237C32B16Du, 0xDAB7EC1DD3431B57u, 0x77A04C8F8D28AC43u,
+   0xA6C0964FDA6C0965u, 0x90FDBC090FDBC091u, 0x7EFDFBF7EFDFBF7Fu, 0x03E88CB3C9484E2Bu,
+   0xE21A291C077975B9u, 0x3AEF6CA970586723u, 0xDF5B0F768CE2CABDu, 0x6FE4DFC9BF937F27u,
+   0x5B4FE5E92C0685B5u, 0x1F693A1C451AB30Bu, 0x8D07AA27DB35A717u, 0x882383B30D516325u,
+   0xED6866F8D962AE7Bu, 0x3454DCA410F8ED9Du, 0x1D7CA632EE936F3Fu, 0x70BF015390948F41u,
+   0xC96BDB9D3D137E0Du, 0x2697CC8AEF46C0F7u, 0xC0E8F2A76E68575Bu, 0x687763DFDB43BB1Fu,
+   0x1B10EA929BA144CBu, 0x1D10C4C0478BBCEDu, 0x63FB9AEB1FDCD759u, 0x64AFAA4F437B2E0Fu,
+   0xF010FEF010FEF011u, 0x28CBFBEB9A020A33u, 0xFF00FF00FF00FF01u, 0xD624FD1470E99CB7u,
+   0x8FB3DDBD6205B5C5u, 0xD57DA36CA27ACDEFu, 0xEE70C03B25E4463Du, 0xC5B1A6B80749CB29u,
+   0x47768073C9B97113u, 0x2591E94884CE32ADu, 0xF02806ABC74BE1FBu, 0x7EC3E8F3A7198487u,
+   0x58550F8A39409D09u, 0xEC9E48AE6F71DE15u, 0x2FF3A018BFCE8063u, 0x7F9EC3FCF61FE7B1u,
+   0x89F5ABE570E046D3u, 0xDA971B23F1545AF5u, 0x79D5F00B9A7862A1u, 0x4DBA1DF32A128A57u,
+   0x87530217B7747D8Fu, 0x30BAAE53BB5E06DDu, 0xEE70206C12E9B5B3u, 0xCDDE9462EC9DBE7Fu,
+   0xAFB64B05EC41CF4Du, 0x02944FF5AEC02945u, 0x2CB033128382DF71u, 0x1CCACC0C84B1C2A9u,
+   0x19A93DB575EB3A0Bu, 0xCEBEEF94FA86FE2Du, 0x6FAA77FB3F8DF54Fu, 0x68A58AF00975A751u,
+   0xD56E36D0C3EFAC07u, 0xD8B44C47A8299B73u, 0x02D9CCAF9BA70E41u, 0x0985E1C023D9E879u,
+   0x2A343316C494D305u, 0x70CB7916AB67652Fu, 0xD398F132FB10FE5Bu, 0x6F2A38A6BF54FA1Fu,
+   0x211DF689B98F81D7u, 0x0E994983E90F1EC3u, 0xAD671E44BED87F3Bu, 0xF9623A0516E70FC7u,
+   0x4B7129BE9DECE355u, 0x190F3B7473F62C39u, 0x63DACC9AAD46F9A3u, 0xC1108FDA24E8D035u,
+   0xB77578472319BD8Bu, 0x473D20A1C7ED9DA5u, 0xFBE85AF0FEA2C8FBu, 0x58A1F7E6CE0F4C09u,
+   0x1A00E58C544986F3u, 0x7194A17F55A10DC1u, 0x7084944785E33763u, 0xBA10679BD84886B1u,
+   0xEBE9C6BB31260967u, 0x97A3FE4BD1FF25E9u, 0x6C6388395B84D99Fu, 0x8C51DA6A1335DF6Du,
+   0x46F3234475D5ADD9u, 0x905605CA3C619A43u, 0xCEE8DFF304767747u, 0xFF99C27F00663D81u,
+   0xACCA407F671DDC2Bu, 0xE71298BAC1E12337u, 0xFA1E94309CD09045u, 0xBEBCCB8E91496B9Bu,
+   0x312FA30CC7D7B8BDu, 0x6160FF9E9F006161u, 0x6B03673B5E28152Du, 0xFE802FFA00BFE803u,
+   0xE66FE25C9E907C7Bu, 0x3F8B236C76528895u, 0xF6F923BF01CE2C0Du, 0x6C3D3D98BED7C42Fu,
+   0x30981EFCD4B010E7u, 0x6F691FC81EBBE575u, 0xB10480DDB47B52CBu, 0x74CD59ED64F3F0D7u,
+   0x0105CB81316D6C0Fu, 0x9BE64C6D91C1195Du, 0x71B3F945A27B1F49u, 0x77D80D50E508FD01u,
+   0xA5EB778E133551CDu, 0x18657D3C2D8A3F1Bu, 0x2E40E220C34AD735u, 0xA76593C70A714919u,
+   0x1EEF452124EEA383u, 0x38206DC242BA771Du, 0x4CD4C35807772287u, 0x83DE917D5E69DDF3u,
+   0x882EF0403B4A6C15u, 0xF8FB6C51C606B677u, 0xB4ABAAC446D3E1FDu, 0xA9F83BBE484A14E9u,
+   0x0BEBBC0D1CE874D3u, 0xBD418EAF0473189Fu, 0x44E3AF6F372B7E65u, 0xC87FDACE4F9E5D91u,
+   0xEC93479C446BD9BBu, 0xDAC4D592E777C647u, 0xA63EA8C8F61F0C23u, 0xE476062EA5CBBB6Fu,
+   0xDF68761C69DAAC27u, 0xB813D737637AA061u, 0xA3A77AAC1FB15099u, 0x17F0C3E0712C5825u,
+   0xFD912A70FF30637Bu, 0xFBB3B5DC01131289u, 0x856D560A0F5ACDF7u, 0x96472F314D3F89E3u,
+   0xA76F5C7ED2253531u, 0x816EAE7C7BF69FE7u, 0xB6A2BEA4CFB1781Fu, 0xA3900C53318E81EDu,
+   0x60AA7F5D9F148D11u, 0x6BE8C0102C7A505Du, 0x8FF3F0ED28728F33u, 0x680E0A87E5EC7155u,
+   0xBBF70FA49FE829B7u, 0xD69D1E7B6A50CA39u, 0x1A1E0F46B6D26AEFu, 0x7429F9A7A8251829u,
+   0xD9C2219D1B863613u, 0x91406C1820D077ADu, 0x521F4EC02E3D2B97u, 0xBB8283B63DC8EBA5u,
+   0x431EDA153229EBBFu, 0xAF0BF78D7E01686Bu, 0xA9CED0742C086E8Du, 0xC26458AD9F632DF9u,
+   0xBBFF1255DFF892AFu, 0xCBD49A333F04D8FDu, 0xEC84ED6F9CFDEFF5u, 0x97980CC40BDA9D4Bu,
+   0x777F34D524F5CBD9u, 0x2797051D94CBBB7Fu, 0xEA769051B4F43B81u, 0xCE7910F3034D4323u,
+   0x92791D1374F5B99Bu, 0x89A5645CC68EA1B5u, 0x5F8AACF796C0CF0Bu, 0xF2E90A15E33EDF99u,
+   0x8E99E5FEB897C451u, 0xACA2EDA38FB91695u, 0x5D9B737BE5EA8B41u, 0x4AEFE1DB93FD7CF7u,
+   0xA0994EF20B3F8805u, 0x103890BDA912822Fu, 0xB441659D13A9147Du, 0x1E2134440C4C3F21u,
+   0x263A27727A6883C3u, 0x78E221472AB33855u, 0x95EAC88E82E6FAFFu, 0xF66C258317BE8DABu,
+   0x09EE202C7CB91939u, 0x8D2FCA1042A09EA3u, 0x82779C856D8B8BF1u, 0x3879361CBA8A223Du,
+   0xF23F43639C3182A7u, 0xA03868FC474BCD13u, 0x651E78B8C5311A97u, 0x8FFCE639C00C6719u,
+   0xF7B460754B0B61CFu, 0x7B03F3359B8E63B1u, 0xA55C5326041EB667u, 0x647F88AB896A76F5u,
+   0x8FD971434A55A46Du, 0x9FBF969958046447u, 0x9986FEBA69BE3A81u, 0xA668B3E6D053796Fu,
+   0x97694E6589F4E09Bu, 0x37890C00B7721DBDu, 0x5AC094A235F37EA9u, 0x31CFF775F2D5D65Fu,
+   0xDDAD8E6B36505217u, 0x5A27DF897062CD03u, 0xE2396FE0FDB5A625u, 0xB352A4957E82317Bu,
+   0xD8AB3F2C60C2EA3Fu, 0x6893F702F0452479u, 0x9686FDC182ACF7E3u, 0x6854037173DCE12Fu,
+   0x7F0DED1685C27331u, 0xEEDA72E1FE490B7Du, 0x9E7BFC959A8E6E53u, 0x49B314D6D4753DD7u,
+   0x2E8F8C5AC4AA1B3Bu, 0xB8EF723481163D33u, 0x6A2EC96A594287B7u, 0xDBA41C6D13AAB8C5u,
+   0xC2ADBE648DC3AAF1u, 0x87A2BADE565F91A7u, 0x4D6FE8798C01F5DFu, 0x3791310C8C23D98Bu,
+   0xF80E446B01228883u, 0x9AED1436FBF500CFu, 0x7839B54CC8B24115u, 0xC128C646AD0309C1u,
+   0x14DE631624A3C377u, 0x3F7B9FE68B0ECBF9u, 0x284FFD75EC00A285u, 0x37803CB80DEA2DDBu
+};
+
+static const uint64_t s_lim[] = {
+   0x0000000000000000u, 0x5555555555555555u, 0x3333333333333333u, 0x2492492492492492u,
+   0x1745D1745D1745D1u, 0x13B13B13B13B13B1u, 0x0F0F0F0F0F0F0F0Fu, 0x0D79435E50D79435u,
+   0x0B21642C8590B216u, 0x08D3DCB08D3DCB08u, 0x0842108421084210u, 0x06EB3E45306EB3E4u,
+   0x063E7063E7063E70u, 0x05F417D05F417D05u, 0x0572620AE4C415C9u, 0x04D4873ECADE304Du,
+   0x0456C797DD49C341u, 0x04325C53EF368EB0u, 0x03D226357E16ECE5u, 0x039B0AD12073615Au,
+   0x0381C0E070381C0Eu, 0x033D91D2A2067B23u, 0x03159721ED7E7534u, 0x02E05C0B81702E05u,
+   0x02A3A0FD5C5F02A3u, 0x0288DF0CAC5B3F5Du, 0x027C45979C95204Fu, 0x02647C69456217ECu,
+   0x02593F69B02593F6u, 0x0243F6F0243F6F02u, 0x0204081020408102u, 0x01F44659E4A42715u,
+   0x01DE5D6E3F8868A4u, 0x01D77B654B82C339u, 0x01B7D6C3DDA338B2u, 0x01B2036406C80D90u,
+   0x01A16D3F97A4B01Au, 0x01920FB49D0E228Du, 0x01886E5F0ABB0499u, 0x017AD2208E0ECC35u,
+   0x016E1F76B4337C6Cu, 0x016A13CD15372904u, 0x01571ED3C506B39Au, 0x015390948F40FEACu,
+   0x014CAB88725AF6E7u, 0x0149539E3B2D066Eu, 0x013698DF3DE07479u, 0x0125E22708092F11u,
+   0x0120B470C67C0D88u, 0x011E2EF3B3FB8744u, 0x0119453808CA29C0u, 0x0112358E75D30336u,
+   0x010FEF010FEF010Fu, 0x0105197F7D734041u, 0x00FF00FF00FF00FFu, 0x00F92FB2211855A8u,
+   0x00F3A0D52CBA8723u, 0x00F1D48BCEE0D399u, 0x00EC979118F3FC4Du, 0x00E939651FE2D8D3u,
+   0x00E79372E225FE30u, 0x00DFAC1F74346C57u, 0x00D578E97C3F5FE5u, 0x00D2BA083B445250u,
+   0x00D161543E28E502u, 0x00CEBCF8BB5B4169u, 0x00C5FE740317F9D0u, 0x00C2780613C0309Eu,
+   0x00BCDD535DB1CC5Bu, 0x00BBC8408CD63069u, 0x00B9A7862A0FF465u, 0x00B68D31340E4307u,
+   0x00B2927C29DA5519u, 0x00AFB321A1496FDFu, 0x00ACEB0F891E6551u, 0x00AB1CBDD3E2970Fu,
+   0x00A87917088E262Bu, 0x00A513FD6BB00A51u, 0x00A36E71A2CB0331u, 0x00A03C1688732B30u,
+   0x009C69169B30446Du, 0x009BAADE8E4A2F6Eu, 0x00980E4156201301u, 0x00975A750FF68A58u,
+   0x009548E4979E0829u, 0x0093EFD1C50E726Bu, 0x0091F5BCB8BB02D9u, 0x008F67A1E3FDC261u,
+   0x008E2917E0E702C6u, 0x008D8BE33F95D715u, 0x008C55841C815ED5u, 0x0088D180CD3A4133u,
+   0x00869222B1ACF1CEu, 0x0085797B917765ABu, 0x008355ACE3C897DBu, 0x00824A4E60B3262Bu,
+   0x0080C121B28BD1BAu, 0x007DC9F3397D4C29u, 0x007D4ECE8FE88139u, 0x0079237D65BCCE50u,
+   0x0077CF53C5F7936Cu, 0x0075A8ACCFBDD11Eu, 0x007467AC557C228Eu, 0x00732D70ED8DB8E9u,
+   0x0072C62A24C3797Fu, 0x007194A17F55A10Du, 0x006FA549B41DA7E7u, 0x006E8419E6F61221u,
+   0x006D68B5356C207Bu, 0x006D0B803685C01Bu, 0x006BF790A8B2D207u, 0x006AE907EF4B96C2u,
+   0x006A37991A23AEADu, 0x0069DFBDD4295B66u, 0x0067DC4C45C8033Eu, 0x00663D80FF99C27Fu,
+   0x0065EC17E3559948u, 0x00654AC835CFBA5Cu, 0x00645C854AE10772u, 0x006372990E5F901Fu,
+   0x006325913C07BEEFu, 0x006160FF9E9F0061u, 0x0060CDB520E5E88Eu, 0x005FF4017FD005FFu,
+   0x005ED79E31A4DCCDu, 0x005D7D42D48AC5EFu, 0x005C6F35CCBA5028u, 0x005B2618EC6AD0A5u,
+   0x005A2553748E42E7u, 0x0059686CF744CD5Bu, 0x0058AE97BAB79976u, 0x0058345F1876865Fu,
+   0x005743D5BB24795Au, 0x005692C4D1AB74ABu, 0x00561E46A4D5F337u, 0x005538ED06533997u,
+   0x0054C807F2C0BEC2u, 0x005345EFBC572D36u, 0x00523A758F941345u, 0x005102370F816C89u,
+   0x0050CF129FB94ACFu, 0x004FD31941CAFDD1u, 0x004FA1704AA75945u, 0x004F3ED6D45A63ADu,
+   0x004F0DE57154EBEDu, 0x004E1CAE8815F811u, 0x004CD47BA5F6FF19u, 0x004C78AE734DF709u,
+   0x004C4B19ED85CFB8u, 0x004BF093221D1218u, 0x004ABA3C21DC633Fu, 0x004A6360C344DE00u,
+   0x004A383E9F74D68Au, 0x0049E28FBABB9940u, 0x0048417B57C78CD7u, 0x0047F043713F3A2Bu,
+   0x00474FF2A10281CFu, 0x00468B6F9A978F91u, 0x0045F13F1CAFF2E2u, 0x0045A5228CEC23E9u,
+   0x0045342C556C66B9u, 0x0044C4A23FEECED7u, 0x0043C5C20D3C9FE6u, 0x00437E494B239798u,
+   0x0043142D118E47CBu, 0x0042AB5C73A13458u, 0x004221950DB0F3DBu, 0x0041BBB2F80A4553u,
+   0x0040F391612C6680u, 0x0040B1E94173FEFDu, 0x004050647D9D0445u, 0x004030241B144F3Bu,
+   0x003F90C2AB542CB1u, 0x003F71412D59F597u, 0x003F137701B98841u, 0x003E79886B60E278u,
+   0x003E5B1916A7181Du, 0x003DC4A50968F524u, 0x003DA6E4C9550321u, 0x003D4E4F06F1DEF3u,
+   0x003C4A6BDD24F9A4u, 0x003C11D54B525C73u, 0x003BF5B1C5721065u, 0x003BBDB9862F23B4u,
+   0x003B6A8801DB5440u, 0x003B183CF0FED886u, 0x003AABE394BDC3F4u, 0x003A5BA3E76156DAu,
+   0x003A0C3E953378DBu, 0x0038F03561320B1Eu, 0x0038D6ECAEF5908Au, 0x003859CF221E6069u,
+   0x0037F7415DC9588Au, 0x00377DF0D3902626u, 0x00373622136907FAu, 0x0036EF0C3B39B92Fu,
+   0x0036915F47D55E6Du, 0x0036072CF3F866FDu, 0x0035D9B737BE5EA8u, 0x0035961559CC81C7u,
+   0x0035531C897A4592u, 0x00353CEEBD3E98A4u, 0x0034FAD381585E5Eu, 0x00347884D1103130u,
+   0x00340DD3AC39BF56u, 0x003351FDFECC140Cu, 0x00333D72B089B524u, 0x0033148D44D6B261u,
+   0x0032D7AEF8412458u, 0x0032C3850E79C0F1u, 0x00328766D59048A2u, 0x00325FA18CB11833u,
+   0x00324BD659327E22u, 0x0032246E784360F4u, 0x0031AFA5F1A33A08u, 0x00319C63FF398E70u,
+   0x003162F7519A86A7u, 0x0030271FC9D3FC3Cu, 0x002FF104AE89750Bu, 0x002FBB62A236D133u,
+   0x002F74997D2070B4u, 0x002ED84AA8B6FCE3u, 0x002E832DF7A46DBDu, 0x002E0E0846857CABu,
+   0x002DECFBDFB55EE6u, 0x002DDC876F3FF488u, 0x002DBBC1D4C482C4u, 0x002D8AF0E0DE0556u,
+   0x002D4A7B7D14B30Au, 0x002D2A85073BCF4Eu, 0x002D1A9AB13E8BE4u, 0x002CEB1EB4B9FD8Bu,
+   0x002C8D503A79794Cu, 0x002C404D708784EDu, 0x002C31066315EC52u, 0x002C1297D80F2664u,
+   0x002C037044C55F6Bu, 0x002BE5404CD13086u, 0x002BB845ADAF0CCEu, 0x002B5F62C639F16Du,
+   0x002B07E6734F2B88u, 0x002ACE569D8342B7u, 0x002A791D5DBD4DCFu, 0x002A4EFF8113017Cu,
+   0x002A3319E156DF32u, 0x002A0986286526EAu, 0x0029D29551D91E39u, 0x0029B7529E109F0Au,
+   0x00298137491EA465u, 0x0029665E1EB9F9DAu, 0x002909752E019A5Eu, 0x0028EF35E2E5EFB0u,
+   0x0028C815AA4B8278u, 0x0028BB1B867199DAu, 0x0028A13FF5D7B002u, 0x00287AB3F173E755u
+};
+
 /* determines if an integers is divisible by one
  * of the first PRIME_SIZE primes or not
  *
  * sets result to 0 if not, 1 if yes
+ *
+ * The odd primes are packed greedily into digit sized products, a is reduced
+ * modulo all products in a single pass over its digits and the residue of each
+ * product is then tested against each of its primes without a division.
  */
 amplify_mp_err amplify_s_mp_prime_is_divisible(const amplify_mp_int *a, amplify_mp_bool *result)
 {
-   int      ix;
-   amplify_mp_err   err;
-   amplify_mp_digit res;
+   amplify_mp_digit prod[PRIVATE_MP_PRIME_TAB_SIZE], rem[PRIVATE_MP_PRIME_TAB_SIZE];
+   uint64_t res[PRIVATE_MP_PRIME_TAB_SIZE];
+   int      group[PRIVATE_MP_PRIME_TAB_SIZE];
+   int      ix, iy, ngroups;
+   unsigned hit;
 
-   /* default to not */
-   *result = AMPLIFY_MP_NO;
+   /* zero and even numbers are divisible by 2 */
+   if (AMPLIFY_MP_IS_ZERO(a) || ((a->dp[0] & 1u) == 0u)) {
+      *result = AMPLIFY_MP_YES;
+      return AMPLIFY_MP_OKAY;
+   }
 
-   for (ix = 0; ix < PRIVATE_MP_PRIME_TAB_SIZE; ix++) {
-      /* what is a mod LBL_prime_tab[ix] */
-      if ((err = amplify_mp_mod_d(a, amplify_s_mp_prime_tab[ix], &res)) != AMPLIFY_MP_OKAY) {
-         return err;
+   /* pack the odd primes into products that fit a digit */
+   ngroups = 0;
+   prod[0] = 1u;
+   for (ix = 1; ix < PRIVATE_MP_PRIME_TAB_SIZE; ix++) {
+      amplify_mp_digit p = amplify_s_mp_prime_tab[ix];
+      if (((amplify_mp_word)prod[ngroups] * (amplify_mp_word)p) > (amplify_mp_word)AMPLIFY_MP_DIGIT_MAX) {
+         prod[++ngroups] = 1u;
       }
+      prod[ngroups] *= p;
+      group[ix] = ngroups;
+   }
+   ++ngroups;
 
-      /* is the residue zero? */
-      if (res == 0u) {
-         *result = AMPLIFY_MP_YES;
-         return AMPLIFY_MP_OKAY;
+   /* one pass over the digits of a, the products are independent so the
+    * divisions of one digit can overlap
+    */
+   for (iy = 0; iy < ngroups; iy++) {
+      rem[iy] = 0u;
+   }
+   for (ix = a->used - 1; ix >= 0; ix--) {
+      amplify_mp_digit d = a->dp[ix];
+      for (iy = 0; iy < ngroups; iy++) {
+         amplify_mp_word w = ((amplify_mp_word)rem[iy] << (amplify_mp_word)AMPLIFY_MP_DIGIT_BIT) | (amplify_mp_word)d;
+         rem[iy] = (amplify_mp_digit)(w % (amplify_mp_word)prod[iy]);
       }
    }
 
+   /* branch free divisibility test of every residue */
+   for (ix = 1; ix < PRIVATE_MP_PRIME_TAB_SIZE; ix++) {
+      res[ix] = (uint64_t)rem[group[ix]];
+   }
+   hit = 0u;
+   for (ix = 1; ix < PRIVATE_MP_PRIME_TAB_SIZE; ix++) {
+      hit |= (unsigned)((res[ix] * s_inv[ix]) <= s_lim[ix]);
+   }
+
+   *result = (hit != 0u) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
    return AMPLIFY_MP_OKAY;
 }
 #endif
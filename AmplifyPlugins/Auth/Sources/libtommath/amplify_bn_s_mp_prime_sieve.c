@@ -0,0 +1,70 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_PRIME_SIEVE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* sieves the window of candidates c_i = a + i*step, 0 <= i < AMPLIFY_MP_PRIME_SIEVE_WINDOW
+ *
+ * Bit i of "composite" is set if c_i has a factor among the odd primes of the
+ * table or, with "safe", if (c_i - 1)/2 has one.  The caller has to make sure
+ * a is larger than 2 * the largest table prime + 1 so no candidate is rejected
+ * for being one of the table primes itself.
+ *
+ * "res" holds a mod amplify_s_mp_prime_tab[ix].  If a is not NULL the
+ * residues are computed from it, otherwise they are taken as they were left by
+ * the previous call.  On return they are advanced to the first candidate of the
+ * next window, so consecutive windows need only one division per prime.
+ *
+ * step must be 2 or 4.
+ */
+amplify_mp_err amplify_s_mp_prime_sieve(const amplify_mp_int *a, amplify_mp_digit *res, amplify_mp_digit step,
+                                        amplify_mp_bool safe, unsigned char *composite)
+{
+   unsigned long p, r, inv, i;
+   amplify_mp_err err;
+   int ix;
+
+   if ((step != 2u) && (step != 4u)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   if (a != NULL) {
+      for (ix = 1; ix < PRIVATE_MP_PRIME_TAB_SIZE; ix++) {
+         if ((err = amplify_mp_mod_d(a, amplify_s_mp_prime_tab[ix], res + ix)) != AMPLIFY_MP_OKAY) {
+            return err;
+         }
+      }
+   }
+
+   AMPLIFY_MP_ZERO_BUFFER(composite, AMPLIFY_MP_PRIME_SIEVE_WINDOW / 8);
+
+   for (ix = 1; ix < PRIVATE_MP_PRIME_TAB_SIZE; ix++) {
+      p = (unsigned long)amplify_s_mp_prime_tab[ix];
+      r = (unsigned long)res[ix];
+
+      /* step^-1 mod p */
+      inv = (p + 1uL) >> 1;
+      if (step == 4u) {
+         inv = (inv * inv) % p;
+      }
+
+      /* c_i = 0 mod p */
+      for (i = (((p - r) % p) * inv) % p; i < (unsigned long)AMPLIFY_MP_PRIME_SIEVE_WINDOW; i += p) {
+         composite[i >> 3] |= (unsigned char)(1u << (i & 7u));
+      }
+
+      /* c_i = 1 mod p, i.e. p divides (c_i - 1)/2 */
+      if (safe == AMPLIFY_MP_YES) {
+         for (i = (((p + 1uL - r) % p) * inv) % p; i < (unsigned long)AMPLIFY_MP_PRIME_SIEVE_WINDOW; i += p) {
+            composite[i >> 3] |= (unsigned char)(1u << (i & 7u));
+         }
+      }
+
+      /* move to the next window */
+      res[ix] = (amplify_mp_digit)((r + (((unsigned long)AMPLIFY_MP_PRIME_SIEVE_WINDOW * (unsigned long)step) % p)) % p);
+   }
+
+   return AMPLIFY_MP_OKAY;
+}
+#endif
@@ -0,0 +1,54 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_PRIME_START_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* draws the start of a prime candidate window: a random number of exactly
+ * "size" bits shaped by the AMPLIFY_MP_PRIME_* flags (which must already
+ * have AMPLIFY_MP_PRIME_BBS added for AMPLIFY_MP_PRIME_SAFE).
+ *
+ * "tmp" is scratch space of (size + 7) / 8 bytes.
+ */
+amplify_mp_err amplify_s_mp_prime_start(amplify_mp_int *a, unsigned char *tmp, int size, int flags, private_amplify_mp_prime_callback cb, void *dat)
+{
+   unsigned char maskAND, maskOR_msb, maskOR_lsb;
+   int bsize, maskOR_msb_offset;
+
+   /* calc the byte size */
+   bsize = (size>>3) + ((size&7)?1:0);
+
+   /* calc the maskAND value for the MSbyte*/
+   maskAND = ((size&7) == 0) ? 0xFFu : (unsigned char)(0xFFu >> (8 - (size & 7)));
+
+   /* calc the maskOR_msb */
+   maskOR_msb        = 0;
+   maskOR_msb_offset = ((size & 7) == 1) ? 1 : 0;
+   if ((flags & AMPLIFY_MP_PRIME_2MSB_ON) != 0) {
+      maskOR_msb       |= (unsigned char)(0x80 >> ((9 - size) & 7));
+   }
+
+   /* get the maskOR_lsb */
+   maskOR_lsb         = 1u;
+   if ((flags & AMPLIFY_MP_PRIME_BBS) != 0) {
+      maskOR_lsb     |= 3u;
+   }
+
+   /* read the bytes */
+   if (cb(tmp, bsize, dat) != bsize) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   /* work over the MSbyte */
+   tmp[0]    &= maskAND;
+   tmp[0]    |= (unsigned char)(1 << ((size - 1) & 7));
+
+   /* mix in the maskORs */
+   tmp[maskOR_msb_offset]   |= maskOR_msb;
+   tmp[bsize-1]             |= maskOR_lsb;
+
+   /* read it in */
+   /* TODO: casting only for now until all lengths have been changed to the type "size_t"*/
+   return amplify_mp_from_ubin(a, tmp, (size_t)bsize);
+}
+#endif
@@ -0,0 +1,33 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_SUB_SPAN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* r[0..na) = a[0..na) - b[0..nb) for na >= nb, returns the borrow out.
+ * r may be the same span as a or b.
+ */
+amplify_mp_digit amplify_s_mp_sub_span(amplify_mp_digit *r, const amplify_mp_digit *a, int na, const amplify_mp_digit *b, int nb)
+{
+   amplify_mp_digit u = 0;
+   int i;
+
+   for (i = 0; i < nb; i++) {
+      r[i] = (a[i] - b[i]) - u;
+      /* a borrow sets every bit above the digit, see amplify_s_mp_sub */
+      u = r[i] >> (AMPLIFY_MP_SIZEOF_BITS(amplify_mp_digit) - 1u);
+      r[i] &= AMPLIFY_MP_MASK;
+   }
+   for (; (i < na) && (u != 0u); i++) {
+      r[i] = a[i] - u;
+      u = r[i] >> (AMPLIFY_MP_SIZEOF_BITS(amplify_mp_digit) - 1u);
+      r[i] &= AMPLIFY_MP_MASK;
+   }
+   if (r != a) {
+      for (; i < na; i++) {
+         r[i] = a[i];
+      }
+   }
+   return u;
+}
+#endif
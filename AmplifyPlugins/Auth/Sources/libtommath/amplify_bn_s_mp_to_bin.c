@@ -0,0 +1,95 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_TO_BIN_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* linear time export of the magnitude of "a" into exactly "count" words
+ * of "size" bytes each, the counterpart of amplify_s_mp_from_bin.
+ *
+ * Digits are shifted into an accumulator from the least significant end
+ * and drained a byte (or 64 bits) at a time. Words beyond the magnitude of
+ * "a" as well as nail bits are written as zero.
+ *
+ * "endian" must already be resolved, i.e. not AMPLIFY_MP_NATIVE_ENDIAN.
+ */
+void amplify_s_mp_to_bin(const amplify_mp_int *a, unsigned char *buf, size_t count, amplify_mp_order order,
+                         size_t size, amplify_mp_endian endian, size_t nails)
+{
+   amplify_mp_word acc;
+   size_t nail_bytes, odd_nails, i, j;
+   int bits, x;
+
+   acc  = 0u;
+   bits = 0;
+   x    = 0;
+
+   if ((nails == 0u) && (order == AMPLIFY_MP_MSB_FIRST) && ((size == 1u) || (endian == AMPLIFY_MP_BIG_ENDIAN))) {
+      /* the output is one contiguous big endian byte string */
+      unsigned char *p = buf + (count * size);
+      size_t n = count * size;
+
+#ifdef AMPLIFY_MP_64BIT
+      /* emit 64 bits at a time, compilers fold this into a single byte-swapping store */
+      while (n >= 8u) {
+         uint64_t w;
+         while ((bits < 64) && (x < a->used)) {
+            acc  |= (amplify_mp_word)a->dp[x++] << bits;
+            bits += AMPLIFY_MP_DIGIT_BIT;
+         }
+         w     = (uint64_t)acc;
+         acc >>= 64;
+         bits  = AMPLIFY_MP_MAX(bits - 64, 0);
+         p    -= 8;
+         p[0] = (unsigned char)(w >> 56);
+         p[1] = (unsigned char)(w >> 48);
+         p[2] = (unsigned char)(w >> 40);
+         p[3] = (unsigned char)(w >> 32);
+         p[4] = (unsigned char)(w >> 24);
+         p[5] = (unsigned char)(w >> 16);
+         p[6] = (unsigned char)(w >> 8);
+         p[7] = (unsigned char)w;
+         n   -= 8u;
+      }
+#endif
+      while (n-- > 0u) {
+         while ((bits < 8) && (x < a->used)) {
+            acc  |= (amplify_mp_word)a->dp[x++] << bits;
+            bits += AMPLIFY_MP_DIGIT_BIT;
+         }
+         *--p  = (unsigned char)(acc & 255u);
+         acc >>= 8;
+         bits  = AMPLIFY_MP_MAX(bits - 8, 0);
+      }
+      return;
+   }
+
+   odd_nails = (nails % 8u);
+   nail_bytes = nails / 8u;
+
+   /* words from least to most significant, bytes likewise */
+   for (i = 0u; i < count; ++i) {
+      unsigned char *w = buf + (((order == AMPLIFY_MP_LSB_FIRST) ? i : ((count - 1u) - i)) * size);
+      for (j = 0u; j < size; ++j) {
+         unsigned char *byte = w + ((endian == AMPLIFY_MP_LITTLE_ENDIAN) ? j : ((size - 1u) - j));
+         int nbits = 8;
+
+         if (j >= (size - nail_bytes)) {
+            *byte = 0;
+            continue;
+         }
+         if (j == ((size - nail_bytes) - 1u)) {
+            nbits -= (int)odd_nails;
+         }
+
+         while ((bits < nbits) && (x < a->used)) {
+            acc  |= (amplify_mp_word)a->dp[x++] << bits;
+            bits += AMPLIFY_MP_DIGIT_BIT;
+         }
+         *byte = (unsigned char)(acc & (((amplify_mp_word)1 << nbits) - 1u));
+         acc >>= nbits;
+         bits  = AMPLIFY_MP_MAX(bits - nbits, 0);
+      }
+   }
+}
+#endif
@@ -0,0 +1,91 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_TOOM32_MUL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* unbalanced Toom-Cook multiplication, "Toom-2.5"
+ *
+ * The larger operand is cut into three pieces and the smaller one into two
+ * pieces of the same size B, four products of B digits instead of the six a
+ * slice-by-slice product would need.  Best at a size ratio of about 3:2.
+ *
+ * Evaluation at 0, 1, -1 and infinity:
+ *
+ *   c0 = w(0), c3 = w(inf)
+ *   c2 = (w(1) + w(-1))/2 - c0
+ *   c1 = (w(1) - w(-1))/2 - c3
+ *
+ * The smaller operand must have more than B digits.
+ */
+amplify_mp_err amplify_s_mp_toom32_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   amplify_mp_int a0, a1, a2, b0, b1, w1, wm1, t;
+   amplify_mp_err err;
+   int B;
+
+   /* Make sure that a is the larger one */
+   if (a->used < b->used) {
+      const amplify_mp_int *x = a;
+      a = b;
+      b = x;
+   }
+
+   B = (a->used + 2) / 3;
+
+   if ((err = amplify_mp_init_multi(&w1, &wm1, &t, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /** a = a2 * x^2 + a1 * x + a0, b = b1 * x + b0 */
+   if ((err = amplify_s_mp_init_slice(&a0, a, 0, B)) != AMPLIFY_MP_OKAY)                   goto LBL_ERRa0;
+   if ((err = amplify_s_mp_init_slice(&a1, a, B, B)) != AMPLIFY_MP_OKAY)                   goto LBL_ERRa1;
+   if ((err = amplify_s_mp_init_slice(&a2, a, 2 * B, a->used - (2 * B))) != AMPLIFY_MP_OKAY) goto LBL_ERRa2;
+   if ((err = amplify_s_mp_init_slice(&b0, b, 0, B)) != AMPLIFY_MP_OKAY)                   goto LBL_ERRb0;
+   if ((err = amplify_s_mp_init_slice(&b1, b, B, b->used - B)) != AMPLIFY_MP_OKAY)         goto LBL_ERRb1;
+
+   /** w1 = (a0 + a1 + a2) * (b0 + b1), wm1 = (a0 - a1 + a2) * (b0 - b1) */
+   if ((err = amplify_mp_add(&a0, &a2, &t)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_add(&t, &a1, &w1)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_sub(&t, &a1, &wm1)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_add(&b0, &b1, &t)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_mul(&w1, &t, &w1)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_sub(&b0, &b1, &t)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_mul(&wm1, &t, &wm1)) != AMPLIFY_MP_OKAY)                          goto LBL_ERR;
+
+   /** a0 = c0 = a0 * b0, a2 = c3 = a2 * b1 */
+   if ((err = amplify_mp_mul(&a0, &b0, &a0)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_mul(&a2, &b1, &a2)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+
+   /** t = c1 = (w1 - wm1)/2 - c3, w1 = c2 = (w1 + wm1)/2 - c0 */
+   if ((err = amplify_mp_sub(&w1, &wm1, &t)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&t, &t)) != AMPLIFY_MP_OKAY)                                goto LBL_ERR;
+   if ((err = amplify_mp_sub(&t, &a2, &t)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_add(&w1, &wm1, &w1)) != AMPLIFY_MP_OKAY)                          goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&w1, &w1)) != AMPLIFY_MP_OKAY)                              goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w1, &a0, &w1)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+
+   /** P = c3*x^3 + c2*x^2 + c1*x + c0 */
+   if ((err = amplify_mp_lshd(&a2, 3 * B)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&w1, 2 * B)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_add(&a2, &w1, &a2)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&t, B)) != AMPLIFY_MP_OKAY)                                  goto LBL_ERR;
+   if ((err = amplify_mp_add(&a2, &t, &a2)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_add(&a2, &a0, c)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+
+LBL_ERR:
+   amplify_mp_clear(&b1);
+LBL_ERRb1:
+   amplify_mp_clear(&b0);
+LBL_ERRb0:
+   amplify_mp_clear(&a2);
+LBL_ERRa2:
+   amplify_mp_clear(&a1);
+LBL_ERRa1:
+   amplify_mp_clear(&a0);
+LBL_ERRa0:
+   amplify_mp_clear_multi(&w1, &wm1, &t, NULL);
+   return err;
+}
+
+#endif
@@ -0,0 +1,123 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_TOOM42_MUL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* unbalanced Toom-Cook multiplication, "Toom-3.5"
+ *
+ * The larger operand is cut into four pieces and the smaller one into two
+ * pieces of the same size B, five products of B digits instead of the eight
+ * a slice-by-slice product would need.  Best at a size ratio of about 2:1.
+ *
+ * Evaluation at 0, 1, -1, 2 and infinity:
+ *
+ *   c0 = w(0), c4 = w(inf)
+ *   O  = (w(1) - w(-1))/2                        = c1 + c3
+ *   c2 = (w(1) + w(-1))/2 - c0 - c4
+ *   c3 = ((w(2) - c0 - 4*c2 - 16*c4)/2 - O)/3
+ *   c1 = O - c3
+ *
+ * The smaller operand must have more than B digits.
+ */
+amplify_mp_err amplify_s_mp_toom42_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   amplify_mp_int a0, a1, a2, a3, b0, b1, w1, wm1, w2, t, u;
+   amplify_mp_err err;
+   int B;
+
+   /* Make sure that a is the larger one */
+   if (a->used < b->used) {
+      const amplify_mp_int *x = a;
+      a = b;
+      b = x;
+   }
+
+   B = (a->used + 3) / 4;
+
+   if ((err = amplify_mp_init_multi(&w1, &wm1, &w2, &t, &u, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /** a = a3 * x^3 + a2 * x^2 + a1 * x + a0, b = b1 * x + b0 */
+   if ((err = amplify_s_mp_init_slice(&a0, a, 0, B)) != AMPLIFY_MP_OKAY)                   goto LBL_ERRa0;
+   if ((err = amplify_s_mp_init_slice(&a1, a, B, B)) != AMPLIFY_MP_OKAY)                   goto LBL_ERRa1;
+   if ((err = amplify_s_mp_init_slice(&a2, a, 2 * B, B)) != AMPLIFY_MP_OKAY)               goto LBL_ERRa2;
+   if ((err = amplify_s_mp_init_slice(&a3, a, 3 * B, a->used - (3 * B))) != AMPLIFY_MP_OKAY) goto LBL_ERRa3;
+   if ((err = amplify_s_mp_init_slice(&b0, b, 0, B)) != AMPLIFY_MP_OKAY)                   goto LBL_ERRb0;
+   if ((err = amplify_s_mp_init_slice(&b1, b, B, b->used - B)) != AMPLIFY_MP_OKAY)         goto LBL_ERRb1;
+
+   /** w1 = (a0 + a1 + a2 + a3) * (b0 + b1), wm1 = (a0 - a1 + a2 - a3) * (b0 - b1) */
+   if ((err = amplify_mp_add(&a0, &a2, &t)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_add(&a1, &a3, &u)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_add(&t, &u, &w1)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_sub(&t, &u, &wm1)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_add(&b0, &b1, &t)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_mul(&w1, &t, &w1)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_sub(&b0, &b1, &t)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_mul(&wm1, &t, &wm1)) != AMPLIFY_MP_OKAY)                          goto LBL_ERR;
+
+   /** w2 = (((2a3 + a2)*2 + a1)*2 + a0) * (2b1 + b0) */
+   if ((err = amplify_mp_mul_2(&a3, &w2)) != AMPLIFY_MP_OKAY)                              goto LBL_ERR;
+   if ((err = amplify_mp_add(&w2, &a2, &w2)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_mul_2(&w2, &w2)) != AMPLIFY_MP_OKAY)                              goto LBL_ERR;
+   if ((err = amplify_mp_add(&w2, &a1, &w2)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_mul_2(&w2, &w2)) != AMPLIFY_MP_OKAY)                              goto LBL_ERR;
+   if ((err = amplify_mp_add(&w2, &a0, &w2)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_mul_2(&b1, &t)) != AMPLIFY_MP_OKAY)                               goto LBL_ERR;
+   if ((err = amplify_mp_add(&t, &b0, &t)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_mul(&w2, &t, &w2)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+
+   /** a0 = c0 = a0 * b0, a3 = c4 = a3 * b1 */
+   if ((err = amplify_mp_mul(&a0, &b0, &a0)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_mul(&a3, &b1, &a3)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+
+   /** t = O = (w1 - wm1)/2, w1 = c2 = (w1 + wm1)/2 - c0 - c4 */
+   if ((err = amplify_mp_sub(&w1, &wm1, &t)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&t, &t)) != AMPLIFY_MP_OKAY)                                goto LBL_ERR;
+   if ((err = amplify_mp_add(&w1, &wm1, &w1)) != AMPLIFY_MP_OKAY)                          goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&w1, &w1)) != AMPLIFY_MP_OKAY)                              goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w1, &a0, &w1)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w1, &a3, &w1)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+
+   /** w2 = c3 = ((w2 - c0 - 4*c2 - 16*c4)/2 - O)/3 */
+   if ((err = amplify_mp_sub(&w2, &a0, &w2)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_mul_2d(&w1, 2, &u)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w2, &u, &w2)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_mul_2d(&a3, 4, &u)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w2, &u, &w2)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&w2, &w2)) != AMPLIFY_MP_OKAY)                              goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w2, &t, &w2)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_div_3(&w2, &w2, NULL)) != AMPLIFY_MP_OKAY)                        goto LBL_ERR;
+
+   /** t = c1 = O - c3 */
+   if ((err = amplify_mp_sub(&t, &w2, &t)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+
+   /** P = c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0 */
+   if ((err = amplify_mp_lshd(&a3, 4 * B)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&w2, 3 * B)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_add(&a3, &w2, &a3)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&w1, 2 * B)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+   if ((err = amplify_mp_add(&a3, &w1, &a3)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&t, B)) != AMPLIFY_MP_OKAY)                                  goto LBL_ERR;
+   if ((err = amplify_mp_add(&a3, &t, &a3)) != AMPLIFY_MP_OKAY)                            goto LBL_ERR;
+   if ((err = amplify_mp_add(&a3, &a0, c)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+
+LBL_ERR:
+   amplify_mp_clear(&b1);
+LBL_ERRb1:
+   amplify_mp_clear(&b0);
+LBL_ERRb0:
+   amplify_mp_clear(&a3);
+LBL_ERRa3:
+   amplify_mp_clear(&a2);
+LBL_ERRa2:
+   amplify_mp_clear(&a1);
+LBL_ERRa1:
+   amplify_mp_clear(&a0);
+LBL_ERRa0:
+   amplify_mp_clear_multi(&w1, &wm1, &w2, &t, &u, NULL);
+   return err;
+}
+
+#endif
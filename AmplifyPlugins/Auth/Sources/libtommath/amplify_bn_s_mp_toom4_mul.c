@@ -0,0 +1,190 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_TOOM4_MUL_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* multiplication using the Toom-Cook 4-way algorithm
+ *
+ * Seven products of a quarter of the size, O(N**1.404).  Squares
+ * when a == b.
+ *
+ * Evaluation at 0, 1, -1, 2, -2, 1/2 and infinity, the interpolation
+ * only needs exact divisions by 2, 4, 3 and 5:
+ *
+ *   E1 = (w(1) + w(-1))/2 - c0 - c6            = c2 + c4
+ *   E2 = ((w(2) + w(-2))/2 - c0 - 64*c6)/4     = c2 + 4*c4
+ *   O1 = (w(1) - w(-1))/2                      = c1 + c3 + c5
+ *   O2 = (w(2) - w(-2))/4                      = c1 + 4*c3 + 16*c5
+ *   H  = (64*w(1/2) - 64*c0 - 16*c2 - 4*c4 - c6)/2 = 16*c1 + 4*c3 + c5
+ *
+ *   c4 = (E2 - E1)/3, c2 = E1 - c4
+ *   X  = (O2 - O1)/3     = c3 + 5*c5
+ *   Y  = (16*O1 - H)/3   = 4*c3 + 5*c5
+ *   c3 = (Y - X)/3, c5 = (X - c3)/5, c1 = O1 - c3 - c5
+ */
+
+/* evaluates x[3]*t^3 + x[2]*t^2 + x[1]*t + x[0] at 1, -1, 2, -2 and
+ * 8 times at 1/2
+ */
+static amplify_mp_err s_eval(const amplify_mp_int *x, amplify_mp_int *p1, amplify_mp_int *m1,
+                             amplify_mp_int *p2, amplify_mp_int *m2, amplify_mp_int *h,
+                             amplify_mp_int *t, amplify_mp_int *u)
+{
+   amplify_mp_err err;
+
+   /** p1 = (x0 + x2) + (x1 + x3), m1 = (x0 + x2) - (x1 + x3) */
+   if ((err = amplify_mp_add(&x[0], &x[2], t)) != AMPLIFY_MP_OKAY)     return err;
+   if ((err = amplify_mp_add(&x[1], &x[3], u)) != AMPLIFY_MP_OKAY)     return err;
+   if ((err = amplify_mp_add(t, u, p1)) != AMPLIFY_MP_OKAY)            return err;
+   if ((err = amplify_mp_sub(t, u, m1)) != AMPLIFY_MP_OKAY)            return err;
+
+   /** p2 = (x0 + 4x2) + (2x1 + 8x3), m2 = (x0 + 4x2) - (2x1 + 8x3) */
+   if ((err = amplify_mp_mul_2d(&x[2], 2, t)) != AMPLIFY_MP_OKAY)      return err;
+   if ((err = amplify_mp_add(&x[0], t, t)) != AMPLIFY_MP_OKAY)         return err;
+   if ((err = amplify_mp_mul_2d(&x[3], 2, u)) != AMPLIFY_MP_OKAY)      return err;
+   if ((err = amplify_mp_add(&x[1], u, u)) != AMPLIFY_MP_OKAY)         return err;
+   if ((err = amplify_mp_mul_2(u, u)) != AMPLIFY_MP_OKAY)              return err;
+   if ((err = amplify_mp_add(t, u, p2)) != AMPLIFY_MP_OKAY)            return err;
+   if ((err = amplify_mp_sub(t, u, m2)) != AMPLIFY_MP_OKAY)            return err;
+
+   /** h = ((2x0 + x1)*2 + x2)*2 + x3 */
+   if ((err = amplify_mp_mul_2(&x[0], h)) != AMPLIFY_MP_OKAY)          return err;
+   if ((err = amplify_mp_add(h, &x[1], h)) != AMPLIFY_MP_OKAY)         return err;
+   if ((err = amplify_mp_mul_2(h, h)) != AMPLIFY_MP_OKAY)              return err;
+   if ((err = amplify_mp_add(h, &x[2], h)) != AMPLIFY_MP_OKAY)         return err;
+   if ((err = amplify_mp_mul_2(h, h)) != AMPLIFY_MP_OKAY)              return err;
+   return amplify_mp_add(h, &x[3], h);
+}
+
+/* c = a*b, squares when a == b */
+static amplify_mp_err s_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c, amplify_mp_bool sqr)
+{
+   return (sqr == AMPLIFY_MP_YES) ? amplify_mp_sqr(a, c) : amplify_mp_mul(a, b, c);
+}
+
+amplify_mp_err amplify_s_mp_toom4_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c)
+{
+   amplify_mp_int A[4], Bs[4], w0, w1, wm1, w2, wm2, wh, winf, t, u, v1, vm1, v2, vm2, vh;
+   amplify_mp_bool sqr = (a == b) ? AMPLIFY_MP_YES : AMPLIFY_MP_NO;
+   amplify_mp_err err;
+   int B, ia = 0, ib = 0;
+
+   if ((err = amplify_mp_init_multi(&w0, &w1, &wm1, &w2, &wm2, &wh, &winf, &t, &u,
+                                    &v1, &vm1, &v2, &vm2, &vh, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   /* B */
+   B = AMPLIFY_MP_MIN(a->used, b->used) / 4;
+
+   /** a = a3 * x^3 + a2 * x^2 + a1 * x + a0, the top slice takes the rest */
+   for (ia = 0; ia < 4; ia++) {
+      if ((err = amplify_s_mp_init_slice(&A[ia], a, ia * B, (ia == 3) ? (a->used - (3 * B)) : B)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   }
+   if (sqr == AMPLIFY_MP_NO) {
+      for (ib = 0; ib < 4; ib++) {
+         if ((err = amplify_s_mp_init_slice(&Bs[ib], b, ib * B, (ib == 3) ? (b->used - (3 * B)) : B)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      }
+   }
+
+   /** w(0) = a0 * b0, w(inf) = a3 * b3 */
+   if ((err = s_mul(&A[0], &Bs[0], &w0, sqr)) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   if ((err = s_mul(&A[3], &Bs[3], &winf, sqr)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+
+   /** the other five points, a's values in w*, b's in v* */
+   if ((err = s_eval(A, &w1, &wm1, &w2, &wm2, &wh, &t, &u)) != AMPLIFY_MP_OKAY)      goto LBL_ERR;
+   if (sqr == AMPLIFY_MP_NO) {
+      if ((err = s_eval(Bs, &v1, &vm1, &v2, &vm2, &vh, &t, &u)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   }
+   if ((err = s_mul(&w1, &v1, &w1, sqr)) != AMPLIFY_MP_OKAY)                        goto LBL_ERR;
+   if ((err = s_mul(&wm1, &vm1, &wm1, sqr)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = s_mul(&w2, &v2, &w2, sqr)) != AMPLIFY_MP_OKAY)                        goto LBL_ERR;
+   if ((err = s_mul(&wm2, &vm2, &wm2, sqr)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = s_mul(&wh, &vh, &wh, sqr)) != AMPLIFY_MP_OKAY)                        goto LBL_ERR;
+
+   /** w1 = (w1 + wm1)/2, wm1 = O1 = (w1 - wm1)/2 */
+   if ((err = amplify_mp_sub(&w1, &wm1, &t)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_add(&w1, &wm1, &w1)) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&w1, &w1)) != AMPLIFY_MP_OKAY)                       goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&t, &wm1)) != AMPLIFY_MP_OKAY)                       goto LBL_ERR;
+
+   /** w2 = (w2 + wm2)/2, wm2 = O2 = (w2 - wm2)/4 */
+   if ((err = amplify_mp_sub(&w2, &wm2, &t)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_add(&w2, &wm2, &w2)) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&w2, &w2)) != AMPLIFY_MP_OKAY)                       goto LBL_ERR;
+   if ((err = amplify_mp_div_2d(&t, 2, &wm2, NULL)) != AMPLIFY_MP_OKAY)             goto LBL_ERR;
+
+   /** w1 = E1 = w1 - w0 - winf */
+   if ((err = amplify_mp_sub(&w1, &w0, &w1)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w1, &winf, &w1)) != AMPLIFY_MP_OKAY)                  goto LBL_ERR;
+
+   /** w2 = E2 = (w2 - w0 - 64*winf)/4 */
+   if ((err = amplify_mp_sub(&w2, &w0, &w2)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_mul_2d(&winf, 6, &t)) != AMPLIFY_MP_OKAY)                  goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w2, &t, &w2)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_div_2d(&w2, 2, &w2, NULL)) != AMPLIFY_MP_OKAY)             goto LBL_ERR;
+
+   /** w2 = c4 = (E2 - E1)/3, w1 = c2 = E1 - c4 */
+   if ((err = amplify_mp_sub(&w2, &w1, &w2)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_div_3(&w2, &w2, NULL)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+   if ((err = amplify_mp_sub(&w1, &w2, &w1)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+
+   /** wh = H = (wh - 64*w0 - 16*c2 - 4*c4 - winf)/2 */
+   if ((err = amplify_mp_mul_2d(&w0, 6, &t)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_sub(&wh, &t, &wh)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_mul_2d(&w1, 4, &t)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_sub(&wh, &t, &wh)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_mul_2d(&w2, 2, &t)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_sub(&wh, &t, &wh)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_sub(&wh, &winf, &wh)) != AMPLIFY_MP_OKAY)                  goto LBL_ERR;
+   if ((err = amplify_mp_div_2(&wh, &wh)) != AMPLIFY_MP_OKAY)                       goto LBL_ERR;
+
+   /** wm2 = X = (O2 - O1)/3 */
+   if ((err = amplify_mp_sub(&wm2, &wm1, &wm2)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+   if ((err = amplify_mp_div_3(&wm2, &wm2, NULL)) != AMPLIFY_MP_OKAY)               goto LBL_ERR;
+
+   /** wh = Y = (16*O1 - H)/3 */
+   if ((err = amplify_mp_mul_2d(&wm1, 4, &t)) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   if ((err = amplify_mp_sub(&t, &wh, &wh)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_div_3(&wh, &wh, NULL)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+
+   /** wh = c3 = (Y - X)/3 */
+   if ((err = amplify_mp_sub(&wh, &wm2, &wh)) != AMPLIFY_MP_OKAY)                   goto LBL_ERR;
+   if ((err = amplify_mp_div_3(&wh, &wh, NULL)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+
+   /** wm2 = c5 = (X - c3)/5 */
+   if ((err = amplify_mp_sub(&wm2, &wh, &wm2)) != AMPLIFY_MP_OKAY)                  goto LBL_ERR;
+   if ((err = amplify_mp_div_d(&wm2, 5u, &wm2, NULL)) != AMPLIFY_MP_OKAY)           goto LBL_ERR;
+
+   /** wm1 = c1 = O1 - c3 - c5 */
+   if ((err = amplify_mp_sub(&wm1, &wh, &wm1)) != AMPLIFY_MP_OKAY)                  goto LBL_ERR;
+   if ((err = amplify_mp_sub(&wm1, &wm2, &wm1)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+
+   /** P = winf*x^6 + c5*x^5 + c4*x^4 + c3*x^3 + c2*x^2 + c1*x + w0 */
+   if ((err = amplify_mp_lshd(&winf, 6 * B)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&wm2, 5 * B)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_add(&winf, &wm2, &winf)) != AMPLIFY_MP_OKAY)               goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&w2, 4 * B)) != AMPLIFY_MP_OKAY)                      goto LBL_ERR;
+   if ((err = amplify_mp_add(&winf, &w2, &winf)) != AMPLIFY_MP_OKAY)                goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&wh, 3 * B)) != AMPLIFY_MP_OKAY)                      goto LBL_ERR;
+   if ((err = amplify_mp_add(&winf, &wh, &winf)) != AMPLIFY_MP_OKAY)                goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&w1, 2 * B)) != AMPLIFY_MP_OKAY)                      goto LBL_ERR;
+   if ((err = amplify_mp_add(&winf, &w1, &winf)) != AMPLIFY_MP_OKAY)                goto LBL_ERR;
+   if ((err = amplify_mp_lshd(&wm1, 1 * B)) != AMPLIFY_MP_OKAY)                     goto LBL_ERR;
+   if ((err = amplify_mp_add(&winf, &wm1, &winf)) != AMPLIFY_MP_OKAY)               goto LBL_ERR;
+   if ((err = amplify_mp_add(&winf, &w0, c)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+
+LBL_ERR:
+   while (ib > 0) {
+      amplify_mp_clear(&Bs[--ib]);
+   }
+   while (ia > 0) {
+      amplify_mp_clear(&A[--ia]);
+   }
+   amplify_mp_clear_multi(&w0, &w1, &wm1, &w2, &wm2, &wh, &winf, &t, &u,
+                          &v1, &vm1, &v2, &vm2, &vh, NULL);
+   return err;
+}
+
+#endif
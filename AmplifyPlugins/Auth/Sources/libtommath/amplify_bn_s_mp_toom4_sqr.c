@@ -0,0 +1,12 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_MP_TOOM4_SQR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* squaring using Toom-Cook 4-way algorithm, see amplify_s_mp_toom4_mul */
+amplify_mp_err amplify_s_mp_toom4_sqr(const amplify_mp_int *a, amplify_mp_int *b)
+{
+   return amplify_s_mp_toom4_mul(a, a, b);
+}
+#endif
@@ -0,0 +1,38 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_S_SRP_SHA256_UPDATE_MP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* The bytes are read straight out of the digits a block at a time, no
+ * big endian copy of a is made.
+ */
+void amplify_s_srp_sha256_update_mp(amplify_srp_sha256_ctx *md, const amplify_mp_int *a, int encoding)
+{
+   unsigned char block[64];
+   size_t size, n = 0u, i;
+   int bits = amplify_mp_count_bits(a);
+
+   size = ((size_t)bits + 7u) / 8u;
+   if ((encoding == AMPLIFY_S_SRP_SBIN) || ((encoding == AMPLIFY_S_SRP_SIGNED) && (bits > 0) && ((bits % 8) == 0))) {
+      block[n++] = 0u;
+   }
+
+   /* byte i - 1 from the bottom, it straddles at most two digits */
+   for (i = size; i > 0u; --i) {
+      size_t bit = (i - 1u) * 8u;
+      int ix = (int)(bit / (size_t)AMPLIFY_MP_DIGIT_BIT), sh = (int)(bit % (size_t)AMPLIFY_MP_DIGIT_BIT);
+      amplify_mp_digit d = a->dp[ix] >> sh;
+
+      if (((sh + 8) > AMPLIFY_MP_DIGIT_BIT) && ((ix + 1) < a->used)) {
+         d |= a->dp[ix + 1] << (AMPLIFY_MP_DIGIT_BIT - sh);
+      }
+      block[n++] = (unsigned char)(d & 0xFFu);
+      if (n == sizeof(block)) {
+         amplify_srp_sha256_update(md, block, n);
+         n = 0u;
+      }
+   }
+   amplify_srp_sha256_update(md, block, n);
+}
+#endif
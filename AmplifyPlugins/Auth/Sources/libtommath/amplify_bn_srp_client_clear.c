@@ -0,0 +1,11 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_CLIENT_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+void amplify_srp_client_clear(amplify_srp_client_ctx *ctx)
+{
+   amplify_mp_clear_multi(&ctx->N, &ctx->g, &ctx->k, &ctx->u, &ctx->x, &ctx->base, &ctx->exp, &ctx->t, NULL);
+}
+#endif
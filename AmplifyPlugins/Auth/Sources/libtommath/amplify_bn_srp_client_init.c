@@ -0,0 +1,48 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_CLIENT_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_client_init(amplify_srp_client_ctx *ctx, const amplify_mp_int *N, const amplify_mp_int *g)
+{
+   unsigned char digest[AMPLIFY_SRP_SHA256_SIZE];
+   amplify_srp_sha256_ctx md;
+   amplify_mp_err err;
+
+   ctx->group = NULL;
+   if ((err = amplify_mp_init_copy(&ctx->N, N)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_init_copy(&ctx->g, g)) != AMPLIFY_MP_OKAY) {
+      goto LBL_N;
+   }
+
+   /* the products of amplify_srp_compute_S have twice the digits of N */
+   if ((err = amplify_mp_init_size(&ctx->t, 2 * N->used)) != AMPLIFY_MP_OKAY) {
+      goto LBL_G;
+   }
+   if ((err = amplify_mp_init_multi(&ctx->k, &ctx->u, &ctx->x, &ctx->base, &ctx->exp, NULL)) != AMPLIFY_MP_OKAY) {
+      goto LBL_T;
+   }
+
+   /* k = H(N | g), N in the sign byte format of amplify_mp_to_sbin */
+   amplify_srp_sha256_init(&md);
+   amplify_s_srp_sha256_update_mp(&md, N, AMPLIFY_S_SRP_SBIN);
+   amplify_s_srp_sha256_update_mp(&md, g, AMPLIFY_S_SRP_UNSIGNED);
+   amplify_srp_sha256_final(&md, digest);
+   if ((err = amplify_mp_from_ubin(&ctx->k, digest, sizeof(digest))) != AMPLIFY_MP_OKAY) {
+      amplify_mp_clear_multi(&ctx->k, &ctx->u, &ctx->x, &ctx->base, &ctx->exp, NULL);
+      goto LBL_T;
+   }
+   return AMPLIFY_MP_OKAY;
+
+LBL_T:
+   amplify_mp_clear(&ctx->t);
+LBL_G:
+   amplify_mp_clear(&ctx->g);
+LBL_N:
+   amplify_mp_clear(&ctx->N);
+   return err;
+}
+#endif
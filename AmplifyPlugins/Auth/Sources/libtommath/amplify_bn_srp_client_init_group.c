@@ -0,0 +1,41 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_CLIENT_INIT_GROUP_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_client_init_group(amplify_srp_client_ctx *ctx, const amplify_srp_group *group)
+{
+   amplify_mp_err err;
+
+   if ((err = amplify_mp_init_copy(&ctx->N, &group->N)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_init_copy(&ctx->g, &group->g)) != AMPLIFY_MP_OKAY) {
+      goto LBL_N;
+   }
+   if ((err = amplify_mp_init_copy(&ctx->k, &group->k)) != AMPLIFY_MP_OKAY) {
+      goto LBL_G;
+   }
+
+   /* the products of amplify_srp_compute_S have twice the digits of N */
+   if ((err = amplify_mp_init_size(&ctx->t, 2 * group->N.used)) != AMPLIFY_MP_OKAY) {
+      goto LBL_K;
+   }
+   if ((err = amplify_mp_init_multi(&ctx->u, &ctx->x, &ctx->base, &ctx->exp, NULL)) != AMPLIFY_MP_OKAY) {
+      goto LBL_T;
+   }
+   ctx->group = group;
+   return AMPLIFY_MP_OKAY;
+
+LBL_T:
+   amplify_mp_clear(&ctx->t);
+LBL_K:
+   amplify_mp_clear(&ctx->k);
+LBL_G:
+   amplify_mp_clear(&ctx->g);
+LBL_N:
+   amplify_mp_clear(&ctx->N);
+   return err;
+}
+#endif
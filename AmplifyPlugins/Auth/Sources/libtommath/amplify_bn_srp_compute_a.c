@@ -0,0 +1,14 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_COMPUTE_A_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_compute_A(amplify_srp_client_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *A)
+{
+   if (ctx->group != NULL) {
+      return amplify_srp_group_power(ctx->group, a, A);
+   }
+   return amplify_mp_exptmod(&ctx->g, a, &ctx->N, A);
+}
+#endif
@@ -0,0 +1,23 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_COMPUTE_PREMASTER_SECRET_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_compute_premaster_secret(amplify_srp_client_ctx *ctx, const unsigned char *identity, size_t size,
+      const amplify_mp_int *salt, const amplify_mp_int *a, const amplify_mp_int *A, const amplify_mp_int *B,
+      amplify_mp_int *S)
+{
+   amplify_mp_err err;
+
+   if ((err = amplify_srp_compute_x(salt, identity, size, &ctx->x)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_srp_compute_u(A, B, &ctx->u)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   err = amplify_srp_compute_S(ctx, a, B, &ctx->u, &ctx->x, S);
+   amplify_mp_zero(&ctx->x);
+   return err;
+}
+#endif
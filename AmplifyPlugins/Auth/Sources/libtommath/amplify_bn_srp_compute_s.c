@@ -0,0 +1,44 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_COMPUTE_S_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_compute_S(amplify_srp_client_ctx *ctx, const amplify_mp_int *a, const amplify_mp_int *B,
+                                     const amplify_mp_int *u, const amplify_mp_int *x, amplify_mp_int *S)
+{
+   amplify_mp_err err;
+
+   /* the server must not send a multiple of N */
+   if ((err = amplify_mp_mod(B, &ctx->N, &ctx->base)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if (AMPLIFY_MP_IS_ZERO(&ctx->base)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   /* base = B - k * g^x mod N */
+   if (ctx->group != NULL) {
+      if ((err = amplify_srp_group_power(ctx->group, x, &ctx->t)) != AMPLIFY_MP_OKAY)  goto LBL_ERR;
+   } else {
+      if ((err = amplify_mp_exptmod(&ctx->g, x, &ctx->N, &ctx->t)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   }
+   if ((err = amplify_mp_mulmod(&ctx->k, &ctx->t, &ctx->N, &ctx->t)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+   if ((err = amplify_mp_sub(&ctx->base, &ctx->t, &ctx->base)) != AMPLIFY_MP_OKAY)      goto LBL_ERR;
+   if (ctx->base.sign == AMPLIFY_MP_NEG) {
+      if ((err = amplify_mp_add(&ctx->base, &ctx->N, &ctx->base)) != AMPLIFY_MP_OKAY)   goto LBL_ERR;
+   }
+
+   /* exp = a + u * x */
+   if ((err = amplify_mp_mul(u, x, &ctx->exp)) != AMPLIFY_MP_OKAY)                    goto LBL_ERR;
+   if ((err = amplify_mp_add(&ctx->exp, a, &ctx->exp)) != AMPLIFY_MP_OKAY)            goto LBL_ERR;
+
+   err = amplify_mp_exptmod(&ctx->base, &ctx->exp, &ctx->N, S);
+
+LBL_ERR:
+   /* the exponent and k * g^x give away the password */
+   amplify_mp_zero(&ctx->exp);
+   amplify_mp_zero(&ctx->t);
+   return err;
+}
+#endif
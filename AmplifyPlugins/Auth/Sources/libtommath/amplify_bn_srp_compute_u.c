@@ -0,0 +1,18 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_COMPUTE_U_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_compute_u(const amplify_mp_int *A, const amplify_mp_int *B, amplify_mp_int *u)
+{
+   unsigned char digest[AMPLIFY_SRP_SHA256_SIZE];
+   amplify_srp_sha256_ctx md;
+
+   amplify_srp_sha256_init(&md);
+   amplify_s_srp_sha256_update_mp(&md, A, AMPLIFY_S_SRP_SIGNED);
+   amplify_s_srp_sha256_update_mp(&md, B, AMPLIFY_S_SRP_SIGNED);
+   amplify_srp_sha256_final(&md, digest);
+   return amplify_mp_from_ubin(u, digest, sizeof(digest));
+}
+#endif
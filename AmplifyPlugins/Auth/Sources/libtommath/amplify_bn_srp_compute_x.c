@@ -0,0 +1,26 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_COMPUTE_X_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_compute_x(const amplify_mp_int *salt, const unsigned char *identity, size_t size, amplify_mp_int *x)
+{
+   unsigned char digest[AMPLIFY_SRP_SHA256_SIZE];
+   amplify_srp_sha256_ctx md;
+   amplify_mp_err err;
+
+   amplify_srp_sha256_init(&md);
+   amplify_srp_sha256_update(&md, identity, size);
+   amplify_srp_sha256_final(&md, digest);
+
+   amplify_srp_sha256_init(&md);
+   amplify_s_srp_sha256_update_mp(&md, salt, AMPLIFY_S_SRP_SIGNED);
+   amplify_srp_sha256_update(&md, digest, sizeof(digest));
+   amplify_srp_sha256_final(&md, digest);
+
+   err = amplify_mp_from_ubin(x, digest, sizeof(digest));
+   AMPLIFY_MP_ZERO_BUFFER(digest, sizeof(digest));
+   return err;
+}
+#endif
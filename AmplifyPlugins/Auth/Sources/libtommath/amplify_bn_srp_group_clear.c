@@ -0,0 +1,19 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_GROUP_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+void amplify_srp_group_clear(amplify_srp_group *group)
+{
+   int i;
+
+   for (i = 0; i < group->npowers; i++) {
+      amplify_mp_clear(&group->powers[i]);
+   }
+   AMPLIFY_MP_FREE_BUFFER(group->powers, (size_t)group->npowers * sizeof(amplify_mp_int));
+   group->powers = NULL;
+   group->npowers = 0;
+   amplify_mp_clear_multi(&group->N, &group->g, &group->k, NULL);
+}
+#endif
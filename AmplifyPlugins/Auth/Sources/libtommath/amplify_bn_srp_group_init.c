@@ -0,0 +1,91 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_GROUP_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* powers[i] = g^(2^(w * i)) * R mod N, each one w squarings of the one before */
+static amplify_mp_err s_fill_powers(amplify_srp_group *group, const amplify_mp_int *rr)
+{
+   amplify_mp_err err;
+   int i, j;
+
+   if ((err = amplify_mp_mod(&group->g, &group->N, &group->powers[0])) != AMPLIFY_MP_OKAY)      return err;
+   if ((err = amplify_mp_mul(&group->powers[0], rr, &group->powers[0])) != AMPLIFY_MP_OKAY)     return err;
+   if ((err = amplify_mp_montgomery_reduce(&group->powers[0], &group->N, group->rho)) != AMPLIFY_MP_OKAY) return err;
+
+   for (i = 1; i < group->npowers; i++) {
+      if ((err = amplify_mp_copy(&group->powers[i - 1], &group->powers[i])) != AMPLIFY_MP_OKAY) return err;
+      for (j = 0; j < AMPLIFY_SRP_GROUP_WINDOW; j++) {
+         if ((err = amplify_mp_sqr(&group->powers[i], &group->powers[i])) != AMPLIFY_MP_OKAY)   return err;
+         if ((err = amplify_mp_montgomery_reduce(&group->powers[i], &group->N, group->rho)) != AMPLIFY_MP_OKAY) return err;
+      }
+   }
+   return AMPLIFY_MP_OKAY;
+}
+
+amplify_mp_err amplify_srp_group_init(amplify_srp_group *group, const amplify_mp_int *N, const amplify_mp_int *g)
+{
+   unsigned char digest[AMPLIFY_SRP_SHA256_SIZE];
+   amplify_srp_sha256_ctx md;
+   amplify_mp_int one, rr;
+   amplify_mp_err err;
+   int i, npowers = (AMPLIFY_SRP_GROUP_EXPONENT_BITS + AMPLIFY_SRP_GROUP_WINDOW - 1) / AMPLIFY_SRP_GROUP_WINDOW;
+
+   if (AMPLIFY_MP_IS_EVEN(N) || (amplify_mp_cmp_d(N, 1uL) != AMPLIFY_MP_GT)) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   group->powers = (amplify_mp_int *) AMPLIFY_MP_CALLOC((size_t)npowers, sizeof(amplify_mp_int));
+   if (group->powers == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   for (i = 0; i < npowers; i++) {
+      if ((err = amplify_mp_init_size(&group->powers[i], 2 * N->used + 1)) != AMPLIFY_MP_OKAY) {
+         group->npowers = i;
+         goto LBL_POWERS;
+      }
+   }
+   group->npowers = npowers;
+
+   if ((err = amplify_mp_init_copy(&group->N, N)) != AMPLIFY_MP_OKAY) {
+      goto LBL_POWERS;
+   }
+   if ((err = amplify_mp_init_copy(&group->g, g)) != AMPLIFY_MP_OKAY) {
+      goto LBL_N;
+   }
+   if ((err = amplify_mp_init_multi(&group->k, &one, &rr, NULL)) != AMPLIFY_MP_OKAY) {
+      goto LBL_G;
+   }
+
+   /* k = H(N | g), as amplify_srp_client_init computes it */
+   amplify_srp_sha256_init(&md);
+   amplify_s_srp_sha256_update_mp(&md, N, AMPLIFY_S_SRP_SBIN);
+   amplify_s_srp_sha256_update_mp(&md, g, AMPLIFY_S_SRP_UNSIGNED);
+   amplify_srp_sha256_final(&md, digest);
+   if ((err = amplify_mp_from_ubin(&group->k, digest, sizeof(digest))) != AMPLIFY_MP_OKAY)  goto LBL_ERR;
+
+   if ((err = amplify_mp_montgomery_setup(N, &group->rho)) != AMPLIFY_MP_OKAY)               goto LBL_ERR;
+   if ((err = amplify_mp_montgomery_calc_normalization(&one, N)) != AMPLIFY_MP_OKAY)         goto LBL_ERR;
+   if ((err = amplify_mp_sqrmod(&one, N, &rr)) != AMPLIFY_MP_OKAY)                           goto LBL_ERR;
+   if ((err = s_fill_powers(group, &rr)) != AMPLIFY_MP_OKAY)                                 goto LBL_ERR;
+
+   amplify_mp_clear_multi(&one, &rr, NULL);
+   return AMPLIFY_MP_OKAY;
+
+LBL_ERR:
+   amplify_mp_clear_multi(&group->k, &one, &rr, NULL);
+LBL_G:
+   amplify_mp_clear(&group->g);
+LBL_N:
+   amplify_mp_clear(&group->N);
+LBL_POWERS:
+   for (i = 0; i < group->npowers; i++) {
+      amplify_mp_clear(&group->powers[i]);
+   }
+   AMPLIFY_MP_FREE_BUFFER(group->powers, (size_t)npowers * sizeof(amplify_mp_int));
+   group->powers = NULL;
+   group->npowers = 0;
+   return err;
+}
+#endif
@@ -0,0 +1,90 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_GROUP_POWER_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+#define S_NWINDOWS ((AMPLIFY_SRP_GROUP_EXPONENT_BITS + AMPLIFY_SRP_GROUP_WINDOW - 1) / AMPLIFY_SRP_GROUP_WINDOW)
+
+/* Yao's fixed base exponentiation
+ *
+ * With e = sum e_i * 2^(w * i) and x_i = g^(2^(w * i)) from the table,
+ * g^e = prod_{d = 1}^{2^w - 1} (prod_{e_i = d} x_i)^d. Going down from the
+ * largest d, run collects the x_i of the windows equal to d and acc takes
+ * run once per d, so acc gets every x_i exactly e_i times.
+ */
+amplify_mp_err amplify_srp_group_power(const amplify_srp_group *group, const amplify_mp_int *e, amplify_mp_int *A)
+{
+   unsigned char windows[S_NWINDOWS];
+   amplify_mp_int acc, run;
+   amplify_mp_bool acc_is_one = AMPLIFY_MP_YES, run_is_one = AMPLIFY_MP_YES;
+   amplify_mp_err err;
+   int i, j, bit, d;
+
+   if ((e->sign == AMPLIFY_MP_NEG) || (group->npowers != S_NWINDOWS) ||
+       (amplify_mp_count_bits(e) > (S_NWINDOWS * AMPLIFY_SRP_GROUP_WINDOW))) {
+      return amplify_mp_exptmod(&group->g, e, &group->N, A);
+   }
+
+   for (i = 0; i < S_NWINDOWS; i++) {
+      d = 0;
+      for (j = AMPLIFY_SRP_GROUP_WINDOW - 1; j >= 0; j--) {
+         bit = (i * AMPLIFY_SRP_GROUP_WINDOW) + j;
+         d <<= 1;
+         if ((bit / AMPLIFY_MP_DIGIT_BIT) < e->used) {
+            d |= (int)((e->dp[bit / AMPLIFY_MP_DIGIT_BIT] >> (bit % AMPLIFY_MP_DIGIT_BIT)) & 1u);
+         }
+      }
+      windows[i] = (unsigned char)d;
+   }
+
+   if ((err = amplify_mp_init_size(&acc, 2 * group->N.used + 1)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_init_size(&run, 2 * group->N.used + 1)) != AMPLIFY_MP_OKAY) {
+      goto LBL_ACC;
+   }
+
+   /* products with the Montgomery one are copies */
+   for (d = (1 << AMPLIFY_SRP_GROUP_WINDOW) - 1; d > 0; d--) {
+      for (i = 0; i < S_NWINDOWS; i++) {
+         if (windows[i] != d) {
+            continue;
+         }
+         if (run_is_one == AMPLIFY_MP_YES) {
+            if ((err = amplify_mp_copy(&group->powers[i], &run)) != AMPLIFY_MP_OKAY)                  goto LBL_ERR;
+            run_is_one = AMPLIFY_MP_NO;
+         } else {
+            if ((err = amplify_mp_mul(&run, &group->powers[i], &run)) != AMPLIFY_MP_OKAY)             goto LBL_ERR;
+            if ((err = amplify_mp_montgomery_reduce(&run, &group->N, group->rho)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+         }
+      }
+      if (run_is_one == AMPLIFY_MP_YES) {
+         continue;
+      }
+      if (acc_is_one == AMPLIFY_MP_YES) {
+         if ((err = amplify_mp_copy(&run, &acc)) != AMPLIFY_MP_OKAY)                                  goto LBL_ERR;
+         acc_is_one = AMPLIFY_MP_NO;
+      } else {
+         if ((err = amplify_mp_mul(&acc, &run, &acc)) != AMPLIFY_MP_OKAY)                             goto LBL_ERR;
+         if ((err = amplify_mp_montgomery_reduce(&acc, &group->N, group->rho)) != AMPLIFY_MP_OKAY)    goto LBL_ERR;
+      }
+   }
+
+   /* leave the Montgomery domain, g^0 is 1 */
+   if (acc_is_one == AMPLIFY_MP_YES) {
+      amplify_mp_set(A, 1uL);
+   } else {
+      if ((err = amplify_mp_montgomery_reduce(&acc, &group->N, group->rho)) != AMPLIFY_MP_OKAY)       goto LBL_ERR;
+      amplify_mp_exch(&acc, A);
+   }
+
+LBL_ERR:
+   amplify_mp_clear(&run);
+LBL_ACC:
+   amplify_mp_clear(&acc);
+   return err;
+}
+
+#undef S_NWINDOWS
+#endif
@@ -0,0 +1,300 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_GROUP_VALIDATE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* SRP group validation.
+ *
+ * The groups of RFC 5054 appendix A are recognised by the SHA-256 digest of
+ * their big endian encoding. Any other modulus p must pass
+ *
+ *  - p = 11 (mod 12) and one sieve pass over the prime table that rejects
+ *    p = 0 (p composite) and p = 1 (q = (p-1)/2 composite) for every prime,
+ *  - 2^q = +-1 (mod p), by Pocklington's theorem this proves p prime once
+ *    q > sqrt(p) is known to be prime,
+ *  - Miller-Rabin on q to base 2 and AMPLIFY_SRP_GROUP_MR_ROUNDS random bases
+ *    followed by a strong Lucas test, all in one Montgomery context.
+ *
+ * Verdicts for other moduli are memoized per process.
+ */
+
+#ifndef AMPLIFY_SRP_GROUP_MR_ROUNDS
+#  define AMPLIFY_SRP_GROUP_MR_ROUNDS 2
+#endif
+#ifndef AMPLIFY_SRP_GROUP_CACHE_SIZE
+#  define AMPLIFY_SRP_GROUP_CACHE_SIZE 8
+#endif
+
+/* SHA-256 of the moduli of RFC 5054 appendix A */
+static const unsigned char s_rfc5054_digests[][AMPLIFY_SRP_SHA256_SIZE] = {
+   { /* 1024 */
+      0x49, 0x4b, 0x6a, 0x80, 0x1b, 0x37, 0x9f, 0x37, 0xc9, 0xee, 0x25, 0xd5, 0xdb, 0x7c, 0xd7, 0x0f,
+      0xfc, 0xfe, 0x53, 0xd0, 0x1b, 0x7c, 0x9e, 0x44, 0x70, 0xea, 0xca, 0x46, 0xbd, 0xa2, 0x4b, 0x39
+   },
+   { /* 1536 */
+      0x72, 0xaf, 0x4a, 0x20, 0xe5, 0x01, 0xa8, 0x93, 0xb7, 0xdc, 0x85, 0xf4, 0xef, 0xac, 0x51, 0x84,
+      0x5a, 0xb2, 0x1c, 0x10, 0x2d, 0x1e, 0x73, 0xf7, 0x00, 0x0e, 0xc6, 0x62, 0xdf, 0x7e, 0x20, 0x69
+   },
+   { /* 2048 */
+      0x91, 0xb7, 0x1d, 0x6b, 0x40, 0xd4, 0x39, 0x95, 0x45, 0x68, 0xd4, 0x12, 0xe8, 0x83, 0xde, 0x51,
+      0x86, 0xf9, 0x38, 0x1e, 0x25, 0xae, 0xf3, 0x6e, 0x7a, 0x46, 0x07, 0x72, 0x2f, 0x7e, 0x15, 0xca
+   },
+   { /* 3072 */
+      0x48, 0xcf, 0x8b, 0x09, 0x2f, 0xbc, 0xe4, 0x35, 0x9d, 0x98, 0x71, 0xab, 0xf7, 0x4f, 0x98, 0xe2,
+      0x5b, 0x61, 0x63, 0x37, 0x9e, 0xaa, 0x15, 0xcd, 0x90, 0x87, 0xe8, 0x00, 0xc6, 0xd1, 0xc5, 0x5c
+   },
+   { /* 4096 */
+      0x4e, 0xe9, 0x51, 0x87, 0x68, 0x2b, 0xcb, 0x23, 0x0a, 0xd2, 0x6a, 0x95, 0x20, 0x5f, 0x69, 0x20,
+      0xe8, 0x47, 0x08, 0xf6, 0x25, 0x1b, 0x38, 0x94, 0x32, 0x9b, 0x09, 0xec, 0x23, 0x91, 0x9e, 0x33
+   },
+   { /* 6144 */
+      0xd1, 0xbf, 0xe6, 0xd0, 0x92, 0x5c, 0xe7, 0xe4, 0xda, 0x26, 0x2b, 0x62, 0x86, 0x15, 0x14, 0xa7,
+      0x75, 0x5e, 0x35, 0x83, 0x1e, 0x42, 0x9f, 0x34, 0x3e, 0x7b, 0x86, 0x48, 0x48, 0x65, 0x7e, 0xfd
+   },
+   { /* 8192 */
+      0x39, 0xab, 0x4f, 0xea, 0xb9, 0x50, 0xa3, 0x12, 0x8f, 0xb7, 0x1a, 0xcc, 0xb9, 0xfc, 0x39, 0x65,
+      0xd8, 0x57, 0x01, 0x2e, 0x08, 0x19, 0x98, 0xa8, 0x59, 0x96, 0xe3, 0xea, 0x8b, 0x3c, 0x3b, 0xcf
+   }
+};
+
+/* memoized verdicts, replaced round robin */
+typedef struct {
+   unsigned char digest[AMPLIFY_SRP_SHA256_SIZE];
+   amplify_mp_bool safe;
+   int used;
+} s_group_verdict;
+
+#if defined(_WIN32)
+#include <windows.h>
+static SRWLOCK s_cache_lock = SRWLOCK_INIT;
+#  define S_CACHE_LOCK()   AcquireSRWLockExclusive(&s_cache_lock)
+#  define S_CACHE_UNLOCK() ReleaseSRWLockExclusive(&s_cache_lock)
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+static pthread_mutex_t s_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#  define S_CACHE_LOCK()   (void)pthread_mutex_lock(&s_cache_lock)
+#  define S_CACHE_UNLOCK() (void)pthread_mutex_unlock(&s_cache_lock)
+#else
+/* without a lock nothing is memoized */
+#  undef AMPLIFY_SRP_GROUP_CACHE_SIZE
+#  define AMPLIFY_SRP_GROUP_CACHE_SIZE 0
+#  define S_CACHE_LOCK()
+#  define S_CACHE_UNLOCK()
+#endif
+
+#if AMPLIFY_SRP_GROUP_CACHE_SIZE > 0
+static s_group_verdict s_cache[AMPLIFY_SRP_GROUP_CACHE_SIZE];
+static unsigned s_cache_next;
+#endif
+
+static int s_digest_equal(const unsigned char *a, const unsigned char *b)
+{
+   int i;
+   for (i = 0; i < AMPLIFY_SRP_SHA256_SIZE; ++i) {
+      if (a[i] != b[i]) {
+         return 0;
+      }
+   }
+   return 1;
+}
+
+static amplify_mp_bool s_cache_lookup(const unsigned char *digest, amplify_mp_bool *safe)
+{
+   amplify_mp_bool found = AMPLIFY_MP_NO;
+#if AMPLIFY_SRP_GROUP_CACHE_SIZE > 0
+   int i;
+   S_CACHE_LOCK();
+   for (i = 0; i < AMPLIFY_SRP_GROUP_CACHE_SIZE; ++i) {
+      if ((s_cache[i].used != 0) && s_digest_equal(s_cache[i].digest, digest)) {
+         *safe = s_cache[i].safe;
+         found = AMPLIFY_MP_YES;
+         break;
+      }
+   }
+   S_CACHE_UNLOCK();
+#else
+   (void)digest;
+   (void)safe;
+#endif
+   return found;
+}
+
+static void s_cache_store(const unsigned char *digest, amplify_mp_bool safe)
+{
+#if AMPLIFY_SRP_GROUP_CACHE_SIZE > 0
+   s_group_verdict *v;
+   int i;
+   S_CACHE_LOCK();
+   v = &s_cache[s_cache_next++ % AMPLIFY_SRP_GROUP_CACHE_SIZE];
+   for (i = 0; i < AMPLIFY_SRP_SHA256_SIZE; ++i) {
+      v->digest[i] = digest[i];
+   }
+   v->safe = safe;
+   v->used = 1;
+   S_CACHE_UNLOCK();
+#else
+   (void)digest;
+   (void)safe;
+#endif
+}
+
+/* BPSW style test of odd q > 3: Miller-Rabin to base 2 and "rounds" random
+ * bases followed by a strong Lucas test, all sharing one Montgomery context
+ */
+static amplify_mp_err s_is_probable_prime(const amplify_mp_int *q, int rounds, amplify_mp_bool *result)
+{
+   amplify_s_mp_mont_ctx ctx;
+   amplify_mp_int bound, base;
+   amplify_mp_err err;
+   int i;
+
+   *result = AMPLIFY_MP_NO;
+
+   if ((err = amplify_s_mp_mont_init(&ctx, q)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_init_multi(&bound, &base, NULL)) != AMPLIFY_MP_OKAY) {
+      amplify_s_mp_mont_clear(&ctx);
+      return err;
+   }
+
+   /* random bases are drawn from [2, q-2] */
+   if ((err = amplify_mp_sub_d(q, 3uL, &bound)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+
+   for (i = 0; i <= rounds; ++i) {
+      if (i == 0) {
+         amplify_mp_set(&base, 2uL);
+      } else {
+         if ((err = amplify_mp_rand_range(&base, &bound)) != AMPLIFY_MP_OKAY)       goto LBL_ERR;
+         if ((err = amplify_amplify_mp_add_d(&base, 2uL, &base)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      }
+      if ((err = amplify_s_mp_prime_miller_rabin(&ctx, &base, result)) != AMPLIFY_MP_OKAY) goto LBL_ERR;
+      if (*result == AMPLIFY_MP_NO) {
+         goto LBL_ERR;
+      }
+   }
+
+   if (AMPLIFY_MP_HAS(MP_PRIME_STRONG_LUCAS_SELFRIDGE)) {
+      err = amplify_s_mp_prime_strong_lucas_selfridge(&ctx, result);
+   }
+
+LBL_ERR:
+   amplify_mp_clear_multi(&bound, &base, NULL);
+   amplify_s_mp_mont_clear(&ctx);
+   return err;
+}
+
+static amplify_mp_err s_is_safe_prime(const amplify_mp_int *p, amplify_mp_bool *result)
+{
+   amplify_mp_int q, t;
+   amplify_mp_digit r;
+   amplify_mp_err err;
+   int i;
+
+   *result = AMPLIFY_MP_NO;
+
+   /* p = 3 (mod 4) and p = 2 (mod 3) for every safe prime p > 7 */
+   if ((err = amplify_mp_mod_d(p, 12u, &r)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if (r != 11u) {
+      return AMPLIFY_MP_OKAY;
+   }
+
+   /* p = 0 (mod r) or q = 0 (mod r), i.e. p = 1 (mod r) */
+   for (i = 2; i < PRIVATE_MP_PRIME_TAB_SIZE; ++i) {
+      if ((err = amplify_mp_mod_d(p, amplify_s_mp_prime_tab[i], &r)) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+      if (r <= 1u) {
+         return AMPLIFY_MP_OKAY;
+      }
+   }
+
+   if ((err = amplify_mp_init_multi(&q, &t, NULL)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   if ((err = amplify_mp_div_2(p, &q)) != AMPLIFY_MP_OKAY)                          goto LBL_ERR;
+
+   /* Pocklington with a = 2: 2^(p-1) = (2^q)^2 = 1 (mod p) and gcd(2^2 - 1, p) = 1 */
+   amplify_mp_set(&t, 2uL);
+   if ((err = amplify_mp_exptmod(&t, &q, p, &t)) != AMPLIFY_MP_OKAY)                goto LBL_ERR;
+   if (amplify_mp_cmp_d(&t, 1uL) != AMPLIFY_MP_EQ) {
+      if ((err = amplify_amplify_mp_add_d(&t, 1uL, &t)) != AMPLIFY_MP_OKAY)                 goto LBL_ERR;
+      if (amplify_mp_cmp(&t, p) != AMPLIFY_MP_EQ) {
+         goto LBL_ERR;
+      }
+   }
+
+   /* q must be prime for the above to hold */
+   err = s_is_probable_prime(&q, AMPLIFY_SRP_GROUP_MR_ROUNDS, result);
+
+LBL_ERR:
+   amplify_mp_clear_multi(&q, &t, NULL);
+   return err;
+}
+
+amplify_mp_err amplify_srp_group_validate(const amplify_mp_int *N, const amplify_mp_int *g, amplify_mp_bool *result)
+{
+   unsigned char digest[AMPLIFY_SRP_SHA256_SIZE];
+   amplify_srp_sha256_ctx ctx;
+   amplify_mp_bool safe = AMPLIFY_MP_NO;
+   amplify_mp_int t;
+   amplify_mp_err err;
+   unsigned char *buf;
+   size_t size, i;
+
+   *result = AMPLIFY_MP_NO;
+
+   if ((N->sign == AMPLIFY_MP_NEG) || (amplify_mp_count_bits(N) < AMPLIFY_SRP_GROUP_MIN_BITS)) {
+      return AMPLIFY_MP_OKAY;
+   }
+
+   /* 1 < g < N-1 */
+   if ((g->sign == AMPLIFY_MP_NEG) || (amplify_mp_cmp_d(g, 1uL) != AMPLIFY_MP_GT)) {
+      return AMPLIFY_MP_OKAY;
+   }
+   if ((err = amplify_mp_init(&t)) != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+   err = amplify_amplify_mp_add_d(g, 1uL, &t);
+   if ((err == AMPLIFY_MP_OKAY) && (amplify_mp_cmp(&t, N) != AMPLIFY_MP_LT)) {
+      amplify_mp_clear(&t);
+      return AMPLIFY_MP_OKAY;
+   }
+   amplify_mp_clear(&t);
+   if (err != AMPLIFY_MP_OKAY) {
+      return err;
+   }
+
+   size = amplify_mp_ubin_size(N);
+   if ((buf = (unsigned char *) AMPLIFY_MP_MALLOC(size)) == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   if ((err = amplify_mp_to_ubin(N, buf, size, NULL)) != AMPLIFY_MP_OKAY) {
+      AMPLIFY_MP_FREE_BUFFER(buf, size);
+      return err;
+   }
+   amplify_srp_sha256_init(&ctx);
+   amplify_srp_sha256_update(&ctx, buf, size);
+   amplify_srp_sha256_final(&ctx, digest);
+   AMPLIFY_MP_FREE_BUFFER(buf, size);
+
+   for (i = 0u; i < (sizeof(s_rfc5054_digests) / sizeof(s_rfc5054_digests[0])); ++i) {
+      if (s_digest_equal(s_rfc5054_digests[i], digest)) {
+         *result = AMPLIFY_MP_YES;
+         return AMPLIFY_MP_OKAY;
+      }
+   }
+
+   if (s_cache_lookup(digest, &safe) == AMPLIFY_MP_NO) {
+      if ((err = s_is_safe_prime(N, &safe)) != AMPLIFY_MP_OKAY) {
+         return err;
+      }
+      s_cache_store(digest, safe);
+   }
+   *result = safe;
+   return AMPLIFY_MP_OKAY;
+}
+#endif
@@ -0,0 +1,19 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_KEY_POOL_CLEAR_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+void amplify_srp_key_pool_clear(amplify_srp_key_pool *pool)
+{
+   int i;
+
+   /* amplify_mp_clear wipes the digits */
+   for (i = 0; i < (2 * pool->size); i++) {
+      amplify_mp_clear(&pool->a[i]);
+   }
+   AMPLIFY_MP_FREE_BUFFER(pool->a, (size_t)(2 * pool->size) * sizeof(amplify_mp_int));
+   pool->a = pool->A = NULL;
+   pool->size = pool->head = pool->used = 0;
+}
+#endif
@@ -0,0 +1,36 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_KEY_POOL_INIT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_key_pool_init(amplify_srp_key_pool *pool, int size)
+{
+   amplify_mp_err err;
+   int i;
+
+   if (size < 1) {
+      return AMPLIFY_MP_VAL;
+   }
+
+   pool->a = (amplify_mp_int *) AMPLIFY_MP_CALLOC((size_t)(2 * size), sizeof(amplify_mp_int));
+   if (pool->a == NULL) {
+      return AMPLIFY_MP_MEM;
+   }
+   pool->A = pool->a + size;
+
+   for (i = 0; i < (2 * size); i++) {
+      if ((err = amplify_mp_init(&pool->a[i])) != AMPLIFY_MP_OKAY) {
+         while (--i >= 0) {
+            amplify_mp_clear(&pool->a[i]);
+         }
+         AMPLIFY_MP_FREE_BUFFER(pool->a, (size_t)(2 * size) * sizeof(amplify_mp_int));
+         return err;
+      }
+   }
+   pool->size = size;
+   pool->head = 0;
+   pool->used = 0;
+   return AMPLIFY_MP_OKAY;
+}
+#endif
@@ -0,0 +1,22 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_KEY_POOL_PUT_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_err amplify_srp_key_pool_put(amplify_srp_key_pool *pool, amplify_mp_int *a, amplify_mp_int *A)
+{
+   int i;
+
+   if (pool->used == pool->size) {
+      return AMPLIFY_MP_BUF;
+   }
+
+   /* the digits move into the ring, a and A get the wiped ones of the slot */
+   i = (pool->head + pool->used) % pool->size;
+   amplify_mp_exch(&pool->a[i], a);
+   amplify_mp_exch(&pool->A[i], A);
+   pool->used++;
+   return AMPLIFY_MP_OKAY;
+}
+#endif
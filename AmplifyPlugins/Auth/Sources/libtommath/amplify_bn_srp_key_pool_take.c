@@ -0,0 +1,25 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_KEY_POOL_TAKE_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+amplify_mp_bool amplify_srp_key_pool_take(amplify_srp_key_pool *pool, amplify_mp_int *a, amplify_mp_int *A)
+{
+   int i;
+
+   if (pool->used == 0) {
+      return AMPLIFY_MP_NO;
+   }
+
+   /* the old values of a and A are wiped as they enter the ring */
+   i = pool->head;
+   amplify_mp_zero(a);
+   amplify_mp_zero(A);
+   amplify_mp_exch(&pool->a[i], a);
+   amplify_mp_exch(&pool->A[i], A);
+   pool->head = (pool->head + 1) % pool->size;
+   pool->used--;
+   return AMPLIFY_MP_YES;
+}
+#endif
@@ -0,0 +1,141 @@
+#include "amplify_tommath_private.h"
+#ifdef AMPLIFY_BN_SRP_SHA256_C
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+/* SHA-256 as specified in FIPS 180-4 */
+
+static const uint32_t s_k[64] = {
+   0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu, 0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u,
+   0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u, 0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u,
+   0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu, 0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau,
+   0x983e5152u, 0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u, 0x06ca6351u, 0x14292967u,
+   0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+   0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u,
+   0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu, 0x682e6ff3u,
+   0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u, 0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u
+};
+
+#define ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void s_sha256_compress(uint32_t state[8], const unsigned char block[64])
+{
+   uint32_t w[64], a, b, c, d, e, f, g, h, t1, t2;
+   int i;
+
+   for (i = 0; i < 16; ++i) {
+      w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[(4 * i) + 1] << 16) |
+             ((uint32_t)block[(4 * i) + 2] << 8) | (uint32_t)block[(4 * i) + 3];
+   }
+   for (i = 16; i < 64; ++i) {
+      uint32_t s0 = ROTR32(w[i - 15], 7) ^ ROTR32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+      uint32_t s1 = ROTR32(w[i - 2], 17) ^ ROTR32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+      w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+   }
+
+   a = state[0];
+   b = state[1];
+   c = state[2];
+   d = state[3];
+   e = state[4];
+   f = state[5];
+   g = state[6];
+   h = state[7];
+   for (i = 0; i < 64; ++i) {
+      t1 = h + (ROTR32(e, 6) ^ ROTR32(e, 11) ^ ROTR32(e, 25)) + ((e & f) ^ (~e & g)) + s_k[i] + w[i];
+      t2 = (ROTR32(a, 2) ^ ROTR32(a, 13) ^ ROTR32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+      h = g;
+      g = f;
+      f = e;
+      e = d + t1;
+      d = c;
+      c = b;
+      b = a;
+      a = t1 + t2;
+   }
+   state[0] += a;
+   state[1] += b;
+   state[2] += c;
+   state[3] += d;
+   state[4] += e;
+   state[5] += f;
+   state[6] += g;
+   state[7] += h;
+
+   AMPLIFY_MP_ZERO_BUFFER(w, sizeof(w));
+}
+
+void amplify_srp_sha256_init(amplify_srp_sha256_ctx *ctx)
+{
+   static const uint32_t iv[8] = {
+      0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au, 0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
+   };
+   int i;
+   for (i = 0; i < 8; ++i) {
+      ctx->state[i] = iv[i];
+   }
+   ctx->length = 0u;
+   ctx->buflen = 0u;
+}
+
+void amplify_srp_sha256_update(amplify_srp_sha256_ctx *ctx, const void *data, size_t size)
+{
+   const unsigned char *p = (const unsigned char *)data;
+
+   ctx->length += (uint64_t)size;
+   if (ctx->buflen > 0u) {
+      size_t n = AMPLIFY_MP_MIN(size, 64u - ctx->buflen), i;
+      for (i = 0u; i < n; ++i) {
+         ctx->buf[ctx->buflen + i] = p[i];
+      }
+      ctx->buflen += n;
+      p += n;
+      size -= n;
+      if (ctx->buflen < 64u) {
+         return;
+      }
+      s_sha256_compress(ctx->state, ctx->buf);
+      ctx->buflen = 0u;
+   }
+   while (size >= 64u) {
+      s_sha256_compress(ctx->state, p);
+      p += 64;
+      size -= 64u;
+   }
+   for (ctx->buflen = 0u; ctx->buflen < size; ++ctx->buflen) {
+      ctx->buf[ctx->buflen] = p[ctx->buflen];
+   }
+}
+
+void amplify_srp_sha256_final(amplify_srp_sha256_ctx *ctx, unsigned char out[AMPLIFY_SRP_SHA256_SIZE])
+{
+   uint64_t bits = ctx->length * 8u;
+   int i;
+
+   ctx->buf[ctx->buflen++] = 0x80u;
+   if (ctx->buflen > 56u) {
+      while (ctx->buflen < 64u) {
+         ctx->buf[ctx->buflen++] = 0u;
+      }
+      s_sha256_compress(ctx->state, ctx->buf);
+      ctx->buflen = 0u;
+   }
+   while (ctx->buflen < 56u) {
+      ctx->buf[ctx->buflen++] = 0u;
+   }
+   for (i = 0; i < 8; ++i) {
+      ctx->buf[56 + i] = (unsigned char)(bits >> (56 - (8 * i)));
+   }
+   s_sha256_compress(ctx->state, ctx->buf);
+
+   for (i = 0; i < 8; ++i) {
+      out[4 * i]       = (unsigned char)(ctx->state[i] >> 24);
+      out[(4 * i) + 1] = (unsigned char)(ctx->state[i] >> 16);
+      out[(4 * i) + 2] = (unsigned char)(ctx->state[i] >> 8);
+      out[(4 * i) + 3] = (unsigned char)ctx->state[i];
+   }
+
+   AMPLIFY_MP_ZERO_BUFFER(ctx, sizeof(*ctx));
+}
+#endif
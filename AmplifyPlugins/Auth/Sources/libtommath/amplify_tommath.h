@@ -182,7 +182,11 @@ extern int
 AMPLIFY_KARATSUBA_MUL_CUTOFF,
 AMPLIFY_KARATSUBA_SQR_CUTOFF,
 AMPLIFY_TOOM_MUL_CUTOFF,
-AMPLIFY_TOOM_SQR_CUTOFF;
+AMPLIFY_TOOM_SQR_CUTOFF,
+AMPLIFY_TOOM4_MUL_CUTOFF,
+AMPLIFY_TOOM4_SQR_CUTOFF,
+AMPLIFY_FFT_MUL_CUTOFF,
+AMPLIFY_FFT_SQR_CUTOFF;
 #endif
 
 /* define this to use lower memory usage routines (exptmods mostly) */
@@ -429,6 +433,11 @@ amplify_mp_err amplify_mp_rand(amplify_mp_int *a, int digits) AMPLIFY_MP_WUR;
 AMPLIFY_MP_DEPRECATED(amplify_mp_rand) amplify_mp_err amplify_mp_rand_digit(amplify_mp_digit *r) AMPLIFY_MP_WUR;
 /* use custom random data source instead of source provided the platform */
 void amplify_mp_rand_source(amplify_mp_err(*source)(void *out, size_t size));
+/* makes a uniformly random r with 0 <= r < N, r and N must not alias */
+amplify_mp_err amplify_mp_rand_range(amplify_mp_int *r, const amplify_mp_int *N) AMPLIFY_MP_WUR;
+/* buffered per-thread ChaCha20 generator reseeded from the platform source,
+ * install with amplify_mp_rand_source(amplify_mp_rand_chacha20) */
+amplify_mp_err amplify_mp_rand_chacha20(void *out, size_t size) AMPLIFY_MP_WUR;
 
 #ifdef AMPLIFY_MP_PRNG_ENABLE_LTM_RNG
 #  warning AMPLIFY_MP_PRNG_ENABLE_LTM_RNG has been deprecated, use amplify_mp_rand_source instead.
@@ -625,6 +634,53 @@ amplify_mp_err amplify_mp_reduce_2k_l(amplify_mp_int *a, const amplify_mp_int *n
 /* Y = G**X (mod P) */
 amplify_mp_err amplify_mp_exptmod(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y) AMPLIFY_MP_WUR;
 
+/* Y = G**X (mod P) in slices, for callers that must not block for the whole
+ * exponentiation, e.g. cooperative thread pools.
+ *
+ * amplify_mp_exptmod_begin copies X and P and precomputes the window table,
+ * every amplify_mp_exptmod_step scans at most budget windows of X and
+ * amplify_mp_exptmod_finish stores Y once *done is set.  Odd P > 1 runs
+ * Montgomery's method on the digits; any other modulus is computed whole by
+ * begin, and the first step reports done.  finish and clear wipe the
+ * state, clear abandons it at any point, also after an error.
+ */
+typedef struct {
+   amplify_mp_int P, X, res;
+   amplify_mp_int *M;           /* odd powers of G in the Montgomery domain */
+   amplify_mp_digit rho;
+   amplify_mp_bool mont;        /* res is in the Montgomery domain */
+   int winsize, bit;            /* next bit of X to scan, -1 at the end */
+} amplify_mp_exptmod_state;
+
+amplify_mp_err amplify_mp_exptmod_begin(amplify_mp_exptmod_state *st, const amplify_mp_int *G, const amplify_mp_int *X,
+                                        const amplify_mp_int *P) AMPLIFY_MP_WUR;
+amplify_mp_err amplify_mp_exptmod_step(amplify_mp_exptmod_state *st, int budget, amplify_mp_bool *done) AMPLIFY_MP_WUR;
+/* AMPLIFY_MP_VAL while steps are left */
+amplify_mp_err amplify_mp_exptmod_finish(amplify_mp_exptmod_state *st, amplify_mp_int *Y) AMPLIFY_MP_WUR;
+void amplify_mp_exptmod_clear(amplify_mp_exptmod_state *st);
+
+/* Y = G**X (mod P) for P the product of distinct odd primes p[0], ..., p[count-1].
+ *
+ * amplify_mp_crt_init copies the factors and precomputes their Montgomery
+ * constants and the Garner coefficients (p[0] * ... * p[i-1])**-1 (mod p[i]),
+ * AMPLIFY_MP_VAL if a factor is even, below 3, fails amplify_mp_prime_is_prime
+ * or shares a divisor with another.
+ * amplify_mp_exptmod_crt raises G to X >= 0 modulo every factor, with X reduced
+ * modulo p[i] - 1, and joins the residues by Garner's method.  The factors are
+ * handed out to "threads" threads, the calling one included.  The context is
+ * only read by amplify_mp_exptmod_crt, one context can serve several callers.
+ */
+typedef struct {
+   amplify_mp_int P;                      /* the product of the factors */
+   struct amplify_s_mp_crt_factor *f;     /* per factor constants, see amplify_bn_mp_crt_init.c */
+   int count;
+} amplify_mp_crt_ctx;
+
+amplify_mp_err amplify_mp_crt_init(amplify_mp_crt_ctx *ctx, const amplify_mp_int *p, int count) AMPLIFY_MP_WUR;
+void amplify_mp_crt_clear(amplify_mp_crt_ctx *ctx);
+amplify_mp_err amplify_mp_exptmod_crt(const amplify_mp_crt_ctx *ctx, const amplify_mp_int *G, const amplify_mp_int *X,
+                                      amplify_mp_int *Y, int threads) AMPLIFY_MP_WUR;
+
 /* ---> Primes <--- */
 
 /* number of primes */
@@ -717,6 +773,13 @@ AMPLIFY_MP_DEPRECATED(amplify_mp_prime_rand) amplify_mp_err amplify_mp_prime_ran
       private_amplify_mp_prime_callback cb, void *dat) AMPLIFY_MP_WUR;
 amplify_mp_err amplify_mp_prime_rand(amplify_mp_int *a, int t, int size, int flags) AMPLIFY_MP_WUR;
 
+/* amplify_mp_prime_rand spread over "threads" threads, the calling one included.
+ * Candidates are handed out to the threads and the search stops at the first
+ * confirmed prime. The installed random source must be thread safe.
+ * Without thread support this is amplify_mp_prime_rand.
+ */
+amplify_mp_err amplify_mp_prime_rand_parallel(amplify_mp_int *a, int t, int size, int flags, int threads) AMPLIFY_MP_WUR;
+
 /* Integer logarithm to integer base */
 amplify_mp_err amplify_mp_log_u32(const amplify_mp_int *a, uint32_t base, uint32_t *c) AMPLIFY_MP_WUR;
 
@@ -753,6 +816,11 @@ AMPLIFY_MP_DEPRECATED(amplify_mp_to_radix) amplify_mp_err amplify_amplify_mp_tor
 amplify_mp_err amplify_mp_to_radix(const amplify_mp_int *a, char *str, size_t maxlen, size_t *written, int radix) AMPLIFY_MP_WUR;
 amplify_mp_err amplify_mp_radix_size(const amplify_mp_int *a, int radix, int *size) AMPLIFY_MP_WUR;
 
+/* single pass hexadecimal conversion, amplify_mp_read_radix and
+ * amplify_mp_to_radix use it for radix 16 */
+amplify_mp_err amplify_mp_read_hex(amplify_mp_int *a, const char *str, size_t size) AMPLIFY_MP_WUR;
+amplify_mp_err amplify_mp_write_hex(const amplify_mp_int *a, char *str, size_t maxlen, size_t *written) AMPLIFY_MP_WUR;
+
 #ifndef AMPLIFY_MP_NO_FILE
 amplify_mp_err amplify_mp_fread(amplify_mp_int *a, int radix, FILE *stream) AMPLIFY_MP_WUR;
 amplify_mp_err amplify_mp_fwrite(const amplify_mp_int *a, int radix, FILE *stream) AMPLIFY_MP_WUR;
@@ -775,6 +843,45 @@ amplify_mp_err amplify_mp_fwrite(const amplify_mp_int *a, int radix, FILE *strea
 #define amplify_mp_to_decimal(M, S, N) amplify_mp_to_radix((M), (S), (N), NULL, 10)
 #define amplify_mp_to_hex(M, S, N)     amplify_mp_to_radix((M), (S), (N), NULL, 16)
 
+/* Instrumentation
+ * ---------------
+ *
+ * Compiling with AMPLIFY_MP_STATS counts calls, operand digits and time
+ * spent in the primitives below as well as the heap traffic of the
+ * AMPLIFY_MP_*ALLOC macros. Counters are kept per thread, time is
+ * inclusive, i.e. an exptmod also accounts for its own mul/sqr/reduce calls.
+ *
+ * Without AMPLIFY_MP_STATS the functions exist but report zeros.
+ */
+#define AMPLIFY_MP_STATS_MUL       0
+#define AMPLIFY_MP_STATS_SQR       1
+#define AMPLIFY_MP_STATS_REDUCE    2 /* Montgomery, Barrett and diminished radix */
+#define AMPLIFY_MP_STATS_DIV       3
+#define AMPLIFY_MP_STATS_EXPTMOD   4
+#define AMPLIFY_MP_STATS_TO_RADIX  5
+#define AMPLIFY_MP_STATS_FROM_UBIN 6
+#define AMPLIFY_MP_STATS_OPS       7
+
+typedef struct {
+   uint64_t calls;
+   uint64_t digits;        /* sum of the operand sizes in digits */
+   uint64_t nanoseconds;
+} amplify_mp_op_stats;
+
+typedef struct {
+   amplify_mp_op_stats ops[AMPLIFY_MP_STATS_OPS];
+   uint64_t allocs, alloc_bytes;       /* AMPLIFY_MP_MALLOC and AMPLIFY_MP_CALLOC */
+   uint64_t reallocs, realloc_bytes;   /* AMPLIFY_MP_REALLOC, bytes of the new size */
+   uint64_t frees, free_bytes;
+} amplify_mp_stats;
+
+/* AMPLIFY_MP_YES if the library was compiled with AMPLIFY_MP_STATS */
+amplify_mp_bool amplify_mp_stats_enabled(void) AMPLIFY_MP_WUR;
+/* copy the counters of the calling thread */
+void amplify_mp_stats_snapshot(amplify_mp_stats *stats);
+/* zero the counters of the calling thread */
+void amplify_mp_stats_reset(void);
+
 #ifdef __cplusplus
 }
 #endif
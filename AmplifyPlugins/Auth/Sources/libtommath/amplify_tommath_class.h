@@ -30,6 +30,8 @@
 #   define AMPLIFY_BN_MP_COMPLEMENT_C
 #   define AMPLIFY_BN_MP_COPY_C
 #   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_CRT_CLEAR_C
+#   define AMPLIFY_BN_MP_CRT_INIT_C
 #   define AMPLIFY_BN_MP_DECR_C
 #   define AMPLIFY_BN_MP_DIV_C
 #   define AMPLIFY_BN_MP_DIV_2_C
@@ -43,6 +45,11 @@
 #   define AMPLIFY_BN_MP_EXCH_C
 #   define AMPLIFY_BN_MP_EXPT_U32_C
 #   define AMPLIFY_BN_MP_EXPTMOD_C
+#   define AMPLIFY_BN_MP_EXPTMOD_BEGIN_C
+#   define AMPLIFY_BN_MP_EXPTMOD_CLEAR_C
+#   define AMPLIFY_BN_MP_EXPTMOD_CRT_C
+#   define AMPLIFY_BN_MP_EXPTMOD_FINISH_C
+#   define AMPLIFY_BN_MP_EXPTMOD_STEP_C
 #   define AMPLIFY_BN_MP_EXTEUCLID_C
 #   define AMPLIFY_BN_MP_FREAD_C
 #   define AMPLIFY_BN_MP_FROM_SBIN_C
@@ -103,10 +110,14 @@
 #   define AMPLIFY_BN_MP_PRIME_NEXT_PRIME_C
 #   define AMPLIFY_BN_MP_PRIME_RABIN_MILLER_TRIALS_C
 #   define AMPLIFY_BN_MP_PRIME_RAND_C
+#   define AMPLIFY_BN_MP_PRIME_RAND_PARALLEL_C
 #   define AMPLIFY_BN_MP_PRIME_STRONG_LUCAS_SELFRIDGE_C
 #   define AMPLIFY_BN_MP_RADIX_SIZE_C
 #   define AMPLIFY_BN_MP_RADIX_SMAP_C
 #   define AMPLIFY_BN_MP_RAND_C
+#   define AMPLIFY_BN_MP_RAND_CHACHA20_C
+#   define AMPLIFY_BN_MP_RAND_RANGE_C
+#   define AMPLIFY_BN_MP_READ_HEX_C
 #   define AMPLIFY_BN_MP_READ_RADIX_C
 #   define AMPLIFY_BN_MP_REDUCE_C
 #   define AMPLIFY_BN_MP_REDUCE_2K_C
@@ -135,6 +146,7 @@
 #   define AMPLIFY_BN_MP_SQRMOD_C
 #   define AMPLIFY_BN_MP_SQRT_C
 #   define AMPLIFY_BN_MP_SQRTMOD_PRIME_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_MP_SUB_C
 #   define AMPLIFY_BN_MP_SUB_D_C
 #   define AMPLIFY_BN_MP_SUBMOD_C
@@ -143,32 +155,74 @@
 #   define AMPLIFY_BN_MP_TO_UBIN_C
 #   define AMPLIFY_BN_MP_UBIN_SIZE_C
 #   define AMPLIFY_BN_MP_UNPACK_C
+#   define AMPLIFY_BN_MP_WRITE_HEX_C
 #   define AMPLIFY_BN_MP_XOR_C
 #   define AMPLIFY_BN_MP_ZERO_C
 #   define AMPLIFY_BN_PRIME_TAB_C
 #   define AMPLIFY_BN_S_MP_ADD_C
+#   define AMPLIFY_BN_S_MP_ADD_SPAN_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_ADX_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_KERNEL_C
 #   define AMPLIFY_BN_S_MP_BALANCE_MUL_C
+#   define AMPLIFY_BN_S_MP_CPU_FEATURES_C
+#   define AMPLIFY_BN_S_MP_DIFF_SPAN_C
 #   define AMPLIFY_BN_S_MP_EXPTMOD_C
+#   define AMPLIFY_BN_S_MP_EXPTMOD_EVEN_C
 #   define AMPLIFY_BN_S_MP_EXPTMOD_FAST_C
+#   define AMPLIFY_BN_S_MP_EXPTMOD_LIMB64_C
+#   define AMPLIFY_BN_S_MP_FFT_MUL_C
+#   define AMPLIFY_BN_S_MP_FFT_SQR_C
+#   define AMPLIFY_BN_S_MP_FROM_BIN_C
 #   define AMPLIFY_BN_S_MP_GET_BIT_C
+#   define AMPLIFY_BN_S_MP_INIT_SLICE_C
 #   define AMPLIFY_BN_S_MP_INVMOD_FAST_C
 #   define AMPLIFY_BN_S_MP_INVMOD_SLOW_C
 #   define AMPLIFY_BN_S_MP_KARATSUBA_MUL_C
 #   define AMPLIFY_BN_S_MP_KARATSUBA_SQR_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
+#   define AMPLIFY_BN_S_MP_MONT_EXPTMOD_C
 #   define AMPLIFY_BN_S_MP_MONTGOMERY_REDUCE_FAST_C
 #   define AMPLIFY_BN_S_MP_MUL_DIGS_C
 #   define AMPLIFY_BN_S_MP_MUL_DIGS_FAST_C
 #   define AMPLIFY_BN_S_MP_MUL_HIGH_DIGS_C
 #   define AMPLIFY_BN_S_MP_MUL_HIGH_DIGS_FAST_C
+#   define AMPLIFY_BN_S_MP_PRIME_IS_CANDIDATE_C
 #   define AMPLIFY_BN_S_MP_PRIME_IS_DIVISIBLE_C
+#   define AMPLIFY_BN_S_MP_PRIME_SIEVE_C
+#   define AMPLIFY_BN_S_MP_PRIME_START_C
 #   define AMPLIFY_BN_S_MP_RAND_JENKINS_C
 #   define AMPLIFY_BN_S_MP_RAND_PLATFORM_C
 #   define AMPLIFY_BN_S_MP_REVERSE_C
 #   define AMPLIFY_BN_S_MP_SQR_C
 #   define AMPLIFY_BN_S_MP_SQR_FAST_C
 #   define AMPLIFY_BN_S_MP_SUB_C
+#   define AMPLIFY_BN_S_MP_SUB_SPAN_C
+#   define AMPLIFY_BN_S_MP_TO_BIN_C
+#   define AMPLIFY_BN_S_MP_TOOM32_MUL_C
+#   define AMPLIFY_BN_S_MP_TOOM42_MUL_C
+#   define AMPLIFY_BN_S_MP_TOOM4_MUL_C
+#   define AMPLIFY_BN_S_MP_TOOM4_SQR_C
 #   define AMPLIFY_BN_S_MP_TOOM_MUL_C
 #   define AMPLIFY_BN_S_MP_TOOM_SQR_C
+#   define AMPLIFY_BN_S_SRP_SHA256_UPDATE_MP_C
+#   define AMPLIFY_BN_SRP_CLIENT_CLEAR_C
+#   define AMPLIFY_BN_SRP_CLIENT_INIT_C
+#   define AMPLIFY_BN_SRP_CLIENT_INIT_GROUP_C
+#   define AMPLIFY_BN_SRP_COMPUTE_A_C
+#   define AMPLIFY_BN_SRP_COMPUTE_PREMASTER_SECRET_C
+#   define AMPLIFY_BN_SRP_COMPUTE_S_C
+#   define AMPLIFY_BN_SRP_COMPUTE_U_C
+#   define AMPLIFY_BN_SRP_COMPUTE_X_C
+#   define AMPLIFY_BN_SRP_GROUP_CLEAR_C
+#   define AMPLIFY_BN_SRP_GROUP_INIT_C
+#   define AMPLIFY_BN_SRP_GROUP_POWER_C
+#   define AMPLIFY_BN_SRP_GROUP_VALIDATE_C
+#   define AMPLIFY_BN_SRP_KEY_POOL_CLEAR_C
+#   define AMPLIFY_BN_SRP_KEY_POOL_INIT_C
+#   define AMPLIFY_BN_SRP_KEY_POOL_PUT_C
+#   define AMPLIFY_BN_SRP_KEY_POOL_TAKE_C
+#   define AMPLIFY_BN_SRP_SHA256_C
 #endif
 #endif
 #if defined(AMPLIFY_BN_CUTOFFS_C)
@@ -329,6 +383,27 @@
 #if defined(AMPLIFY_BN_MP_COUNT_BITS_C)
 #endif
 
+#if defined(AMPLIFY_BN_MP_CRT_CLEAR_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_CRT_INIT_C)
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_CRT_CLEAR_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_INIT_SET_C
+#   define AMPLIFY_BN_MP_INVMOD_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_PRIME_IS_PRIME_C
+#   define AMPLIFY_BN_MP_PRIME_RABIN_MILLER_TRIALS_C
+#   define AMPLIFY_BN_MP_SUB_D_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
+#endif
+
 #if defined(AMPLIFY_BN_MP_DECR_C)
 #   define AMPLIFY_BN_MP_INCR_C
 #   define AMPLIFY_BN_MP_SET_C
@@ -353,6 +428,7 @@
 #   define AMPLIFY_BN_MP_MUL_2D_C
 #   define AMPLIFY_BN_MP_MUL_D_C
 #   define AMPLIFY_BN_MP_RSHD_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_MP_SUB_C
 #   define AMPLIFY_BN_MP_ZERO_C
 #endif
@@ -394,6 +470,7 @@
 #   define AMPLIFY_BN_MP_CLAMP_C
 #   define AMPLIFY_BN_MP_CMP_MAG_C
 #   define AMPLIFY_BN_MP_GROW_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_S_MP_SUB_C
 #endif
 
@@ -420,10 +497,73 @@
 #   define AMPLIFY_BN_MP_DR_IS_MODULUS_C
 #   define AMPLIFY_BN_MP_INIT_MULTI_C
 #   define AMPLIFY_BN_MP_INVMOD_C
+#   define AMPLIFY_BN_MP_MOD_C
 #   define AMPLIFY_BN_MP_REDUCE_IS_2K_C
 #   define AMPLIFY_BN_MP_REDUCE_IS_2K_L_C
+#   define AMPLIFY_BN_MP_STATS_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_KERNEL_C
 #   define AMPLIFY_BN_S_MP_EXPTMOD_C
+#   define AMPLIFY_BN_S_MP_EXPTMOD_EVEN_C
 #   define AMPLIFY_BN_S_MP_EXPTMOD_FAST_C
+#   define AMPLIFY_BN_S_MP_EXPTMOD_LIMB64_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_EXPTMOD_BEGIN_C)
+#   define AMPLIFY_BN_MP_ABS_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_EXPTMOD_C
+#   define AMPLIFY_BN_MP_EXPTMOD_CLEAR_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#   define AMPLIFY_BN_MP_INVMOD_C
+#   define AMPLIFY_BN_MP_MOD_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_REDUCE_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_SETUP_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_MULMOD_C
+#   define AMPLIFY_BN_MP_SQR_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_EXPTMOD_CLEAR_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_EXPTMOD_CRT_C)
+#   define AMPLIFY_BN_MP_ADD_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_INIT_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#   define AMPLIFY_BN_MP_MOD_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_MULMOD_C
+#   define AMPLIFY_BN_MP_SET_C
+#   define AMPLIFY_BN_MP_SUB_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_KERNEL_C
+#   define AMPLIFY_BN_S_MP_EXPTMOD_LIMB64_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
+#   define AMPLIFY_BN_S_MP_MONT_EXPTMOD_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_EXPTMOD_FINISH_C)
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_EXPTMOD_CLEAR_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_REDUCE_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_EXPTMOD_STEP_C)
+#   define AMPLIFY_BN_MP_MONTGOMERY_REDUCE_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_SQR_C
+#   define AMPLIFY_BN_S_MP_GET_BIT_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_EXTEUCLID_C)
@@ -449,10 +589,8 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_FROM_UBIN_C)
-#   define AMPLIFY_BN_MP_CLAMP_C
-#   define AMPLIFY_BN_MP_GROW_C
-#   define AMPLIFY_BN_MP_MUL_2D_C
-#   define AMPLIFY_BN_MP_ZERO_C
+#   define AMPLIFY_BN_MP_STATS_C
+#   define AMPLIFY_BN_S_MP_FROM_BIN_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_FWRITE_C)
@@ -504,6 +642,7 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_GROW_C)
+#   define AMPLIFY_BN_MP_STATS_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_INCR_C)
@@ -513,6 +652,7 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_INIT_C)
+#   define AMPLIFY_BN_MP_STATS_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_INIT_COPY_C)
@@ -552,6 +692,7 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_INIT_SIZE_C)
+#   define AMPLIFY_BN_MP_STATS_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_INIT_U32_C)
@@ -667,6 +808,7 @@
 #   define AMPLIFY_BN_MP_CMP_MAG_C
 #   define AMPLIFY_BN_MP_GROW_C
 #   define AMPLIFY_BN_MP_RSHD_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_S_MP_MONTGOMERY_REDUCE_FAST_C
 #   define AMPLIFY_BN_S_MP_SUB_C
 #endif
@@ -675,10 +817,15 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_MUL_C)
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_S_MP_BALANCE_MUL_C
+#   define AMPLIFY_BN_S_MP_FFT_MUL_C
 #   define AMPLIFY_BN_S_MP_KARATSUBA_MUL_C
 #   define AMPLIFY_BN_S_MP_MUL_DIGS_C
 #   define AMPLIFY_BN_S_MP_MUL_DIGS_FAST_C
+#   define AMPLIFY_BN_S_MP_TOOM32_MUL_C
+#   define AMPLIFY_BN_S_MP_TOOM42_MUL_C
+#   define AMPLIFY_BN_S_MP_TOOM4_MUL_C
 #   define AMPLIFY_BN_S_MP_TOOM_MUL_C
 #endif
 
@@ -715,10 +862,8 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_PACK_C)
-#   define AMPLIFY_BN_MP_CLEAR_C
-#   define AMPLIFY_BN_MP_DIV_2D_C
-#   define AMPLIFY_BN_MP_INIT_COPY_C
 #   define AMPLIFY_BN_MP_PACK_COUNT_C
+#   define AMPLIFY_BN_S_MP_TO_BIN_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_PACK_COUNT_C)
@@ -768,31 +913,39 @@
 #   define AMPLIFY_BN_MP_RAND_C
 #   define AMPLIFY_BN_MP_READ_RADIX_C
 #   define AMPLIFY_BN_MP_SET_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
 #   define AMPLIFY_BN_S_MP_PRIME_IS_DIVISIBLE_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_PRIME_MILLER_RABIN_C)
 #   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
 #   define AMPLIFY_BN_MP_CMP_C
 #   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_CMP_MAG_C
 #   define AMPLIFY_BN_MP_CNT_LSB_C
 #   define AMPLIFY_BN_MP_DIV_2D_C
 #   define AMPLIFY_BN_MP_EXPTMOD_C
 #   define AMPLIFY_BN_MP_INIT_C
 #   define AMPLIFY_BN_MP_INIT_COPY_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_MOD_C
 #   define AMPLIFY_BN_MP_SQRMOD_C
 #   define AMPLIFY_BN_MP_SUB_D_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
+#   define AMPLIFY_BN_S_MP_MONT_EXPTMOD_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_PRIME_NEXT_PRIME_C)
 #   define AMPLIFY_BN_MP_ADD_D_C
 #   define AMPLIFY_BN_MP_CLEAR_C
 #   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_EXCH_C
 #   define AMPLIFY_BN_MP_INIT_C
-#   define AMPLIFY_BN_MP_MOD_D_C
 #   define AMPLIFY_BN_MP_PRIME_IS_PRIME_C
 #   define AMPLIFY_BN_MP_SET_C
 #   define AMPLIFY_BN_MP_SUB_D_C
+#   define AMPLIFY_BN_S_MP_PRIME_SIEVE_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_PRIME_RABIN_MILLER_TRIALS_C)
@@ -800,42 +953,51 @@
 
 #if defined(AMPLIFY_BN_MP_PRIME_RAND_C)
 #   define AMPLIFY_BN_MP_ADD_D_C
-#   define AMPLIFY_BN_MP_DIV_2_C
-#   define AMPLIFY_BN_MP_FROM_UBIN_C
-#   define AMPLIFY_BN_MP_MUL_2_C
-#   define AMPLIFY_BN_MP_PRIME_IS_PRIME_C
-#   define AMPLIFY_BN_MP_SUB_D_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_INIT_C
+#   define AMPLIFY_BN_S_MP_PRIME_IS_CANDIDATE_C
 #   define AMPLIFY_BN_S_MP_PRIME_RANDOM_EX_C
+#   define AMPLIFY_BN_S_MP_PRIME_SIEVE_C
+#   define AMPLIFY_BN_S_MP_PRIME_START_C
 #   define AMPLIFY_BN_S_MP_RAND_CB_C
 #   define AMPLIFY_BN_S_MP_RAND_SOURCE_C
 #endif
 
+#if defined(AMPLIFY_BN_MP_PRIME_RAND_PARALLEL_C)
+#   define AMPLIFY_BN_MP_ADD_D_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_INIT_C
+#   define AMPLIFY_BN_MP_PRIME_RAND_C
+#   define AMPLIFY_BN_S_MP_PRIME_IS_CANDIDATE_C
+#   define AMPLIFY_BN_S_MP_PRIME_SIEVE_C
+#   define AMPLIFY_BN_S_MP_PRIME_START_C
+#   define AMPLIFY_BN_S_MP_RAND_SOURCE_C
+#endif
+
 #if defined(AMPLIFY_BN_MP_PRIME_STRONG_LUCAS_SELFRIDGE_C)
 #   define AMPLIFY_BN_MP_ADD_C
 #   define AMPLIFY_BN_MP_ADD_D_C
-#   define AMPLIFY_BN_MP_CLEAR_C
 #   define AMPLIFY_BN_MP_CLEAR_MULTI_C
 #   define AMPLIFY_BN_MP_CMP_C
 #   define AMPLIFY_BN_MP_CMP_D_C
 #   define AMPLIFY_BN_MP_CNT_LSB_C
+#   define AMPLIFY_BN_MP_COPY_C
 #   define AMPLIFY_BN_MP_COUNT_BITS_C
-#   define AMPLIFY_BN_MP_DIV_2D_C
 #   define AMPLIFY_BN_MP_DIV_2_C
+#   define AMPLIFY_BN_MP_DIV_2D_C
 #   define AMPLIFY_BN_MP_GCD_C
-#   define AMPLIFY_BN_MP_INIT_C
 #   define AMPLIFY_BN_MP_INIT_MULTI_C
 #   define AMPLIFY_BN_MP_KRONECKER_C
 #   define AMPLIFY_BN_MP_MOD_C
-#   define AMPLIFY_BN_MP_MUL_2_C
-#   define AMPLIFY_BN_MP_MUL_C
-#   define AMPLIFY_BN_MP_SET_C
-#   define AMPLIFY_BN_MP_SET_I32_C
-#   define AMPLIFY_BN_MP_SET_U32_C
-#   define AMPLIFY_BN_MP_SQR_C
 #   define AMPLIFY_BN_MP_SUB_C
-#   define AMPLIFY_BN_MP_SUB_D_C
 #   define AMPLIFY_BN_S_MP_GET_BIT_C
-#   define AMPLIFY_BN_S_MP_MUL_SI_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_RADIX_SIZE_C)
@@ -856,9 +1018,29 @@
 #   define AMPLIFY_BN_S_MP_RAND_SOURCE_C
 #endif
 
+#if defined(AMPLIFY_BN_MP_RAND_CHACHA20_C)
+#   define AMPLIFY_BN_S_MP_RAND_PLATFORM_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_RAND_RANGE_C)
+#   define AMPLIFY_BN_MP_CLAMP_C
+#   define AMPLIFY_BN_MP_CMP_MAG_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_GROW_C
+#   define AMPLIFY_BN_MP_ZERO_C
+#   define AMPLIFY_BN_S_MP_RAND_SOURCE_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_READ_HEX_C)
+#   define AMPLIFY_BN_MP_CLAMP_C
+#   define AMPLIFY_BN_MP_GROW_C
+#   define AMPLIFY_BN_MP_ZERO_C
+#endif
+
 #if defined(AMPLIFY_BN_MP_READ_RADIX_C)
 #   define AMPLIFY_BN_MP_ADD_D_C
 #   define AMPLIFY_BN_MP_MUL_D_C
+#   define AMPLIFY_BN_MP_READ_HEX_C
 #   define AMPLIFY_BN_MP_ZERO_C
 #endif
 
@@ -873,6 +1055,7 @@
 #   define AMPLIFY_BN_MP_MUL_C
 #   define AMPLIFY_BN_MP_RSHD_C
 #   define AMPLIFY_BN_MP_SET_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_MP_SUB_C
 #   define AMPLIFY_BN_S_MP_MUL_DIGS_C
 #   define AMPLIFY_BN_S_MP_MUL_HIGH_DIGS_C
@@ -887,6 +1070,7 @@
 #   define AMPLIFY_BN_MP_DIV_2D_C
 #   define AMPLIFY_BN_MP_INIT_C
 #   define AMPLIFY_BN_MP_MUL_D_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_S_MP_ADD_C
 #   define AMPLIFY_BN_S_MP_SUB_C
 #endif
@@ -898,6 +1082,7 @@
 #   define AMPLIFY_BN_MP_DIV_2D_C
 #   define AMPLIFY_BN_MP_INIT_C
 #   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_S_MP_ADD_C
 #   define AMPLIFY_BN_S_MP_SUB_C
 #endif
@@ -1003,9 +1188,12 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_SQR_C)
+#   define AMPLIFY_BN_MP_STATS_C
+#   define AMPLIFY_BN_S_MP_FFT_SQR_C
 #   define AMPLIFY_BN_S_MP_KARATSUBA_SQR_C
 #   define AMPLIFY_BN_S_MP_SQR_C
 #   define AMPLIFY_BN_S_MP_SQR_FAST_C
+#   define AMPLIFY_BN_S_MP_TOOM4_SQR_C
 #   define AMPLIFY_BN_S_MP_TOOM_SQR_C
 #endif
 
@@ -1047,6 +1235,9 @@
 #   define AMPLIFY_BN_MP_ZERO_C
 #endif
 
+#if defined(AMPLIFY_BN_MP_STATS_C)
+#endif
+
 #if defined(AMPLIFY_BN_MP_SUB_C)
 #   define AMPLIFY_BN_MP_CMP_MAG_C
 #   define AMPLIFY_BN_S_MP_ADD_C
@@ -1070,6 +1261,8 @@
 #   define AMPLIFY_BN_MP_CLEAR_C
 #   define AMPLIFY_BN_MP_DIV_D_C
 #   define AMPLIFY_BN_MP_INIT_COPY_C
+#   define AMPLIFY_BN_MP_STATS_C
+#   define AMPLIFY_BN_MP_WRITE_HEX_C
 #   define AMPLIFY_BN_S_MP_REVERSE_C
 #endif
 
@@ -1078,10 +1271,8 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_TO_UBIN_C)
-#   define AMPLIFY_BN_MP_CLEAR_C
-#   define AMPLIFY_BN_MP_DIV_2D_C
-#   define AMPLIFY_BN_MP_INIT_COPY_C
 #   define AMPLIFY_BN_MP_UBIN_SIZE_C
+#   define AMPLIFY_BN_S_MP_TO_BIN_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_UBIN_SIZE_C)
@@ -1089,9 +1280,11 @@
 #endif
 
 #if defined(AMPLIFY_BN_MP_UNPACK_C)
-#   define AMPLIFY_BN_MP_CLAMP_C
-#   define AMPLIFY_BN_MP_MUL_2D_C
-#   define AMPLIFY_BN_MP_ZERO_C
+#   define AMPLIFY_BN_S_MP_FROM_BIN_C
+#endif
+
+#if defined(AMPLIFY_BN_MP_WRITE_HEX_C)
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
 #endif
 
 #if defined(AMPLIFY_BN_MP_XOR_C)
@@ -1110,6 +1303,20 @@
 #   define AMPLIFY_BN_MP_GROW_C
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_ADD_SPAN_C)
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_ADDMUL_ROW64_C)
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_ADDMUL_ROW64_ADX_C)
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_ADDMUL_ROW64_KERNEL_C)
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_ADX_C
+#   define AMPLIFY_BN_S_MP_CPU_FEATURES_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_BALANCE_MUL_C)
 #   define AMPLIFY_BN_MP_ADD_C
 #   define AMPLIFY_BN_MP_CLAMP_C
@@ -1122,6 +1329,13 @@
 #   define AMPLIFY_BN_MP_MUL_C
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_CPU_FEATURES_C)
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_DIFF_SPAN_C)
+#   define AMPLIFY_BN_S_MP_SUB_SPAN_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_EXPTMOD_C)
 #   define AMPLIFY_BN_MP_CLEAR_C
 #   define AMPLIFY_BN_MP_COPY_C
@@ -1138,6 +1352,32 @@
 #   define AMPLIFY_BN_MP_SQR_C
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_EXPTMOD_EVEN_C)
+#   define AMPLIFY_BN_MP_2EXPT_C
+#   define AMPLIFY_BN_MP_ADD_C
+#   define AMPLIFY_BN_MP_ADD_D_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_CMP_C
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_CNT_LSB_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_DIV_2D_C
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_MOD_C
+#   define AMPLIFY_BN_MP_MOD_2D_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_SET_C
+#   define AMPLIFY_BN_MP_SET_U32_C
+#   define AMPLIFY_BN_MP_SUB_C
+#   define AMPLIFY_BN_MP_ZERO_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_KERNEL_C
+#   define AMPLIFY_BN_S_MP_EXPTMOD_FAST_C
+#   define AMPLIFY_BN_S_MP_EXPTMOD_LIMB64_C
+#   define AMPLIFY_BN_S_MP_MUL_DIGS_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_EXPTMOD_FAST_C)
 #   define AMPLIFY_BN_MP_CLEAR_C
 #   define AMPLIFY_BN_MP_COPY_C
@@ -1159,9 +1399,45 @@
 #   define AMPLIFY_BN_S_MP_MONTGOMERY_REDUCE_FAST_C
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_EXPTMOD_LIMB64_C)
+#   define AMPLIFY_BN_MP_2EXPT_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_INIT_C
+#   define AMPLIFY_BN_MP_MOD_C
+#   define AMPLIFY_BN_MP_PACK_C
+#   define AMPLIFY_BN_MP_STATS_C
+#   define AMPLIFY_BN_MP_UNPACK_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_C
+#   define AMPLIFY_BN_S_MP_ADDMUL_ROW64_KERNEL_C
+#   define AMPLIFY_BN_S_MP_GET_BIT_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_FFT_MUL_C)
+#   define AMPLIFY_BN_MP_CLAMP_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_FFT_SQR_C)
+#   define AMPLIFY_BN_S_MP_FFT_MUL_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_FROM_BIN_C)
+#   define AMPLIFY_BN_MP_CLAMP_C
+#   define AMPLIFY_BN_MP_GROW_C
+#   define AMPLIFY_BN_MP_ZERO_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_GET_BIT_C)
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_INIT_SLICE_C)
+#   define AMPLIFY_BN_MP_CLAMP_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_INVMOD_FAST_C)
 #   define AMPLIFY_BN_MP_ADD_C
 #   define AMPLIFY_BN_MP_CLEAR_MULTI_C
@@ -1193,31 +1469,56 @@
 #endif
 
 #if defined(AMPLIFY_BN_S_MP_KARATSUBA_MUL_C)
-#   define AMPLIFY_BN_MP_ADD_C
 #   define AMPLIFY_BN_MP_CLAMP_C
 #   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_EXCH_C
 #   define AMPLIFY_BN_MP_INIT_SIZE_C
-#   define AMPLIFY_BN_MP_LSHD_C
-#   define AMPLIFY_BN_MP_MUL_C
-#   define AMPLIFY_BN_S_MP_ADD_C
-#   define AMPLIFY_BN_S_MP_SUB_C
+#   define AMPLIFY_BN_S_MP_ADD_SPAN_C
+#   define AMPLIFY_BN_S_MP_DIFF_SPAN_C
+#   define AMPLIFY_BN_S_MP_SUB_SPAN_C
 #endif
 
 #if defined(AMPLIFY_BN_S_MP_KARATSUBA_SQR_C)
-#   define AMPLIFY_BN_MP_ADD_C
 #   define AMPLIFY_BN_MP_CLAMP_C
 #   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_EXCH_C
 #   define AMPLIFY_BN_MP_INIT_SIZE_C
-#   define AMPLIFY_BN_MP_LSHD_C
+#   define AMPLIFY_BN_S_MP_ADD_SPAN_C
+#   define AMPLIFY_BN_S_MP_DIFF_SPAN_C
+#   define AMPLIFY_BN_S_MP_SUB_SPAN_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_MONT_CTX_C)
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_REDUCE_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_SETUP_C
+#   define AMPLIFY_BN_MP_MUL_C
 #   define AMPLIFY_BN_MP_SQR_C
-#   define AMPLIFY_BN_S_MP_ADD_C
-#   define AMPLIFY_BN_S_MP_SUB_C
+#   define AMPLIFY_BN_MP_SQRMOD_C
+#   define AMPLIFY_BN_MP_SUB_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_MONT_EXPTMOD_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#   define AMPLIFY_BN_S_MP_GET_BIT_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
 #endif
 
 #if defined(AMPLIFY_BN_S_MP_MONTGOMERY_REDUCE_FAST_C)
 #   define AMPLIFY_BN_MP_CLAMP_C
 #   define AMPLIFY_BN_MP_CMP_MAG_C
 #   define AMPLIFY_BN_MP_GROW_C
+#   define AMPLIFY_BN_MP_STATS_C
 #   define AMPLIFY_BN_S_MP_SUB_C
 #endif
 
@@ -1247,10 +1548,26 @@
 #   define AMPLIFY_BN_MP_GROW_C
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_PRIME_IS_CANDIDATE_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_DIV_2_C
+#   define AMPLIFY_BN_MP_INIT_SET_C
+#   define AMPLIFY_BN_MP_PRIME_IS_PRIME_C
+#   define AMPLIFY_BN_MP_PRIME_MILLER_RABIN_C
+#   define AMPLIFY_BN_MP_SUB_D_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_PRIME_IS_DIVISIBLE_C)
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_PRIME_SIEVE_C)
 #   define AMPLIFY_BN_MP_MOD_D_C
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_PRIME_START_C)
+#   define AMPLIFY_BN_MP_FROM_UBIN_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_RAND_JENKINS_C)
 #   define AMPLIFY_BN_S_MP_RAND_JENKINS_INIT_C
 #endif
@@ -1278,6 +1595,61 @@
 #   define AMPLIFY_BN_MP_GROW_C
 #endif
 
+#if defined(AMPLIFY_BN_S_MP_SUB_SPAN_C)
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_TO_BIN_C)
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_TOOM32_MUL_C)
+#   define AMPLIFY_BN_MP_ADD_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_DIV_2_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_LSHD_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_SUB_C
+#   define AMPLIFY_BN_S_MP_INIT_SLICE_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_TOOM42_MUL_C)
+#   define AMPLIFY_BN_MP_ADD_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_DIV_2_C
+#   define AMPLIFY_BN_MP_DIV_3_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_LSHD_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_MUL_2_C
+#   define AMPLIFY_BN_MP_MUL_2D_C
+#   define AMPLIFY_BN_MP_SUB_C
+#   define AMPLIFY_BN_S_MP_INIT_SLICE_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_TOOM4_MUL_C)
+#   define AMPLIFY_BN_MP_ADD_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_DIV_2_C
+#   define AMPLIFY_BN_MP_DIV_2D_C
+#   define AMPLIFY_BN_MP_DIV_3_C
+#   define AMPLIFY_BN_MP_DIV_D_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_LSHD_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_MUL_2_C
+#   define AMPLIFY_BN_MP_MUL_2D_C
+#   define AMPLIFY_BN_MP_SQR_C
+#   define AMPLIFY_BN_MP_SUB_C
+#   define AMPLIFY_BN_S_MP_INIT_SLICE_C
+#endif
+
+#if defined(AMPLIFY_BN_S_MP_TOOM4_SQR_C)
+#   define AMPLIFY_BN_S_MP_TOOM4_MUL_C
+#endif
+
 #if defined(AMPLIFY_BN_S_MP_TOOM_MUL_C)
 #   define AMPLIFY_BN_MP_ADD_C
 #   define AMPLIFY_BN_MP_CLAMP_C
@@ -1307,6 +1679,149 @@
 #   define AMPLIFY_BN_MP_SUB_C
 #endif
 
+#if defined(AMPLIFY_BN_S_SRP_SHA256_UPDATE_MP_C)
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_SRP_SHA256_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_CLIENT_CLEAR_C)
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_CLIENT_INIT_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_FROM_UBIN_C
+#   define AMPLIFY_BN_MP_INIT_COPY_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#   define AMPLIFY_BN_SRP_SHA256_C
+#   define AMPLIFY_BN_S_SRP_SHA256_UPDATE_MP_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_CLIENT_INIT_GROUP_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_INIT_COPY_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_COMPUTE_A_C)
+#   define AMPLIFY_BN_MP_EXPTMOD_C
+#   define AMPLIFY_BN_SRP_GROUP_POWER_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_COMPUTE_PREMASTER_SECRET_C)
+#   define AMPLIFY_BN_MP_ZERO_C
+#   define AMPLIFY_BN_SRP_COMPUTE_S_C
+#   define AMPLIFY_BN_SRP_COMPUTE_U_C
+#   define AMPLIFY_BN_SRP_COMPUTE_X_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_COMPUTE_S_C)
+#   define AMPLIFY_BN_MP_ADD_C
+#   define AMPLIFY_BN_MP_EXPTMOD_C
+#   define AMPLIFY_BN_MP_MOD_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_MULMOD_C
+#   define AMPLIFY_BN_MP_SUB_C
+#   define AMPLIFY_BN_MP_ZERO_C
+#   define AMPLIFY_BN_SRP_GROUP_POWER_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_COMPUTE_U_C)
+#   define AMPLIFY_BN_MP_FROM_UBIN_C
+#   define AMPLIFY_BN_SRP_SHA256_C
+#   define AMPLIFY_BN_S_SRP_SHA256_UPDATE_MP_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_COMPUTE_X_C)
+#   define AMPLIFY_BN_MP_FROM_UBIN_C
+#   define AMPLIFY_BN_SRP_SHA256_C
+#   define AMPLIFY_BN_S_SRP_SHA256_UPDATE_MP_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_GROUP_CLEAR_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_GROUP_INIT_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_FROM_UBIN_C
+#   define AMPLIFY_BN_MP_INIT_COPY_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#   define AMPLIFY_BN_MP_MOD_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_REDUCE_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_SETUP_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_SQR_C
+#   define AMPLIFY_BN_MP_SQRMOD_C
+#   define AMPLIFY_BN_SRP_SHA256_C
+#   define AMPLIFY_BN_S_SRP_SHA256_UPDATE_MP_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_GROUP_POWER_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_COPY_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_EXPTMOD_C
+#   define AMPLIFY_BN_MP_INIT_SIZE_C
+#   define AMPLIFY_BN_MP_MONTGOMERY_REDUCE_C
+#   define AMPLIFY_BN_MP_MUL_C
+#   define AMPLIFY_BN_MP_SET_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_GROUP_VALIDATE_C)
+#   define AMPLIFY_BN_MP_ADD_D_C
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_CLEAR_MULTI_C
+#   define AMPLIFY_BN_MP_CMP_C
+#   define AMPLIFY_BN_MP_CMP_D_C
+#   define AMPLIFY_BN_MP_COUNT_BITS_C
+#   define AMPLIFY_BN_MP_DIV_2_C
+#   define AMPLIFY_BN_MP_EXPTMOD_C
+#   define AMPLIFY_BN_MP_INIT_C
+#   define AMPLIFY_BN_MP_INIT_MULTI_C
+#   define AMPLIFY_BN_MP_MOD_D_C
+#   define AMPLIFY_BN_MP_PRIME_MILLER_RABIN_C
+#   define AMPLIFY_BN_MP_PRIME_STRONG_LUCAS_SELFRIDGE_C
+#   define AMPLIFY_BN_MP_RAND_RANGE_C
+#   define AMPLIFY_BN_MP_SET_C
+#   define AMPLIFY_BN_MP_SUB_D_C
+#   define AMPLIFY_BN_MP_TO_UBIN_C
+#   define AMPLIFY_BN_MP_UBIN_SIZE_C
+#   define AMPLIFY_BN_SRP_SHA256_C
+#   define AMPLIFY_BN_S_MP_MONT_CTX_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_KEY_POOL_CLEAR_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_KEY_POOL_INIT_C)
+#   define AMPLIFY_BN_MP_CLEAR_C
+#   define AMPLIFY_BN_MP_INIT_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_KEY_POOL_PUT_C)
+#   define AMPLIFY_BN_MP_EXCH_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_KEY_POOL_TAKE_C)
+#   define AMPLIFY_BN_MP_EXCH_C
+#   define AMPLIFY_BN_MP_ZERO_C
+#endif
+
+#if defined(AMPLIFY_BN_SRP_SHA256_C)
+#endif
+
 #ifdef LTM_INSIDE
 #undef LTM_INSIDE
 #ifdef LTM3
@@ -12,3 +12,7 @@
 #define AMPLIFY_MP_DEFAULT_KARATSUBA_SQR_CUTOFF 120
 #define AMPLIFY_MP_DEFAULT_TOOM_MUL_CUTOFF      350
 #define AMPLIFY_MP_DEFAULT_TOOM_SQR_CUTOFF      400
+#define AMPLIFY_MP_DEFAULT_TOOM4_MUL_CUTOFF     1200
+#define AMPLIFY_MP_DEFAULT_TOOM4_SQR_CUTOFF     800
+#define AMPLIFY_MP_DEFAULT_FFT_MUL_CUTOFF       12000
+#define AMPLIFY_MP_DEFAULT_FFT_SQR_CUTOFF       12000
@@ -6,6 +6,7 @@
 #define AMPLIFY_TOMMATH_PRIV_H_
 
 #include "amplify_tommath.h"
+#include "amplify_tommath_srp.h"
 #include "amplify_tommath_class.h"
 
 /*
@@ -118,13 +119,31 @@ do {                                                    \
 #  define AMPLIFY_MP_KARATSUBA_SQR_CUTOFF AMPLIFY_MP_DEFAULT_KARATSUBA_SQR_CUTOFF
 #  define AMPLIFY_MP_TOOM_MUL_CUTOFF      AMPLIFY_MP_DEFAULT_TOOM_MUL_CUTOFF
 #  define AMPLIFY_MP_TOOM_SQR_CUTOFF      AMPLIFY_MP_DEFAULT_TOOM_SQR_CUTOFF
+#  define AMPLIFY_MP_TOOM4_MUL_CUTOFF     AMPLIFY_MP_DEFAULT_TOOM4_MUL_CUTOFF
+#  define AMPLIFY_MP_TOOM4_SQR_CUTOFF     AMPLIFY_MP_DEFAULT_TOOM4_SQR_CUTOFF
+#  define AMPLIFY_MP_FFT_MUL_CUTOFF       AMPLIFY_MP_DEFAULT_FFT_MUL_CUTOFF
+#  define AMPLIFY_MP_FFT_SQR_CUTOFF       AMPLIFY_MP_DEFAULT_FFT_SQR_CUTOFF
 #else
 #  define AMPLIFY_MP_KARATSUBA_MUL_CUTOFF AMPLIFY_KARATSUBA_MUL_CUTOFF
 #  define AMPLIFY_MP_KARATSUBA_SQR_CUTOFF AMPLIFY_KARATSUBA_SQR_CUTOFF
 #  define AMPLIFY_MP_TOOM_MUL_CUTOFF      AMPLIFY_TOOM_MUL_CUTOFF
 #  define AMPLIFY_MP_TOOM_SQR_CUTOFF      AMPLIFY_TOOM_SQR_CUTOFF
+#  define AMPLIFY_MP_TOOM4_MUL_CUTOFF     AMPLIFY_TOOM4_MUL_CUTOFF
+#  define AMPLIFY_MP_TOOM4_SQR_CUTOFF     AMPLIFY_TOOM4_SQR_CUTOFF
+#  define AMPLIFY_MP_FFT_MUL_CUTOFF       AMPLIFY_FFT_MUL_CUTOFF
+#  define AMPLIFY_MP_FFT_SQR_CUTOFF       AMPLIFY_FFT_SQR_CUTOFF
 #endif
 
+/* amplify_s_mp_fft_mul cuts digits into coefficients of AMPLIFY_MP_FFT_BITS bits,
+ * its three primes allow for up to 2^24 coefficients in the product
+ */
+#if AMPLIFY_MP_DIGIT_BIT > 32
+#  define AMPLIFY_MP_FFT_BITS (AMPLIFY_MP_DIGIT_BIT / 2)
+#else
+#  define AMPLIFY_MP_FFT_BITS AMPLIFY_MP_DIGIT_BIT
+#endif
+#define AMPLIFY_MP_FFT_MAX_DIGITS ((1L << 24) / (AMPLIFY_MP_DIGIT_BIT / AMPLIFY_MP_FFT_BITS))
+
 /* define heap macros */
 #ifndef AMPLIFY_MP_MALLOC
 /* default to libc stuff */
@@ -141,6 +160,62 @@ extern void *AMPLIFY_MP_CALLOC(size_t nmemb, size_t size);
 extern void AMPLIFY_MP_FREE(void *mem, size_t size);
 #endif
 
+/* thread local storage, define AMPLIFY_MP_NO_THREAD_LOCAL to disable */
+#if defined(AMPLIFY_MP_NO_THREAD_LOCAL)
+#elif defined(_MSC_VER)
+#  define AMPLIFY_MP_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#  define AMPLIFY_MP_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#  define AMPLIFY_MP_THREAD_LOCAL _Thread_local
+#endif
+
+/* instrumentation, see amplify_mp_stats_snapshot */
+#ifdef AMPLIFY_MP_STATS
+AMPLIFY_MP_PRIVATE uint64_t amplify_s_mp_stats_now(void);
+AMPLIFY_MP_PRIVATE void amplify_s_mp_stats_record(int op, size_t digits, uint64_t start);
+AMPLIFY_MP_PRIVATE void *amplify_s_mp_stats_malloc(size_t size);
+AMPLIFY_MP_PRIVATE void *amplify_s_mp_stats_realloc(void *mem, size_t oldsize, size_t newsize);
+AMPLIFY_MP_PRIVATE void *amplify_s_mp_stats_calloc(size_t nmemb, size_t size);
+AMPLIFY_MP_PRIVATE void amplify_s_mp_stats_free(void *mem, size_t size);
+
+/* time "call" and return its result from the enclosing function,
+ * "digits" is evaluated before the call since outputs may alias inputs */
+#  define AMPLIFY_MP_STATS_TIMED(op, digits, call)              \
+do {                                                    \
+   size_t sd_ = (size_t)(digits);                       \
+   uint64_t st_ = amplify_s_mp_stats_now();             \
+   amplify_mp_err se_ = (call);                         \
+   amplify_s_mp_stats_record((op), sd_, st_);           \
+   return se_;                                          \
+} while (0)
+
+/* time the void "call", for code that skips the counted entry points */
+#  define AMPLIFY_MP_STATS_VOID(op, digits, call)               \
+do {                                                    \
+   size_t sd_ = (size_t)(digits);                       \
+   uint64_t st_ = amplify_s_mp_stats_now();             \
+   call;                                                \
+   amplify_s_mp_stats_record((op), sd_, st_);           \
+} while (0)
+
+/* route heap traffic through the counting wrappers, which in turn
+ * call the heap macros above (AMPLIFY_BN_MP_STATS_IMPL) */
+#  ifndef AMPLIFY_BN_MP_STATS_IMPL
+#    undef AMPLIFY_MP_MALLOC
+#    undef AMPLIFY_MP_REALLOC
+#    undef AMPLIFY_MP_CALLOC
+#    undef AMPLIFY_MP_FREE
+#    define AMPLIFY_MP_MALLOC(size)                   amplify_s_mp_stats_malloc(size)
+#    define AMPLIFY_MP_REALLOC(mem, oldsize, newsize) amplify_s_mp_stats_realloc((mem), (oldsize), (newsize))
+#    define AMPLIFY_MP_CALLOC(nmemb, size)            amplify_s_mp_stats_calloc((nmemb), (size))
+#    define AMPLIFY_MP_FREE(mem, size)                amplify_s_mp_stats_free((mem), (size))
+#  endif
+#else
+#  define AMPLIFY_MP_STATS_TIMED(op, digits, call) return (call)
+#  define AMPLIFY_MP_STATS_VOID(op, digits, call) call
+#endif
+
 /* feature detection macro */
 #ifdef _MSC_VER
 /* Prevent false positive: not enough arguments for function-like macro invocation */
@@ -182,6 +257,7 @@ typedef private_mp_word amplify_mp_word;
 #define AMPLIFY_MP_MIN_PREC ((((int)AMPLIFY_MP_SIZEOF_BITS(long long) + AMPLIFY_MP_DIGIT_BIT) - 1) / AMPLIFY_MP_DIGIT_BIT)
 
 AMPLIFY_MP_STATIC_ASSERT(prec_geq_min_prec, AMPLIFY_MP_PREC >= AMPLIFY_MP_MIN_PREC)
+AMPLIFY_MP_STATIC_ASSERT(fft_bits_fit_primes, AMPLIFY_MP_FFT_BITS <= 31)
 
 /* random number source */
 extern AMPLIFY_MP_PRIVATE amplify_mp_err(*amplify_s_mp_rand_source)(void *out, size_t size);
@@ -201,16 +277,111 @@ AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_karatsuba_mul(const amplify_mp_in
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_toom_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_karatsuba_sqr(const amplify_mp_int *a, amplify_mp_int *b) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_toom_sqr(const amplify_mp_int *a, amplify_mp_int *b) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_toom32_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_toom42_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_toom4_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_toom4_sqr(const amplify_mp_int *a, amplify_mp_int *b) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_fft_mul(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_fft_sqr(const amplify_mp_int *a, amplify_mp_int *b) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_init_slice(amplify_mp_int *out, const amplify_mp_int *a, int from, int count) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_digit amplify_s_mp_add_span(amplify_mp_digit *r, const amplify_mp_digit *a, int na, const amplify_mp_digit *b, int nb);
+AMPLIFY_MP_PRIVATE amplify_mp_digit amplify_s_mp_sub_span(amplify_mp_digit *r, const amplify_mp_digit *a, int na, const amplify_mp_digit *b, int nb);
+AMPLIFY_MP_PRIVATE amplify_mp_bool amplify_s_mp_diff_span(amplify_mp_digit *r, const amplify_mp_digit *a, int na, const amplify_mp_digit *b, int nb);
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_invmod_fast(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_invmod_slow(const amplify_mp_int *a, const amplify_mp_int *b, amplify_mp_int *c) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_montgomery_reduce_fast(amplify_mp_int *x, const amplify_mp_int *n, amplify_mp_digit rho) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_exptmod_fast(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y, int redmode) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_exptmod(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y, int redmode) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_exptmod_even(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P, amplify_mp_int *Y) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_rand_platform(void *p, size_t n) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_prime_random_ex(amplify_mp_int *a, int t, int size, int flags, private_amplify_mp_prime_callback cb, void *dat);
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_prime_start(amplify_mp_int *a, unsigned char *tmp, int size, int flags, private_amplify_mp_prime_callback cb, void *dat) AMPLIFY_MP_WUR;
+typedef amplify_mp_bool private_amplify_mp_prime_cancelled(void *dat);
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_prime_is_candidate(const amplify_mp_int *p, int t, amplify_mp_bool safe,
+      private_amplify_mp_prime_cancelled cancelled, void *dat, amplify_mp_bool *result) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE void amplify_s_mp_reverse(unsigned char *s, size_t len);
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_from_bin(amplify_mp_int *a, const unsigned char *buf, size_t count, amplify_mp_order order,
+      size_t size, amplify_mp_endian endian, size_t nails) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE void amplify_s_mp_to_bin(const amplify_mp_int *a, unsigned char *buf, size_t count, amplify_mp_order order,
+      size_t size, amplify_mp_endian endian, size_t nails);
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_prime_is_divisible(const amplify_mp_int *a, amplify_mp_bool *result);
 
+/* Montgomery arithmetic modulo one odd n > 1, see amplify_bn_s_mp_mont_ctx.c */
+typedef struct {
+   const amplify_mp_int *n;
+   amplify_mp_digit rho;
+   amplify_mp_int one;          /* R mod n, 1 in the Montgomery domain */
+   amplify_mp_int minus_one;    /* n - (R mod n), -1 in the Montgomery domain */
+   amplify_mp_int rr;           /* R^2 mod n */
+} amplify_s_mp_mont_ctx;
+
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_mont_init(amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *n) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE void amplify_s_mp_mont_clear(amplify_s_mp_mont_ctx *ctx);
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_mont_mul(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, const amplify_mp_int *b,
+      amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_mont_sqr(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_mont_to(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_mont_from(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *c) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_mont_exptmod(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *G, const amplify_mp_int *X,
+      amplify_mp_int *Y) AMPLIFY_MP_WUR;
+
+/* one factor of an amplify_mp_crt_ctx, mont refers to p so the array must not move */
+struct amplify_s_mp_crt_factor {
+   amplify_mp_int p, pm1;       /* the factor and the order of its group */
+   amplify_mp_int m;            /* the product of the factors before it */
+   amplify_mp_int c;            /* m**-1 (mod p) */
+   amplify_s_mp_mont_ctx mont;
+};
+
+/* probable prime tests on ctx->n sharing one Montgomery context */
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_prime_miller_rabin(const amplify_s_mp_mont_ctx *ctx, const amplify_mp_int *b,
+      amplify_mp_bool *result) AMPLIFY_MP_WUR;
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_prime_strong_lucas_selfridge(const amplify_s_mp_mont_ctx *ctx, amplify_mp_bool *result) AMPLIFY_MP_WUR;
+
+/* candidates per amplify_s_mp_prime_sieve window, window * 4 must fit a digit */
+#ifdef AMPLIFY_MP_8BIT
+#   define AMPLIFY_MP_PRIME_SIEVE_WINDOW 16
+#else
+#   define AMPLIFY_MP_PRIME_SIEVE_WINDOW 4096
+#endif
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_prime_sieve(const amplify_mp_int *a, amplify_mp_digit *res, amplify_mp_digit step,
+      amplify_mp_bool safe, unsigned char *composite) AMPLIFY_MP_WUR;
+
+/* instruction set extensions for the optimized kernels, see amplify_bn_s_mp_cpu_features.c */
+#define AMPLIFY_MP_CPU_X86_BMI2 0x1u
+#define AMPLIFY_MP_CPU_X86_ADX  0x2u
+AMPLIFY_MP_PRIVATE unsigned int amplify_s_mp_cpu_features(void);
+
+/* Montgomery exponentiation on full 64-bit limbs instead of 60-bit digits,
+ * see amplify_bn_s_mp_exptmod_limb64.c. It is only used when the CPU has an
+ * accelerated row kernel. Define AMPLIFY_MP_NO_LIMB64 or AMPLIFY_MP_NO_ASM to
+ * stay on the digit code.
+ */
+#if defined(AMPLIFY_MP_64BIT) && !defined(AMPLIFY_MP_NO_LIMB64)
+#   define AMPLIFY_MP_LIMB64 1
+#else
+#   define AMPLIFY_MP_LIMB64 0
+#endif
+#if AMPLIFY_MP_LIMB64 && defined(__x86_64__) && defined(__GNUC__) && !defined(AMPLIFY_MP_NO_ASM)
+#   define AMPLIFY_MP_X86_64_ADX 1
+#else
+#   define AMPLIFY_MP_X86_64_ADX 0
+#endif
+typedef uint64_t (*amplify_s_mp_addmul_row64_fn)(uint64_t *t, const uint64_t *a, int len, uint64_t b);
+AMPLIFY_MP_PRIVATE uint64_t amplify_s_mp_addmul_row64(uint64_t *t, const uint64_t *a, int len, uint64_t b);
+AMPLIFY_MP_PRIVATE uint64_t amplify_s_mp_addmul_row64_adx(uint64_t *t, const uint64_t *a, int len, uint64_t b);
+AMPLIFY_MP_PRIVATE amplify_s_mp_addmul_row64_fn amplify_s_mp_addmul_row64_kernel(void);
+AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_exptmod_limb64(const amplify_mp_int *G, const amplify_mp_int *X, const amplify_mp_int *P,
+      amplify_mp_int *Y) AMPLIFY_MP_WUR;
+
+/* SHA-256 over the big endian bytes of |a|, AMPLIFY_S_SRP_SIGNED prepends a zero
+ * byte if the top bit is set and AMPLIFY_S_SRP_SBIN always does
+ */
+#define AMPLIFY_S_SRP_UNSIGNED 0
+#define AMPLIFY_S_SRP_SIGNED   1
+#define AMPLIFY_S_SRP_SBIN     2
+AMPLIFY_MP_PRIVATE void amplify_s_srp_sha256_update_mp(amplify_srp_sha256_ctx *md, const amplify_mp_int *a, int encoding);
+
 /* TODO: jenkins prng is not thread safe as of now */
 AMPLIFY_MP_PRIVATE amplify_mp_err amplify_s_mp_rand_jenkins(void *p, size_t n) AMPLIFY_MP_WUR;
 AMPLIFY_MP_PRIVATE void amplify_s_mp_rand_jenkins_init(uint64_t seed);
@@ -0,0 +1,146 @@
+/* LibTomMath, multiple-precision integer library -- Tom St Denis */
+/* SPDX-License-Identifier: Unlicense */
+/* Modifications Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved. */
+
+#ifndef AMPLIFY_TOMMATH_SRP_H_
+#define AMPLIFY_TOMMATH_SRP_H_
+
+#include "amplify_tommath.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* SRP support
+ * -----------
+ *
+ * Helpers for the SRP-6a client, see RFC 5054.
+ */
+
+/* SHA-256 (FIPS 180-4) */
+#define AMPLIFY_SRP_SHA256_SIZE 32
+
+typedef struct {
+   uint32_t state[8];
+   uint64_t length;             /* bytes hashed so far */
+   unsigned char buf[64];
+   size_t buflen;
+} amplify_srp_sha256_ctx;
+
+void amplify_srp_sha256_init(amplify_srp_sha256_ctx *ctx);
+void amplify_srp_sha256_update(amplify_srp_sha256_ctx *ctx, const void *data, size_t size);
+void amplify_srp_sha256_final(amplify_srp_sha256_ctx *ctx, unsigned char out[AMPLIFY_SRP_SHA256_SIZE]);
+
+/* smallest group accepted by amplify_srp_group_validate */
+#ifndef AMPLIFY_SRP_GROUP_MIN_BITS
+#  define AMPLIFY_SRP_GROUP_MIN_BITS 1024
+#endif
+
+/* Checks that N is a safe prime of at least AMPLIFY_SRP_GROUP_MIN_BITS bits
+ * and that 1 < g < N-1, so g generates a subgroup of order (N-1)/2 or N-1.
+ *
+ * The groups of RFC 5054 appendix A are recognised by digest; other
+ * moduli get a safe prime test whose verdict is memoized per process.
+ */
+amplify_mp_err amplify_srp_group_validate(const amplify_mp_int *N, const amplify_mp_int *g, amplify_mp_bool *result) AMPLIFY_MP_WUR;
+
+/* Group constants
+ *
+ * What depends on N and g alone is computed once by amplify_srp_group_init:
+ * k, the Montgomery constants of N and the table g^(2^(w * i)) * R mod N
+ * for w = AMPLIFY_SRP_GROUP_WINDOW and exponents of up to
+ * AMPLIFY_SRP_GROUP_EXPONENT_BITS bits. amplify_srp_group_power then takes
+ * about bits / w + 2^w Montgomery products and no squaring. The group is
+ * only read after init, so any number of threads may share it.
+ */
+#ifndef AMPLIFY_SRP_GROUP_WINDOW
+#  define AMPLIFY_SRP_GROUP_WINDOW 4
+#endif
+#ifndef AMPLIFY_SRP_GROUP_EXPONENT_BITS
+#  define AMPLIFY_SRP_GROUP_EXPONENT_BITS 256
+#endif
+
+typedef struct {
+   amplify_mp_int N, g, k;
+   amplify_mp_digit rho;        /* Montgomery constant of N */
+   amplify_mp_int *powers;      /* npowers entries of the table */
+   int npowers;
+} amplify_srp_group;
+
+/* AMPLIFY_MP_VAL unless N is odd and greater than 1 */
+amplify_mp_err amplify_srp_group_init(amplify_srp_group *group, const amplify_mp_int *N, const amplify_mp_int *g) AMPLIFY_MP_WUR;
+void amplify_srp_group_clear(amplify_srp_group *group);
+
+/* A = g^e mod N, exponents that are negative or too long for the table go to amplify_mp_exptmod */
+amplify_mp_err amplify_srp_group_power(const amplify_srp_group *group, const amplify_mp_int *e, amplify_mp_int *A) AMPLIFY_MP_WUR;
+
+/* SRP-6a client math, hashed with SHA-256 the way Cognito does
+ *
+ *   k = H(0x00 | N | g)
+ *   u = H(A | B)
+ *   x = H(salt | H(identity))
+ *   S = (B - k * g^x)^(a + u * x) mod N
+ *
+ * Every number is hashed in big endian two's complement (Java's
+ * BigInteger.toByteArray), i.e. with a leading zero byte whenever its top
+ * bit is set; identity is "username:password". The context owns the group
+ * and all intermediates, use it from one thread at a time.
+ */
+typedef struct {
+   amplify_mp_int N, g, k;
+   amplify_mp_int u, x;         /* of amplify_srp_compute_premaster_secret, x is wiped */
+   amplify_mp_int base, exp, t; /* scratch of amplify_srp_compute_S */
+   const amplify_srp_group *group; /* powers of g, if any */
+} amplify_srp_client_ctx;
+
+/* copies the group and computes k */
+amplify_mp_err amplify_srp_client_init(amplify_srp_client_ctx *ctx, const amplify_mp_int *N, const amplify_mp_int *g) AMPLIFY_MP_WUR;
+/* copies N, g and k of group, which must outlive the context, and takes powers of g from its table */
+amplify_mp_err amplify_srp_client_init_group(amplify_srp_client_ctx *ctx, const amplify_srp_group *group) AMPLIFY_MP_WUR;
+void amplify_srp_client_clear(amplify_srp_client_ctx *ctx);
+
+/* A = g^a mod N, also the verifier g^x mod N */
+amplify_mp_err amplify_srp_compute_A(amplify_srp_client_ctx *ctx, const amplify_mp_int *a, amplify_mp_int *A) AMPLIFY_MP_WUR;
+
+/* u = H(A | B) */
+amplify_mp_err amplify_srp_compute_u(const amplify_mp_int *A, const amplify_mp_int *B, amplify_mp_int *u) AMPLIFY_MP_WUR;
+
+/* x = H(salt | H(identity)) */
+amplify_mp_err amplify_srp_compute_x(const amplify_mp_int *salt, const unsigned char *identity, size_t size,
+                                     amplify_mp_int *x) AMPLIFY_MP_WUR;
+
+/* S = (B - k * g^x)^(a + u * x) mod N, AMPLIFY_MP_VAL if B = 0 (mod N) */
+amplify_mp_err amplify_srp_compute_S(amplify_srp_client_ctx *ctx, const amplify_mp_int *a, const amplify_mp_int *B,
+                                     const amplify_mp_int *u, const amplify_mp_int *x, amplify_mp_int *S) AMPLIFY_MP_WUR;
+
+/* x, u and S in one call, u is left in the context */
+amplify_mp_err amplify_srp_compute_premaster_secret(amplify_srp_client_ctx *ctx, const unsigned char *identity, size_t size,
+      const amplify_mp_int *salt, const amplify_mp_int *a, const amplify_mp_int *A, const amplify_mp_int *B,
+      amplify_mp_int *S) AMPLIFY_MP_WUR;
+
+/* Ring of precomputed ephemeral key pairs (a, A = g^a mod N)
+ *
+ * Pairs move in and out by amplify_mp_exch, so no digits are copied and a
+ * taken pair leaves no copy behind; the slot keeps the wiped values the
+ * caller handed in. The ring does no locking, callers serialize access.
+ */
+typedef struct {
+   amplify_mp_int *a, *A;       /* size slots each */
+   int size, head, used;
+} amplify_srp_key_pool;
+
+amplify_mp_err amplify_srp_key_pool_init(amplify_srp_key_pool *pool, int size) AMPLIFY_MP_WUR;
+/* wipes the pairs still in the ring */
+void amplify_srp_key_pool_clear(amplify_srp_key_pool *pool);
+
+/* moves a and A into the ring, AMPLIFY_MP_BUF if it is full */
+amplify_mp_err amplify_srp_key_pool_put(amplify_srp_key_pool *pool, amplify_mp_int *a, amplify_mp_int *A) AMPLIFY_MP_WUR;
+
+/* moves the oldest pair into a and A, AMPLIFY_MP_NO if the ring is empty */
+amplify_mp_bool amplify_srp_key_pool_take(amplify_srp_key_pool *pool, amplify_mp_int *a, amplify_mp_int *A);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,11 +1,14 @@
+#ifdef __OBJC__
 #import <Foundation/Foundation.h>
  
 FOUNDATION_EXPORT double LibTomMathAmplifyVersionNumber;
 FOUNDATION_EXPORT const unsigned char LibTomMathAmplifyVersionString[];
+#endif
  
-#import "../amplify_tommath.h"
-#import "../amplify_tommath_class.h"
-#import "../amplify_tommath_superclass.h"
+#include "../amplify_tommath.h"
+#include "../amplify_tommath_srp.h"
+#include "../amplify_tommath_class.h"
+#include "../amplify_tommath_superclass.h"
  
-#import "../amplify_tommath_cutoffs.h"
-#import "../amplify_tommath_private.h"
+#include "../amplify_tommath_cutoffs.h"
+#include "../amplify_tommath_private.h"
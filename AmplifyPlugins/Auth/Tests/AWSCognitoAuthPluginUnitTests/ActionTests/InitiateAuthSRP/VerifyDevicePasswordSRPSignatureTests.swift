@@ -167,6 +167,25 @@ private class MockSRPClientBehavior: SRPClientBehavior {
         return try sharedSecret.get()
     }
 
+    // swiftlint:disable:next function_parameter_count
+    func calculateSharedSecretValue(
+        username: String,
+        password: String,
+        saltHexValue: String,
+        clientPrivateKeyHexValue: String,
+        clientPublicKeyHexValue: String,
+        serverPublicKeyHexValue: String
+    ) throws -> SRPSharedSecret {
+        return .init(
+            premasterSecret: [UInt8](try sharedSecret.get().utf8),
+            scramblingParameter: [UInt8]("UHexValue".utf8)
+        )
+    }
+
+    static func generateAuthenticationKey(sharedSecret: SRPSharedSecret) throws -> Data {
+        return try authenticationKey.get()
+    }
+
     func generateDevicePasswordVerifier(
         deviceGroupKey: String,
         deviceKey: String,
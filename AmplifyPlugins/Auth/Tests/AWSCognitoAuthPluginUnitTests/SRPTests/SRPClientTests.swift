@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+import AmplifySRP
 import Foundation
 import XCTest
 
@@ -28,6 +29,72 @@ class SRPClientTests: XCTestCase {
         XCTAssertNotNil(keyPair.publicKeyHexValue)
     }
 
+    func testGenerateKeysWithBufferedRandomSource() throws {
+        let randomSource = BufferedSRPRandomSource()
+        let firstClient = try AmplifySRPClient(NHexValue: validNHexValue, gHexValue: "2", randomSource: randomSource)
+        let secondClient = try AmplifySRPClient(NHexValue: validNHexValue, gHexValue: "2", randomSource: randomSource)
+
+        let firstKeyPair = firstClient.generateClientKeyPair()
+        let secondKeyPair = secondClient.generateClientKeyPair()
+        XCTAssertNotEqual(firstKeyPair.privateKeyHexValue, secondKeyPair.privateKeyHexValue)
+        XCTAssertNotEqual(firstKeyPair.publicKeyHexValue, secondKeyPair.publicKeyHexValue)
+
+        let verifier = firstClient.generateDevicePasswordVerifier(
+            deviceGroupKey: "group",
+            deviceKey: "device",
+            password: "password"
+        )
+        XCTAssertFalse(verifier.salt.isEmpty)
+        XCTAssertFalse(verifier.passwordVerifier.isEmpty)
+    }
+
+    func testGenerateKeysFromKeyPool() throws {
+        let commonState = SRPCommonState(prime: BigInt(validNHexValue, radix: 16)!, generator: BigInt(2))
+        let keyPool = SRPEphemeralKeyPool(commonState: commonState, depth: 2)
+
+        let deadline = Date().addingTimeInterval(10)
+        while keyPool.count < keyPool.depth, Date() < deadline {
+            Thread.sleep(forTimeInterval: 0.01)
+        }
+        XCTAssertEqual(keyPool.count, 2)
+
+        let first = SRPClientState(commonState: commonState, keyPool: keyPool)
+        let second = SRPClientState(commonState: commonState, keyPool: keyPool)
+        XCTAssertNotEqual(first.privateA, second.privateA)
+        for state in [first, second] {
+            XCTAssertEqual(state.publicA, commonState.generator.pow(state.privateA, modulus: commonState.prime))
+        }
+    }
+
+    func testSharedKeyPoolHangsOnTheSharedState() throws {
+        let first = try XCTUnwrap(SRPCommonState.shared(primeHexValue: validNHexValue, generatorHexValue: "2"))
+        let second = try XCTUnwrap(SRPCommonState.shared(primeHexValue: validNHexValue, generatorHexValue: "2"))
+        XCTAssertTrue(SRPEphemeralKeyPool.shared(for: first) === SRPEphemeralKeyPool.shared(for: second))
+        XCTAssertTrue(SRPEphemeralKeyPool.shared(for: first).matches(second))
+    }
+
+    // MARK: - Test group validation
+
+    func testCompositePrimeIsRejected() throws {
+        let compositeNHexValue = String(validNHexValue.dropLast()) + "D"
+        XCTAssertThrowsError(try srpClient(NHexValue: compositeNHexValue, gHexValue: "2")) { error in
+            XCTAssertEqual(error as? SRPError, SRPError.illegalParameter)
+        }
+    }
+
+    func testDegenerateGeneratorIsRejected() throws {
+        XCTAssertThrowsError(try srpClient(NHexValue: validNHexValue, gHexValue: "1")) { error in
+            XCTAssertEqual(error as? SRPError, SRPError.illegalParameter)
+        }
+    }
+
+    func testShortPrimeIsRejected() throws {
+        // 2^127 - 1 is prime but far too small for SRP
+        XCTAssertThrowsError(try srpClient(NHexValue: "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", gHexValue: "2")) { error in
+            XCTAssertEqual(error as? SRPError, SRPError.illegalParameter)
+        }
+    }
+
     // MARK: - Test K value
 
     func testGeneratedK() throws {
@@ -36,6 +103,17 @@ class SRPClientTests: XCTestCase {
         XCTAssertEqual(srpClient.kHexValue, expectedK.uppercased())
     }
 
+    func testSharedCommonStateIsComputedOnce() throws {
+        let first = try XCTUnwrap(SRPCommonState.shared(primeHexValue: validNHexValue, generatorHexValue: "2"))
+        let second = try XCTUnwrap(SRPCommonState.shared(primeHexValue: validNHexValue, generatorHexValue: "2"))
+        XCTAssertTrue(try XCTUnwrap(first.group) === second.group)
+        XCTAssertEqual(first.k.asString(radix: 16), "538282c4354742d7cbbde2359fcf67f9f5b3a6b08791e5011b43b8a5b66d9ee6".uppercased())
+        XCTAssertNil(SRPCommonState.shared(primeHexValue: "not hex", generatorHexValue: "2"))
+
+        let exponent = BigInt("123456789abcdef123456789abcdef123456789abcdef123456789abcdef", radix: 16)!
+        XCTAssertEqual(first.power(exponent), first.generator.pow(exponent, modulus: first.prime))
+    }
+
     // MARK: - Test U value
     func testCalculateU_1() throws {
         let clientPublicKey =
@@ -342,6 +420,41 @@ class SRPClientTests: XCTestCase {
             XCTAssertEqual(srpError, SRPError.illegalParameter)
         }
     }
+
+    func testAuthenticationKeyFromBinaryPathMatchesHexPath() throws {
+        let srpClient = try srpClient(NHexValue: validNHexValue, gHexValue: "2")
+        let keyPair = srpClient.generateClientKeyPair()
+        let prime = BigInt(validNHexValue, radix: 16)!
+        let serverPublicKey = BigInt(2).pow(BigInt(0x1234_5678_9ABC_DEF), modulus: prime).asString(radix: 16)
+
+        let sharedSecretHexValue = try srpClient.calculateSharedSecret(
+            username: "VEUHc88gProyji7",
+            password: "dummy123@",
+            saltHexValue: "8bb7dcf905f418bf27b6623aa4d2f58f",
+            clientPrivateKeyHexValue: keyPair.privateKeyHexValue,
+            clientPublicKeyHexValue: keyPair.publicKeyHexValue,
+            serverPublicKeyHexValue: serverPublicKey
+        )
+        let u = try srpClientType().calculateUHexValue(
+            clientPublicKeyHexValue: keyPair.publicKeyHexValue,
+            serverPublicKeyHexValue: serverPublicKey
+        )
+        let expectedKey = try srpClientType().generateAuthenticationKey(
+            sharedSecretHexValue: sharedSecretHexValue,
+            uHexValue: u
+        )
+
+        let sharedSecret = try srpClient.calculateSharedSecretValue(
+            username: "VEUHc88gProyji7",
+            password: "dummy123@",
+            saltHexValue: "8bb7dcf905f418bf27b6623aa4d2f58f",
+            clientPrivateKeyHexValue: keyPair.privateKeyHexValue,
+            clientPublicKeyHexValue: keyPair.publicKeyHexValue,
+            serverPublicKeyHexValue: serverPublicKey
+        )
+        let key = try srpClientType().generateAuthenticationKey(sharedSecret: sharedSecret)
+        XCTAssertEqual(key, expectedKey)
+    }
 }
 
 extension SRPClientTests {
@@ -0,0 +1,68 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntAsyncPowTests: XCTestCase {
+
+    // RFC 5054 3072-bit group
+    let prime = AmplifyBigInt(
+        "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B2" +
+        "2514A08798E3404DDEF9519B3CD3A431B302B0A6DF25F14374FE1356D6D51C245E485B576625E7E" +
+        "C6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE649286651ECE45" +
+        "B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F3562085" +
+        "52BB9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180" +
+        "E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF6955817183995497CEA956AE515D2261898" +
+        "FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575" +
+        "D060C7DB3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06" +
+        "D98A0864D87602733EC86A64521F2B18177B200CBBE117577A615D6C770988C0BAD946E208E24FA" +
+        "074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF",
+        radix: 16
+    )!
+
+    func testMatchesSynchronousPow() async throws {
+        let exponent = AmplifyBigInt(unsignedData: [UInt8](repeating: 0xA5, count: 32))
+        let expected = AmplifyBigInt(2).pow(exponent, modulus: prime)
+        let power = try await AmplifyBigInt(2).powCooperatively(exponent, modulus: prime)
+        XCTAssertEqual(power, expected)
+    }
+
+    func testEvenModulusAndNegativeExponent() async throws {
+        let power = try await AmplifyBigInt(3).powCooperatively(AmplifyBigInt(65_537), modulus: AmplifyBigInt(1 << 40))
+        XCTAssertEqual(power, AmplifyBigInt(3).pow(AmplifyBigInt(65_537), modulus: AmplifyBigInt(1 << 40)))
+
+        let inverse = try await AmplifyBigInt(3).powCooperatively(AmplifyBigInt(-1), modulus: AmplifyBigInt(1_000_003))
+        XCTAssertEqual((inverse * AmplifyBigInt(3)) % AmplifyBigInt(1_000_003), AmplifyBigInt(1))
+
+        // the inverse of a negative base is taken of its reduction
+        let negativeInverse = try await AmplifyBigInt(-3).powCooperatively(AmplifyBigInt(-1), modulus: prime)
+        XCTAssertEqual((negativeInverse * (prime - 3)) % prime, AmplifyBigInt(1))
+    }
+
+    func testZeroExponent() async throws {
+        let power = try await AmplifyBigInt(5).powCooperatively(AmplifyBigInt(0), modulus: prime)
+        XCTAssertEqual(power, AmplifyBigInt(1))
+    }
+
+    func testCancellationStopsThePow() async {
+        let base = AmplifyBigInt(2)
+        let exponent = prime - 1
+        let modulus = prime
+        let task = Task {
+            try await base.powCooperatively(exponent, modulus: modulus)
+        }
+        task.cancel()
+
+        do {
+            _ = try await task.value
+            XCTFail("powCooperatively(_:modulus:) should have thrown")
+        } catch {
+            XCTAssertTrue(error is CancellationError)
+        }
+    }
+}
@@ -0,0 +1,128 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntBinaryIntegerTests: XCTestCase {
+
+    func testWordsMatchFixedWidthIntegers() {
+        let values: [Int] = [0, 1, -1, 42, -42, Int.max, Int.min, 1 << 40, -(1 << 40)]
+        for value in values {
+            let words = Array(AmplifyBigInt(value).words)
+            XCTAssertEqual(words.first, UInt(bitPattern: value), "\(value)")
+            XCTAssertTrue(words.dropFirst().allSatisfy { $0 == (value < 0 ? UInt.max : 0) }, "\(value)")
+        }
+    }
+
+    func testWordsOfLargeNegativeNumber() {
+        // -2^130 in two's complement: two zero words, then all ones from bit 130
+        let num = -(AmplifyBigInt(1) << 130)
+        let words = Array(num.words)
+        XCTAssertEqual(words.count, (131 + UInt.bitWidth - 1) / UInt.bitWidth)
+        XCTAssertEqual(AmplifyBigInt(truncatingIfNeeded: Int64(truncatingIfNeeded: num)), AmplifyBigInt(0))
+        XCTAssertEqual(AmplifyBigInt(words: words), num)
+    }
+
+    func testGenericInitRoundTrip() {
+        XCTAssertEqual(AmplifyBigInt(UInt64.max).asString(radix: 16), "FFFFFFFFFFFFFFFF")
+        XCTAssertEqual(AmplifyBigInt(Int8(-128)), AmplifyBigInt(-128))
+        XCTAssertEqual(UInt64(AmplifyBigInt(UInt64.max)), UInt64.max)
+        XCTAssertEqual(Int(AmplifyBigInt(Int.min)), Int.min)
+        XCTAssertNil(Int64(exactly: AmplifyBigInt(UInt64.max)))
+
+        let big = AmplifyBigInt("-123456789012345678901234567890")!
+        XCTAssertEqual(AmplifyBigInt(big), big)
+        XCTAssertFalse(AmplifyBigInt(big) === big)
+    }
+
+    func testFloatingPointInit() {
+        XCTAssertEqual(AmplifyBigInt(-2.75), AmplifyBigInt(-2))
+        XCTAssertEqual(AmplifyBigInt(0.5), AmplifyBigInt(0))
+        XCTAssertEqual(AmplifyBigInt(Double(1 << 62) * 16), AmplifyBigInt(1) << 66)
+        XCTAssertNil(AmplifyBigInt(exactly: 1.5))
+        XCTAssertNil(AmplifyBigInt(exactly: Double.nan))
+        XCTAssertEqual(AmplifyBigInt(exactly: Float(-1024)), AmplifyBigInt(-1024))
+    }
+
+    func testDivision() {
+        let dividend = AmplifyBigInt("-100000000000000000000000000007")!
+        let divisor = AmplifyBigInt(10)
+        let (quotient, remainder) = dividend.quotientAndRemainder(dividingBy: divisor)
+        XCTAssertEqual(quotient, AmplifyBigInt("-10000000000000000000000000000")!)
+        XCTAssertEqual(remainder, AmplifyBigInt(-7))
+        XCTAssertEqual(dividend / divisor, quotient)
+        XCTAssertEqual(dividend % divisor, remainder)
+
+        var number = AmplifyBigInt(-7)
+        number /= AmplifyBigInt(2)
+        XCTAssertEqual(number, AmplifyBigInt(-3))
+    }
+
+    func testBitwiseOperationsMatchInt() {
+        let values: [Int] = [0, 5, -5, 0x0F0F, -0x0F0F, 1 << 50, -(1 << 50) + 3]
+        for lhs in values {
+            for rhs in values {
+                let bigLHS = AmplifyBigInt(lhs)
+                let bigRHS = AmplifyBigInt(rhs)
+                XCTAssertEqual(bigLHS & bigRHS, AmplifyBigInt(lhs & rhs), "\(lhs) & \(rhs)")
+                XCTAssertEqual(bigLHS | bigRHS, AmplifyBigInt(lhs | rhs), "\(lhs) | \(rhs)")
+                XCTAssertEqual(bigLHS ^ bigRHS, AmplifyBigInt(lhs ^ rhs), "\(lhs) ^ \(rhs)")
+            }
+            XCTAssertEqual(~AmplifyBigInt(lhs), AmplifyBigInt(~lhs))
+        }
+    }
+
+    func testShifts() {
+        XCTAssertEqual(AmplifyBigInt(3) << 100 >> 99, AmplifyBigInt(6))
+        XCTAssertEqual(AmplifyBigInt(-7) >> 1, AmplifyBigInt(-4))
+        XCTAssertEqual(AmplifyBigInt(-7) >> 10, AmplifyBigInt(-1))
+        XCTAssertEqual(AmplifyBigInt(12) << -2, AmplifyBigInt(3))
+        XCTAssertEqual(AmplifyBigInt(3) >> Int8(-4), AmplifyBigInt(48))
+
+        var number = AmplifyBigInt(1)
+        number <<= 64
+        XCTAssertEqual(number.trailingZeroBitCount, 64)
+        XCTAssertEqual(number.bitWidth, 66)
+    }
+
+    func testHashable() {
+        let first = AmplifyBigInt("987654321987654321987654321")!
+        let second = AmplifyBigInt(first.asString(radix: 16), radix: 16)!
+        XCTAssertEqual(Set([first, second, -first]).count, 2)
+    }
+
+    func testGenericAlgorithm() {
+        XCTAssertEqual(greatestCommonDivisor(AmplifyBigInt(1) << 80, AmplifyBigInt(3) << 70), AmplifyBigInt(1) << 70)
+        XCTAssertEqual(String(AmplifyBigInt(-255), radix: 16), "-ff")
+        XCTAssertEqual(AmplifyBigInt(-9).signum(), AmplifyBigInt(-1))
+        XCTAssertEqual(AmplifyBigInt(-9).magnitude, AmplifyBigInt(9))
+    }
+
+    private func greatestCommonDivisor<T: BinaryInteger>(_ lhs: T, _ rhs: T) -> T {
+        var (lhs, rhs) = (lhs, rhs)
+        while rhs != 0 {
+            (lhs, rhs) = (rhs, lhs % rhs)
+        }
+        return lhs
+    }
+}
+
+private extension AmplifyBigInt {
+
+    /// Rebuilds a number from two's complement words through the public operators only
+    convenience init(words: [UInt]) {
+        var result = AmplifyBigInt(0)
+        for word in words.reversed() {
+            result = result << UInt.bitWidth | AmplifyBigInt(word)
+        }
+        if words.last.map({ $0 >> (UInt.bitWidth - 1) == 1 }) ?? false {
+            result = result - (AmplifyBigInt(1) << (words.count * UInt.bitWidth))
+        }
+        self.init(result)
+    }
+}
@@ -0,0 +1,53 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntBytesTests: XCTestCase {
+
+    func testUnsignedBytesRoundTrip() {
+        let bytes: [UInt8] = (0 ..< 384).map { UInt8(truncatingIfNeeded: $0 &* 37 &+ 11) }
+        let num = AmplifyBigInt(unsignedData: bytes)
+        XCTAssertEqual(num.unsignedByteArray, bytes)
+    }
+
+    func testUnsignedBytesMatchHex() {
+        let bytes: [UInt8] = [0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFE, 0xDC, 0xBA]
+        let num = AmplifyBigInt(unsignedData: bytes)
+        XCTAssertEqual(num.asString(radix: 16), "123456789ABCDEFFEDCBA")
+    }
+
+    func testHexRoundTrip() {
+        let hexValues = ["0", "1", "-F", "ABC", "-123456789ABCDEF0123456789ABCDEF", String(repeating: "F", count: 768)]
+        for hexValue in hexValues {
+            XCTAssertEqual(AmplifyBigInt(hexValue, radix: 16)?.asString(radix: 16), hexValue)
+            XCTAssertEqual(AmplifyBigInt(hexValue.lowercased(), radix: 16)?.asString(radix: 16), hexValue)
+        }
+        XCTAssertEqual(AmplifyBigInt("000FF", radix: 16)?.asString(radix: 16), "FF")
+        XCTAssertNil(AmplifyBigInt("12G4", radix: 16))
+    }
+
+    func testUnsignedBytesDropLeadingZeros() {
+        let num = AmplifyBigInt(unsignedData: [0x00, 0x00, 0x80, 0x01])
+        XCTAssertEqual(num.unsignedByteArray, [0x80, 0x01])
+    }
+
+    func testUnsignedBytesZero() {
+        let num = AmplifyBigInt(unsignedData: [0x00, 0x00])
+        XCTAssertEqual(num.asString, "0")
+        XCTAssertEqual(num.unsignedByteArray, [])
+    }
+
+    func testSignedBytesRoundTrip() {
+        guard let num = AmplifyBigInt("-80FF00FF00FF00FF00FF", radix: 16) else {
+            XCTFail("Could not create integer")
+            return
+        }
+        XCTAssertEqual(AmplifyBigInt(num.byteArray), num)
+    }
+}
@@ -0,0 +1,132 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import libtommathAmplify
+import XCTest
+
+/// The fast multiplication tiers, forced down to small operands with low
+/// cutoffs, against the schoolbook product
+final class AmplifyBigIntCutoffTests: XCTestCase {
+
+    private var savedCutoffs: [Int32] = []
+
+    override func setUp() {
+        super.setUp()
+        savedCutoffs = [
+            AMPLIFY_KARATSUBA_MUL_CUTOFF, AMPLIFY_KARATSUBA_SQR_CUTOFF,
+            AMPLIFY_TOOM_MUL_CUTOFF, AMPLIFY_TOOM_SQR_CUTOFF,
+            AMPLIFY_TOOM4_MUL_CUTOFF, AMPLIFY_TOOM4_SQR_CUTOFF,
+            AMPLIFY_FFT_MUL_CUTOFF, AMPLIFY_FFT_SQR_CUTOFF
+        ]
+    }
+
+    override func tearDown() {
+        AMPLIFY_KARATSUBA_MUL_CUTOFF = savedCutoffs[0]
+        AMPLIFY_KARATSUBA_SQR_CUTOFF = savedCutoffs[1]
+        AMPLIFY_TOOM_MUL_CUTOFF = savedCutoffs[2]
+        AMPLIFY_TOOM_SQR_CUTOFF = savedCutoffs[3]
+        AMPLIFY_TOOM4_MUL_CUTOFF = savedCutoffs[4]
+        AMPLIFY_TOOM4_SQR_CUTOFF = savedCutoffs[5]
+        AMPLIFY_FFT_MUL_CUTOFF = savedCutoffs[6]
+        AMPLIFY_FFT_SQR_CUTOFF = savedCutoffs[7]
+        super.tearDown()
+    }
+
+    func testKaratsubaSpansMatchSchoolbook() {
+        // the span recursion down to its two digit leaves, odd lengths split unevenly
+        for cutoff: Int32 in [2, 3, 4] {
+            setCutoffs(karatsuba: cutoff)
+            checkAgainstSchoolbook(maxDigits: 80, unbalanced: false)
+        }
+    }
+
+    func testUnbalancedToomMatchesSchoolbook() {
+        // Toom-2.5 and Toom-3.5 take 1:1.5 to 1:3 once the short side reaches the Karatsuba cutoff
+        setCutoffs(karatsuba: 4)
+        checkAgainstSchoolbook(maxDigits: 80, unbalanced: true)
+        setCutoffs(karatsuba: 4, toom: 12)
+        checkAgainstSchoolbook(maxDigits: 120, unbalanced: true)
+    }
+
+    func testToom4MatchesSchoolbook() {
+        setCutoffs(karatsuba: 4, toom: 12, toom4: 16)
+        checkAgainstSchoolbook(maxDigits: 160, unbalanced: false)
+        checkAgainstSchoolbook(maxDigits: 120, unbalanced: true)
+    }
+
+    func testNTTMatchesSchoolbook() {
+        setCutoffs(karatsuba: 4, toom: 12, toom4: 16, fft: 24)
+        checkAgainstSchoolbook(maxDigits: 160, unbalanced: false)
+        checkAgainstSchoolbook(maxDigits: 120, unbalanced: true)
+
+        // the transform all the way down
+        setCutoffs(fft: 1)
+        checkAgainstSchoolbook(maxDigits: 60, unbalanced: true)
+    }
+
+    // MARK: - Helpers
+
+    /// Int32.max keeps a tier out
+    private func setCutoffs(karatsuba: Int32 = .max, toom: Int32 = .max, toom4: Int32 = .max, fft: Int32 = .max) {
+        AMPLIFY_KARATSUBA_MUL_CUTOFF = karatsuba
+        AMPLIFY_KARATSUBA_SQR_CUTOFF = karatsuba
+        AMPLIFY_TOOM_MUL_CUTOFF = toom
+        AMPLIFY_TOOM_SQR_CUTOFF = toom
+        AMPLIFY_TOOM4_MUL_CUTOFF = toom4
+        AMPLIFY_TOOM4_SQR_CUTOFF = toom4
+        AMPLIFY_FFT_MUL_CUTOFF = fft
+        AMPLIFY_FFT_SQR_CUTOFF = fft
+    }
+
+    /// Random signed operands up to `maxDigits`, `unbalanced` makes one up to three times the other.
+    /// Every product and square must match the schoolbook one, and dividing a * b + a by b
+    /// must give a quotient and remainder that multiply back.
+    private func checkAgainstSchoolbook(maxDigits: Int, unbalanced: Bool, file: StaticString = #filePath, line: UInt = #line) {
+        var generator = SystemRandomNumberGenerator()
+        for round in 0 ..< 200 {
+            let shortDigits = Int.random(in: 0 ..< maxDigits, using: &generator)
+            let longDigits = shortDigits + (unbalanced
+                ? Int.random(in: 0 ... 2 * shortDigits + 1, using: &generator)
+                : Int.random(in: 0 ... 2, using: &generator))
+            let allOnes = round % 9 == 0
+            let a = MPInt(randomDigits: longDigits, allOnes: allOnes, using: &generator)
+            let b = MPInt(randomDigits: shortDigits, allOnes: allOnes, using: &generator)
+            let sizes = "\(longDigits) x \(shortDigits) digits"
+
+            let expected = schoolbookProduct(a, b)
+            let product = MPInt(), reversed = MPInt()
+            XCTAssertEqual(amplify_mp_mul(&a.value, &b.value, &product.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqual(amplify_mp_mul(&b.value, &a.value, &reversed.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqualMP(product, expected, "mul \(sizes)", file: file, line: line)
+            XCTAssertEqualMP(reversed, expected, "mul \(sizes)", file: file, line: line)
+
+            let square = MPInt(), expectedSquare = MPInt()
+            XCTAssertEqual(amplify_mp_sqr(&a.value, &square.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqual(amplify_s_mp_sqr(&a.value, &expectedSquare.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqualMP(square, expectedSquare, "sqr \(longDigits) digits", file: file, line: line)
+
+            guard b.value.used > 0 else {
+                continue
+            }
+            let dividend = MPInt(), quotient = MPInt(), remainder = MPInt(), multiple = MPInt(), check = MPInt()
+            XCTAssertEqual(amplify_mp_add(&product.value, &a.value, &dividend.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqual(amplify_mp_div(&dividend.value, &b.value, &quotient.value, &remainder.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqual(amplify_mp_mul(&quotient.value, &b.value, &multiple.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqual(amplify_mp_add(&multiple.value, &remainder.value, &check.value), AMPLIFY_MP_OKAY, file: file, line: line)
+            XCTAssertEqualMP(check, dividend, "div \(sizes)", file: file, line: line)
+            XCTAssertEqual(amplify_mp_cmp_mag(&remainder.value, &b.value), AMPLIFY_MP_LT, "div \(sizes)", file: file, line: line)
+        }
+    }
+
+    private func schoolbookProduct(_ a: MPInt, _ b: MPInt) -> MPInt {
+        let product = MPInt()
+        let result = amplify_s_mp_mul_digs(&a.value, &b.value, &product.value, a.value.used + b.value.used + 1)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_s_mp_mul_digs failed: \(result)")
+        product.value.sign = product.value.used > 0 && a.value.sign != b.value.sign ? AMPLIFY_MP_NEG : AMPLIFY_MP_ZPOS
+        return product
+    }
+}
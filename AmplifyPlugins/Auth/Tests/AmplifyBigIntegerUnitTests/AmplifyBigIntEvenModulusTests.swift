@@ -0,0 +1,106 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntEvenModulusTests: XCTestCase {
+
+    // RFC 5054 3072-bit group
+    let prime = AmplifyBigInt(
+        "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B2" +
+        "2514A08798E3404DDEF9519B3CD3A431B302B0A6DF25F14374FE1356D6D51C245E485B576625E7E" +
+        "C6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE649286651ECE45" +
+        "B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F3562085" +
+        "52BB9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180" +
+        "E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF6955817183995497CEA956AE515D2261898" +
+        "FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575" +
+        "D060C7DB3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06" +
+        "D98A0864D87602733EC86A64521F2B18177B200CBBE117577A615D6C770988C0BAD946E208E24FA" +
+        "074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF",
+        radix: 16
+    )!
+
+    func testEvenModulusMatchesBothFactors() throws {
+        let base = AmplifyBigInt(5)
+        let exponent = AmplifyBigInt(unsignedData: [UInt8](repeating: 0xC3, count: 48))
+        let power = base.pow(exponent, modulus: prime << 64)
+        XCTAssertEqual(power % prime, base.pow(exponent, modulus: prime))
+
+        // 5^exponent mod 2^64 with the wrapping arithmetic of UInt64
+        var expected: UInt64 = 1
+        for byte in [UInt8](repeating: 0xC3, count: 48) {
+            for bit in (0 ..< 8).reversed() {
+                expected = expected &* expected
+                if byte >> bit & 1 == 1 {
+                    expected = expected &* 5
+                }
+            }
+        }
+        XCTAssertEqual(power & AmplifyBigInt(UInt64.max), AmplifyBigInt(expected))
+        XCTAssertEqual(AmplifyBigInt(6).pow(AmplifyBigInt(64), modulus: AmplifyBigInt(3) << 64), AmplifyBigInt(0))
+    }
+
+    func testPowerOfTwoModulus() {
+        // no odd factor, the result is the power of two part alone
+        let exponentBytes = [UInt8](repeating: 0x9D, count: 40)
+        let exponent = AmplifyBigInt(unsignedData: exponentBytes)
+        for bits in [1, 2, 3, 64, 200] {
+            let modulus = AmplifyBigInt(1) << bits
+            for base in [3, 6, 12_345_678_901] {
+                XCTAssertEqual(
+                    AmplifyBigInt(base).pow(exponent, modulus: modulus),
+                    reference(AmplifyBigInt(base), exponentBytes, modulus),
+                    "\(base) mod 2^\(bits)"
+                )
+            }
+        }
+
+        // an even base stays nonzero while the exponent is below the number of bits
+        XCTAssertEqual(AmplifyBigInt(6).pow(AmplifyBigInt(10), modulus: AmplifyBigInt(1) << 64), AmplifyBigInt(60_466_176))
+        XCTAssertEqual(AmplifyBigInt(2).pow(AmplifyBigInt(63), modulus: AmplifyBigInt(1) << 64), AmplifyBigInt(1) << 63)
+        XCTAssertEqual(AmplifyBigInt(2).pow(AmplifyBigInt(64), modulus: AmplifyBigInt(1) << 64), AmplifyBigInt(0))
+    }
+
+    func testOneOrTwoFactorsOfTwo() {
+        // for k < 3 the odd base is reduced with the exponent mod 2, the even
+        // base vanishes once the exponent reaches k
+        for factor in [2, 4] {
+            let modulus = prime * AmplifyBigInt(factor)
+            for base in [7, 10] {
+                for exponent in [0, 1, 2, 3, 65_537] {
+                    var exponentBytes = [UInt8]()
+                    var remaining = exponent
+                    while remaining > 0 {
+                        exponentBytes.insert(UInt8(remaining & 0xFF), at: 0)
+                        remaining >>= 8
+                    }
+                    XCTAssertEqual(
+                        AmplifyBigInt(base).pow(AmplifyBigInt(exponent), modulus: modulus),
+                        reference(AmplifyBigInt(base), exponentBytes, modulus),
+                        "\(base)^\(exponent) mod \(factor)p"
+                    )
+                }
+            }
+        }
+    }
+
+    /// Square and multiply with plain reductions, independent of exptmod
+    private func reference(_ base: AmplifyBigInt, _ exponentBytes: [UInt8], _ modulus: AmplifyBigInt) -> AmplifyBigInt {
+        let reducedBase = base % modulus
+        var result = AmplifyBigInt(1) % modulus
+        for byte in exponentBytes {
+            for bit in (0 ..< 8).reversed() {
+                result = (result * result) % modulus
+                if byte >> bit & 1 == 1 {
+                    result = (result * reducedBase) % modulus
+                }
+            }
+        }
+        return result
+    }
+}
@@ -0,0 +1,36 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntNegativePowTests: XCTestCase {
+
+    // 2^127 - 1
+    let prime = (AmplifyBigInt(1) << 127) - 1
+
+    func testNegativeBaseMatchesItsReduction() {
+        let exponent = AmplifyBigInt(unsignedData: [UInt8](repeating: 0x5A, count: 48))
+        for base in [-2, -3, -12_345_678_901] {
+            let reduced = prime + AmplifyBigInt(base)
+            XCTAssertEqual(AmplifyBigInt(base).pow(exponent, modulus: prime), reduced.pow(exponent, modulus: prime), "\(base)")
+        }
+    }
+
+    func testNegativeExponentOfNegativeBase() {
+        // the inverse is taken of the reduced base, by Fermat here
+        for (base, exponent) in [(-2, -1), (-3, -65_537), (-12_345_678_901, -(1 << 40))] {
+            let reduced = prime + AmplifyBigInt(base)
+            let inverse = reduced.pow(prime - 2, modulus: prime)
+            XCTAssertEqual(
+                AmplifyBigInt(base).pow(AmplifyBigInt(exponent), modulus: prime),
+                inverse.pow(AmplifyBigInt(-exponent), modulus: prime),
+                "\(base)^\(exponent)"
+            )
+        }
+    }
+}
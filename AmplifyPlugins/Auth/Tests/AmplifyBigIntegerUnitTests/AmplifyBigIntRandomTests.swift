@@ -0,0 +1,52 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntRandomTests: XCTestCase {
+
+    override func tearDown() {
+        AmplifyRandomGenerator.installPlatformGenerator()
+    }
+
+    func testRandomBelowSmallBound() {
+        let bound = AmplifyBigInt(7)
+        for _ in 0 ..< 100 {
+            let randomInt = AmplifyBigInt.random(below: bound)
+            XCTAssertTrue(randomInt >= AmplifyBigInt(0))
+            XCTAssertTrue(randomInt < bound)
+        }
+    }
+
+    func testRandomBelowLargeBoundWithBufferedGenerator() {
+        AmplifyRandomGenerator.installBufferedGenerator()
+        let bound = AmplifyBigInt(unsignedData: [0x80] + [UInt8](repeating: 0, count: 383))
+        let first = AmplifyBigInt.random(below: bound)
+        let second = AmplifyBigInt.random(below: bound)
+        XCTAssertTrue(first < bound)
+        XCTAssertTrue(second < bound)
+        XCTAssertNotEqual(first, second)
+    }
+
+    func testRandomSafePrime() {
+        let prime = AmplifyBigInt.randomPrime(bits: 256, safe: true, threads: 4)
+        let bytes = prime.unsignedByteArray
+        XCTAssertEqual(bytes.count, 32)
+        XCTAssertGreaterThanOrEqual(bytes[0], 0x80)
+        XCTAssertEqual(bytes[31] & 3, 3)
+        XCTAssertEqual(AmplifyBigInt(2).pow(prime - 1, modulus: prime), AmplifyBigInt(1))
+    }
+
+    func testBufferedRandomBytes() {
+        let first = AmplifyRandomGenerator.bufferedRandomBytes(count: 32)
+        let second = AmplifyRandomGenerator.bufferedRandomBytes(count: 32)
+        XCTAssertEqual(first.count, 32)
+        XCTAssertNotEqual(first, second)
+        XCTAssertEqual(AmplifyRandomGenerator.bufferedRandomBytes(count: 5_000).count, 5_000)
+    }
+}
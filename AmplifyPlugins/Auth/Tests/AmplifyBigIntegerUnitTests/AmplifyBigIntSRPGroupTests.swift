@@ -0,0 +1,42 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntSRPGroupTests: XCTestCase {
+
+    // RFC 3526 MODP group 14, a safe prime that is not one of the RFC 5054 groups
+    let modp2048HexValue =
+        "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74" +
+        "020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B302B0A6DF25F1437" +
+        "4FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7ED" +
+        "EE386BFB5A899FA5AE9F24117C4B1FE649286651ECE45B3DC2007CB8A163BF05" +
+        "98DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB" +
+        "9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3B" +
+        "E39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF695581718" +
+        "3995497CEA956AE515D2261898FA051015728E5A8AACAA68FFFFFFFFFFFFFFFF"
+
+    func testSafePrimeOutsideRFC5054IsAccepted() throws {
+        let prime = try XCTUnwrap(AmplifyBigInt(modp2048HexValue, radix: 16))
+        XCTAssertTrue(AmplifyBigInt.isValidSRPGroup(prime: prime, generator: AmplifyBigInt(2)))
+        // the memoized verdict is returned for the same modulus
+        XCTAssertTrue(AmplifyBigInt.isValidSRPGroup(prime: prime, generator: AmplifyBigInt(5)))
+    }
+
+    func testNonSafePrimeIsRejected() throws {
+        let prime = try XCTUnwrap(AmplifyBigInt(modp2048HexValue, radix: 16))
+        let composite = prime - AmplifyBigInt(2)
+        XCTAssertFalse(AmplifyBigInt.isValidSRPGroup(prime: composite, generator: AmplifyBigInt(2)))
+    }
+
+    func testGeneratorOutOfRangeIsRejected() throws {
+        let prime = try XCTUnwrap(AmplifyBigInt(modp2048HexValue, radix: 16))
+        XCTAssertFalse(AmplifyBigInt.isValidSRPGroup(prime: prime, generator: AmplifyBigInt(1)))
+        XCTAssertFalse(AmplifyBigInt.isValidSRPGroup(prime: prime, generator: prime - AmplifyBigInt(1)))
+    }
+}
@@ -0,0 +1,55 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyBigIntStatisticsTests: XCTestCase {
+
+    func testResetClearsCounters() {
+        _ = AmplifyBigInt(3).pow(AmplifyBigInt(65_537), modulus: AmplifyBigInt(1_000_003))
+        AmplifyBigInt.Statistics.reset()
+
+        let stats = AmplifyBigInt.Statistics.snapshot()
+        XCTAssertEqual(stats.modularExponentiation.calls, 0)
+        XCTAssertEqual(stats.allocations, 0)
+    }
+
+    func testExponentiationIsCounted() throws {
+        try XCTSkipUnless(AmplifyBigInt.Statistics.isEnabled, "libtommathAmplify built without AMPLIFY_MP_STATS")
+
+        // the RFC 5054 1024-bit group prime, odd and neither a DR nor a 2k modulus,
+        // so the exponentiation takes the Montgomery path the SRP client uses
+        let modulus = try XCTUnwrap(AmplifyBigInt(
+            "EEAF0AB9ADB38DD69C33F80AFA8FC5E86072618775FF3C0B9EA2314C9C256576" +
+            "D674DF7496EA81D3383B4813D692C6E0E0D5D8E250B98BE48E495C1D6089DAD1" +
+            "5DC7D7B46154D6B6CE8EF4AD69B15D4982559B297BCF1885C529F566660E57EC" +
+            "68EDBC3C05726CC02FD4CBF4976EAA9AFD5138FE8376435B9FC61D2FC0EB06E3",
+            radix: 16
+        ))
+        AmplifyBigInt.Statistics.reset()
+
+        let result = AmplifyBigInt(5).pow(AmplifyBigInt(unsignedData: [UInt8](repeating: 0xA5, count: 32)), modulus: modulus)
+        _ = result.asString(radix: 16)
+
+        let stats = AmplifyBigInt.Statistics.snapshot()
+        XCTAssertEqual(stats.modularExponentiation.calls, 1)
+        XCTAssertEqual(stats.radixConversion.calls, 1)
+        XCTAssertGreaterThan(stats.squaring.calls, 0)
+        XCTAssertGreaterThan(stats.reduction.calls, 0)
+        XCTAssertGreaterThan(stats.allocations, 0)
+    }
+
+    func testDisabledStatisticsAreZero() throws {
+        try XCTSkipIf(AmplifyBigInt.Statistics.isEnabled, "libtommathAmplify built with AMPLIFY_MP_STATS")
+        _ = AmplifyBigInt(3).pow(AmplifyBigInt(65_537), modulus: AmplifyBigInt(1_000_003))
+
+        let stats = AmplifyBigInt.Statistics.snapshot()
+        XCTAssertEqual(stats.multiplication.calls, 0)
+        XCTAssertEqual(stats.frees, 0)
+    }
+}
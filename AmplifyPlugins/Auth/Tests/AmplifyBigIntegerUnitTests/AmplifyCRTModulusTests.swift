@@ -0,0 +1,46 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifyCRTModulusTests: XCTestCase {
+
+    // Mersenne primes 2^89 - 1, 2^107 - 1 and 2^127 - 1
+    let primes = [89, 107, 127].map { (AmplifyBigInt(1) << $0) - 1 }
+
+    func testPowMatchesPow() throws {
+        let crt = try XCTUnwrap(AmplifyCRTModulus(primes: primes))
+        let modulus = primes.reduce(AmplifyBigInt(1), *)
+        XCTAssertEqual(crt.modulus, modulus)
+
+        let base = AmplifyBigInt("123456789012345678901234567890123456789")!
+        let exponent = AmplifyBigInt(unsignedData: [UInt8](repeating: 0x9C, count: 80))
+        for threads in 1 ... 3 {
+            XCTAssertEqual(crt.pow(base, exponent, threads: threads), base.pow(exponent, modulus: modulus))
+        }
+        XCTAssertEqual(crt.pow(-base, exponent), (-base).pow(exponent, modulus: modulus))
+        XCTAssertEqual(crt.pow(base, AmplifyBigInt(0)), AmplifyBigInt(1))
+    }
+
+    func testBaseDivisibleByAFactor() throws {
+        let crt = try XCTUnwrap(AmplifyCRTModulus(primes: primes))
+        let base = primes[1] * 3
+        let exponent = primes[1] - 1
+        XCTAssertEqual(crt.pow(base, exponent), base.pow(exponent, modulus: crt.modulus))
+    }
+
+    func testInvalidFactorsAreRejected() {
+        XCTAssertNil(AmplifyCRTModulus(primes: []))
+        XCTAssertNil(AmplifyCRTModulus(primes: [primes[0], primes[0]]))
+        XCTAssertNil(AmplifyCRTModulus(primes: [primes[0], AmplifyBigInt(2)]))
+
+        // odd composites coprime with the other factors, 2^127 + 1 and 3 * 5 * 7
+        XCTAssertNil(AmplifyCRTModulus(primes: [primes[0], primes[2] + 2]))
+        XCTAssertNil(AmplifyCRTModulus(primes: [AmplifyBigInt(105), primes[1]]))
+    }
+}
@@ -0,0 +1,271 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import libtommathAmplify
+import XCTest
+
+/// The prime pretests and tests against one remainder or one exponentiation per candidate
+final class AmplifyPrimeTests: XCTestCase {
+
+    private var tableSize: Int {
+        Int(PRIVATE_MP_PRIME_TAB_SIZE)
+    }
+
+    // MARK: - Trial division
+
+    func testTrialDivisionMatchesRemainders() {
+        // zero, one, the table primes and their neighbours, of either sign
+        for int in Int64(-5000) ... 5000 {
+            checkTrialDivision(MPInt(int))
+        }
+
+        // the first primes past the table, alone and times the last one in it
+        let largest = Int64(amplify_s_mp_prime_tab[tableSize - 1])
+        checkTrialDivision(MPInt(1621 * 1627))
+        checkTrialDivision(MPInt(1621 * largest))
+        checkTrialDivision(MPInt(-1621 * 1621))
+
+        // several digits, every other number with a table prime factor
+        var generator = SystemRandomNumberGenerator()
+        for round in 0 ..< 500 {
+            let a = MPInt(randomDigits: Int.random(in: 1 ... 40, using: &generator), using: &generator)
+            guard round % 2 == 0 else {
+                checkTrialDivision(a)
+                continue
+            }
+            let multiple = MPInt()
+            let prime = amplify_s_mp_prime_tab[Int.random(in: 0 ..< tableSize, using: &generator)]
+            XCTAssertEqual(amplify_mp_mul_d(&a.value, prime, &multiple.value), AMPLIFY_MP_OKAY)
+            checkTrialDivision(multiple)
+        }
+    }
+
+    // MARK: - Sieve
+
+    func testSieveMatchesTrialDivision() {
+        // the smallest start the sieve allows, one digit and several digits
+        let smallest = MPInt(Int64(amplify_s_mp_prime_tab[tableSize - 1]) * 2 + 3)
+        let oneDigit = MPInt(hex: "FEDCBA987654321")
+        var generator = SystemRandomNumberGenerator()
+        let severalDigits = MPInt(randomDigits: 10, using: &generator)
+        severalDigits.value.sign = AMPLIFY_MP_ZPOS
+        severalDigits.value.dp[0] |= 1
+
+        for start in [smallest, oneDigit, severalDigits] {
+            for step: amplify_mp_digit in [2, 4] {
+                checkSieve(from: start, step: step, safe: AMPLIFY_MP_NO)
+                checkSieve(from: start, step: step, safe: AMPLIFY_MP_YES)
+            }
+        }
+    }
+
+    func testSieveRejectsOtherSteps() {
+        let start = MPInt(4001)
+        var residues = [amplify_mp_digit](repeating: 0, count: tableSize)
+        var composite = [UInt8](repeating: 0, count: Int(AMPLIFY_MP_PRIME_SIEVE_WINDOW) / 8)
+        for step: amplify_mp_digit in [0, 1, 3, 6] {
+            XCTAssertEqual(amplify_s_mp_prime_sieve(&start.value, &residues, step, AMPLIFY_MP_NO, &composite), AMPLIFY_MP_VAL)
+        }
+    }
+
+    // MARK: - Miller-Rabin and strong Lucas on one Montgomery context
+
+    private let strongLucasPseudoprimes: Set<Int64> = [5459, 5777, 10877, 16109, 18971, 22499, 24569, 25199]
+
+    /// 2^127 - 1, 2^255 - 19, 2^521 - 1 and the RFC 5054 1024-bit group prime
+    private let largePrimes = [
+        "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF",
+        "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED",
+        "1" + String(repeating: "F", count: 130),
+        "EEAF0AB9ADB38DD69C33F80AFA8FC5E86072618775FF3C0B9EA2314C9C256576" +
+        "D674DF7496EA81D3383B4813D692C6E0E0D5D8E250B98BE48E495C1D6089DAD1" +
+        "5DC7D7B46154D6B6CE8EF4AD69B15D4982559B297BCF1885C529F566660E57EC" +
+        "68EDBC3C05726CC02FD4CBF4976EAA9AFD5138FE8376435B9FC61D2FC0EB06E3"
+    ].map { MPInt(hex: $0) }
+
+    func testMillerRabinMatchesExptmod() {
+        // every odd n below 30000 to the bases 2 to 11, all through the one context of n
+        for n in stride(from: Int64(3), to: 30000, by: 2) {
+            let a = MPInt(n)
+            withMontgomeryContext(of: a) { ctx in
+                for base in Int64(2) ... 11 {
+                    checkMillerRabin(ctx, a, base: MPInt(base))
+                }
+            }
+        }
+
+        // several digits, bases past n take the reduction, n and 2n + 2 reduce to 0 and 2
+        var generator = SystemRandomNumberGenerator()
+        let composites = zip(largePrimes, largePrimes.dropFirst()).map { product($0, $1) }
+        for a in largePrimes + composites {
+            withMontgomeryContext(of: a) { ctx in
+                for round in 0 ..< 10 {
+                    let base = MPInt(randomDigits: (round + 1) * Int(a.value.used) / 4 + 1, using: &generator)
+                    base.value.sign = AMPLIFY_MP_ZPOS
+                    checkMillerRabin(ctx, a, base: base)
+                }
+                let twice = MPInt(), twicePlusTwo = MPInt()
+                XCTAssertEqual(amplify_mp_mul_2(&a.value, &twice.value), AMPLIFY_MP_OKAY)
+                XCTAssertEqual(amplify_amplify_mp_add_d(&twice.value, 2, &twicePlusTwo.value), AMPLIFY_MP_OKAY)
+                checkMillerRabin(ctx, a, base: a)
+                checkMillerRabin(ctx, a, base: twicePlusTwo)
+            }
+        }
+    }
+
+    func testStrongLucasMatchesKnownPrimes() {
+        // the odd non-squares below 30000 pass iff prime or a known strong Lucas pseudoprime
+        for n in stride(from: Int64(3), to: 30000, by: 2) where !isSquare(n) {
+            let a = MPInt(n)
+            withMontgomeryContext(of: a) { ctx in
+                var result = AMPLIFY_MP_NO
+                XCTAssertEqual(amplify_s_mp_prime_strong_lucas_selfridge(ctx, &result), AMPLIFY_MP_OKAY)
+                XCTAssertEqual(result == AMPLIFY_MP_YES, isPrime(n) || strongLucasPseudoprimes.contains(n), "\(n)")
+            }
+        }
+
+        // several digits, the primes pass and their products do not
+        let composites = zip(largePrimes, largePrimes.dropFirst()).map { product($0, $1) }
+        for (a, expected) in largePrimes.map({ ($0, true) }) + composites.map({ ($0, false) }) {
+            withMontgomeryContext(of: a) { ctx in
+                var result = AMPLIFY_MP_NO
+                XCTAssertEqual(amplify_s_mp_prime_strong_lucas_selfridge(ctx, &result), AMPLIFY_MP_OKAY)
+                XCTAssertEqual(result == AMPLIFY_MP_YES, expected, a.hex)
+            }
+        }
+    }
+
+    func testPrimeTestsWithoutMontgomeryContext() {
+        // zero, one, even and negative n have no context
+        var ctx = amplify_s_mp_mont_ctx()
+        for n: Int64 in [0, 1, 2, 4, -1, -3, -7] {
+            let a = MPInt(n)
+            XCTAssertEqual(amplify_s_mp_mont_init(&ctx, &a.value), AMPLIFY_MP_VAL, "\(n)")
+
+            // the public tests fall back to the generic code, only 2 is prime
+            var result = AMPLIFY_MP_YES
+            XCTAssertEqual(amplify_mp_prime_strong_lucas_selfridge(&a.value, &result), AMPLIFY_MP_OKAY, "\(n)")
+            XCTAssertEqual(result == AMPLIFY_MP_YES, n == 2, "\(n)")
+        }
+
+        // bases below 2 are refused
+        let a = MPInt(101)
+        for base: Int64 in [1, 0, -5] {
+            let b = MPInt(base)
+            var result = AMPLIFY_MP_YES
+            XCTAssertEqual(amplify_mp_prime_miller_rabin(&a.value, &b.value, &result), AMPLIFY_MP_VAL, "\(base)")
+            XCTAssertEqual(result, AMPLIFY_MP_NO)
+        }
+    }
+
+    // MARK: - Helpers
+
+    /// Runs `body` with the Montgomery context of n, which keeps referring to n until it is cleared
+    private func withMontgomeryContext(of n: MPInt, _ body: (UnsafePointer<amplify_s_mp_mont_ctx>) -> Void) {
+        withUnsafePointer(to: n.value) { modulus in
+            var ctx = amplify_s_mp_mont_ctx()
+            let result = amplify_s_mp_mont_init(&ctx, modulus)
+            precondition(result == AMPLIFY_MP_OKAY, "amplify_s_mp_mont_init failed: \(result)")
+            withUnsafePointer(to: ctx) { body($0) }
+            amplify_s_mp_mont_clear(&ctx)
+        }
+    }
+
+    private func checkMillerRabin(_ ctx: UnsafePointer<amplify_s_mp_mont_ctx>, _ n: MPInt, base: MPInt, file: StaticString = #filePath, line: UInt = #line) {
+        var result = AMPLIFY_MP_NO
+        XCTAssertEqual(amplify_s_mp_prime_miller_rabin(ctx, &base.value, &result), AMPLIFY_MP_OKAY, file: file, line: line)
+        XCTAssertEqual(result == AMPLIFY_MP_YES, millerRabinByExptmod(n, base: base), "\(n.hex) to base \(base.hex)", file: file, line: line)
+    }
+
+    /// Miller-Rabin as the generic code does it, amplify_mp_exptmod and amplify_mp_sqrmod modulo n
+    private func millerRabinByExptmod(_ n: MPInt, base: MPInt) -> Bool {
+        let nMinusOne = MPInt(), r = MPInt(), y = MPInt(), square = MPInt()
+        var result = amplify_mp_sub_d(&n.value, 1, &nMinusOne.value)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_sub_d failed: \(result)")
+        let s = amplify_mp_cnt_lsb(&nMinusOne.value)
+        result = amplify_mp_div_2d(&nMinusOne.value, s, &r.value, nil)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_div_2d failed: \(result)")
+        result = amplify_mp_exptmod(&base.value, &r.value, &n.value, &y.value)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_exptmod failed: \(result)")
+
+        if amplify_mp_cmp_d(&y.value, 1) == AMPLIFY_MP_EQ || amplify_mp_cmp(&y.value, &nMinusOne.value) == AMPLIFY_MP_EQ {
+            return true
+        }
+        for _ in 1 ..< s {
+            result = amplify_mp_sqrmod(&y.value, &n.value, &square.value)
+            precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_sqrmod failed: \(result)")
+            amplify_mp_exch(&y.value, &square.value)
+            if amplify_mp_cmp(&y.value, &nMinusOne.value) == AMPLIFY_MP_EQ {
+                return true
+            }
+        }
+        return false
+    }
+
+    private func product(_ a: MPInt, _ b: MPInt) -> MPInt {
+        let product = MPInt()
+        let result = amplify_mp_mul(&a.value, &b.value, &product.value)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_mul failed: \(result)")
+        return product
+    }
+
+    private func isPrime(_ n: Int64) -> Bool {
+        n > 1 && !stride(from: Int64(2), through: Int64(Double(n).squareRoot()), by: 1).contains { n % $0 == 0 }
+    }
+
+    private func isSquare(_ n: Int64) -> Bool {
+        let root = Int64(Double(n).squareRoot().rounded())
+        return root * root == n
+    }
+
+    /// Two consecutive windows from `start`, the second one from the residues the first left behind.
+    /// A candidate must be marked iff an odd table prime divides it or, with `safe`, (candidate - 1) / 2.
+    private func checkSieve(from start: MPInt, step: amplify_mp_digit, safe: amplify_mp_bool, file: StaticString = #filePath, line: UInt = #line) {
+        let window = Int(AMPLIFY_MP_PRIME_SIEVE_WINDOW)
+        var residues = [amplify_mp_digit](repeating: 0, count: tableSize)
+        var composite = [UInt8](repeating: 0, count: window / 8)
+        let candidate = MPInt(), half = MPInt()
+
+        for offset in 0 ..< 2 {
+            let result = offset == 0
+                ? amplify_s_mp_prime_sieve(&start.value, &residues, step, safe, &composite)
+                : amplify_s_mp_prime_sieve(nil, &residues, step, safe, &composite)
+            XCTAssertEqual(result, AMPLIFY_MP_OKAY, file: file, line: line)
+
+            for i in 0 ..< window {
+                let distance = amplify_mp_digit(offset * window + i) * step
+                XCTAssertEqual(amplify_amplify_mp_add_d(&start.value, distance, &candidate.value), AMPLIFY_MP_OKAY, file: file, line: line)
+                var expected = hasTableFactor(candidate, from: 1)
+                if safe == AMPLIFY_MP_YES && !expected {
+                    XCTAssertEqual(amplify_mp_div_2d(&candidate.value, 1, &half.value, nil), AMPLIFY_MP_OKAY, file: file, line: line)
+                    expected = hasTableFactor(half, from: 1)
+                }
+                let marked = (composite[i >> 3] >> (i & 7)) & 1 == 1
+                XCTAssertEqual(marked, expected, "\(start.hex) + \(distance), safe \(safe)", file: file, line: line)
+            }
+        }
+    }
+
+    private func checkTrialDivision(_ a: MPInt, file: StaticString = #filePath, line: UInt = #line) {
+        var result = AMPLIFY_MP_NO
+        XCTAssertEqual(amplify_s_mp_prime_is_divisible(&a.value, &result), AMPLIFY_MP_OKAY, file: file, line: line)
+        XCTAssertEqual(result == AMPLIFY_MP_YES, hasTableFactor(a), a.hex, file: file, line: line)
+    }
+
+    /// Whether a table prime from index `first` on divides a, one amplify_mp_mod_d per prime
+    private func hasTableFactor(_ a: MPInt, from first: Int = 0) -> Bool {
+        for ix in first ..< tableSize {
+            var remainder: amplify_mp_digit = 0
+            let result = amplify_mp_mod_d(&a.value, amplify_s_mp_prime_tab[ix], &remainder)
+            precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_mod_d failed: \(result)")
+            if remainder == 0 {
+                return true
+            }
+        }
+        return false
+    }
+}
@@ -0,0 +1,34 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import libtommathAmplify
+import XCTest
+
+/// The accelerated row kernel against the portable amplify_s_mp_addmul_row64
+final class AmplifyRowKernelTests: XCTestCase {
+
+    func testKernelMatchesPortableRow() throws {
+        guard let kernel = amplify_s_mp_addmul_row64_kernel() else {
+            throw XCTSkip("No accelerated row kernel in this build or on this CPU")
+        }
+        var generator = SystemRandomNumberGenerator()
+
+        for len in 0 ... 70 {
+            for pattern in 0 ..< 4 {
+                // random limbs, all ones (every carry chain runs through), and mixes of the two
+                let a = (0 ..< len).map { _ in pattern & 1 == 1 ? UInt64.max : UInt64.random(in: .min ... .max, using: &generator) }
+                let t = (0 ..< len).map { _ in pattern & 2 == 2 ? UInt64.max : UInt64.random(in: .min ... .max, using: &generator) }
+                for b in [UInt64.max, UInt64.random(in: .min ... .max, using: &generator), 1, 0] {
+                    var expected = t, actual = t
+                    let carry = amplify_s_mp_addmul_row64(&expected, a, Int32(len), b)
+                    XCTAssertEqual(kernel(&actual, a, Int32(len), b), carry, "len \(len), pattern \(pattern), b \(b)")
+                    XCTAssertEqual(actual, expected, "len \(len), pattern \(pattern), b \(b)")
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,263 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifySRPClientContextTests: XCTestCase {
+
+    // MARK: - RFC 5054 appendix B
+
+    // The vectors hash with SHA-1, so k, x and u are taken as given.
+    let rfcNHexValue =
+        "EEAF0AB9ADB38DD69C33F80AFA8FC5E86072618775FF3C0B9EA2314C9C256576" +
+        "D674DF7496EA81D3383B4813D692C6E0E0D5D8E250B98BE48E495C1D6089DAD1" +
+        "5DC7D7B46154D6B6CE8EF4AD69B15D4982559B297BCF1885C529F566660E57EC" +
+        "68EDBC3C05726CC02FD4CBF4976EAA9AFD5138FE8376435B9FC61D2FC0EB06E3"
+
+    let rfcMultiplier = "7556AA045AEF2CDD07ABAF0F665C3E818913186F"
+    let rfcPrivateKey = "94B7555AABE9127CC58CCF4993DB6CF84D16C124"
+    let rfcScramblingParameter = "CE38B9593487DA98554ED47D70A7AE5F462EF019"
+    let rfcPrivateClientKey = "60975527035CF2AD1989806F0407210BC81EDC04E2762A56AFD529DDDA2D4393"
+
+    let rfcPublicClientKey =
+        "61D5E490F6F1B79547B0704C436F523DD0E560F0C64115BB72557EC44352E890" +
+        "3211C04692272D8B2D1A5358A2CF1B6E0BFCF99F921530EC8E39356179EAE45E" +
+        "42BA92AEACED825171E1E8B9AF6D9C03E1327F44BE087EF06530E69F66615261" +
+        "EEF54073CA11CF5858F0EDFDFE15EFEAB349EF5D76988A3672FAC47B0769447B"
+
+    let rfcVerifier =
+        "7E273DE8696FFC4F4E337D05B4B375BEB0DDE1569E8FA00A9886D8129BADA1F1" +
+        "822223CA1A605B530E379BA4729FDC59F105B4787E5186F5C671085A1447B52A" +
+        "48CF1970B4FB6F8400BBF4CEBFBB168152E08AB5EA53D15C1AFF87B2B9DA6E04" +
+        "E058AD51CC72BFC9033B564E26480D78E955A5E29E7AB245DB2BE315E2099AFB"
+
+    let rfcPublicServerKey =
+        "BD0C61512C692C0CB6D041FA01BB152D4916A1E77AF46AE105393011BAF38964" +
+        "DC46A0670DD125B95A981652236F99D9B681CBF87837EC996C6DA04453728610" +
+        "D0C6DDB58B318885D7D82C7F8DEB75CE7BD4FBAA37089E6F9C6059F388838E7A" +
+        "00030B331EB76840910440B1B27AAEAEEB4012B7D7665238A8E3FB004B117B58"
+
+    let rfcPremasterSecret =
+        "B0DC82BABCF30674AE450C0287745E7990A3381F63B387AAF271A10D233861E3" +
+        "59B48220F7C4693C9AE12B0A6F67809F0876E2D013800D6C41BB59B6D5979B5C" +
+        "00A172B4A2A5903A0BDCAF8A709585EB2AFAFA8F3499B200210DCC1F10EB3394" +
+        "3CD67FC88A2F39A4BE5BEC4EC0A3212DC346D7E474B29EDE8A469FFECA686E5A"
+
+    func rfcContext() throws -> AmplifySRPClientContext {
+        AmplifySRPClientContext(
+            prime: try XCTUnwrap(AmplifyBigInt(rfcNHexValue, radix: 16)),
+            generator: AmplifyBigInt(2),
+            multiplier: try XCTUnwrap(AmplifyBigInt(rfcMultiplier, radix: 16))
+        )
+    }
+
+    func testRFC5054PublicKeyAndVerifier() throws {
+        let context = try rfcContext()
+        let a = try XCTUnwrap(AmplifyBigInt(rfcPrivateClientKey, radix: 16))
+        let x = try XCTUnwrap(AmplifyBigInt(rfcPrivateKey, radix: 16))
+        XCTAssertEqual(context.power(a).asString(radix: 16), rfcPublicClientKey)
+        XCTAssertEqual(context.power(x).asString(radix: 16), rfcVerifier)
+    }
+
+    func testRFC5054PremasterSecret() throws {
+        let context = try rfcContext()
+        let secret = context.premasterSecret(
+            privateClientKey: try XCTUnwrap(AmplifyBigInt(rfcPrivateClientKey, radix: 16)),
+            publicServerKey: try XCTUnwrap(AmplifyBigInt(rfcPublicServerKey, radix: 16)),
+            scramblingParameter: try XCTUnwrap(AmplifyBigInt(rfcScramblingParameter, radix: 16)),
+            privateKey: try XCTUnwrap(AmplifyBigInt(rfcPrivateKey, radix: 16))
+        )
+        XCTAssertEqual(secret?.asString(radix: 16), rfcPremasterSecret)
+    }
+
+    func testServerKeyMultipleOfPrimeIsRejected() throws {
+        let context = try rfcContext()
+        let prime = try XCTUnwrap(AmplifyBigInt(rfcNHexValue, radix: 16))
+        let secret = context.premasterSecret(
+            privateClientKey: try XCTUnwrap(AmplifyBigInt(rfcPrivateClientKey, radix: 16)),
+            publicServerKey: prime * 2,
+            scramblingParameter: try XCTUnwrap(AmplifyBigInt(rfcScramblingParameter, radix: 16)),
+            privateKey: try XCTUnwrap(AmplifyBigInt(rfcPrivateKey, radix: 16))
+        )
+        XCTAssertNil(secret)
+    }
+
+    func testGroupPowersMatchRFC5054() throws {
+        let group = try XCTUnwrap(AmplifySRPGroup(
+            prime: try XCTUnwrap(AmplifyBigInt(rfcNHexValue, radix: 16)),
+            generator: AmplifyBigInt(2)
+        ))
+        let a = try XCTUnwrap(AmplifyBigInt(rfcPrivateClientKey, radix: 16))
+        let x = try XCTUnwrap(AmplifyBigInt(rfcPrivateKey, radix: 16))
+        XCTAssertEqual(group.power(a).asString(radix: 16), rfcPublicClientKey)
+        XCTAssertEqual(AmplifySRPClientContext(group: group).power(x).asString(radix: 16), rfcVerifier)
+
+        // exponents past the table take the general path
+        let prime = try XCTUnwrap(AmplifyBigInt(rfcNHexValue, radix: 16))
+        let long = a << 300 + x
+        XCTAssertEqual(group.power(long), AmplifyBigInt(2).pow(long, modulus: prime))
+        XCTAssertEqual(group.power(AmplifyBigInt(0)), AmplifyBigInt(1))
+    }
+
+    func testGroupPowersOfNegativeGenerator() throws {
+        let prime = try XCTUnwrap(AmplifyBigInt(rfcNHexValue, radix: 16))
+        let group = try XCTUnwrap(AmplifySRPGroup(prime: prime, generator: AmplifyBigInt(-7)))
+        let reduced = prime - 7
+        let a = try XCTUnwrap(AmplifyBigInt(rfcPrivateClientKey, radix: 16))
+        let long = a << 300 + a
+
+        // the table, past the table, and negative exponents through amplify_mp_exptmod
+        XCTAssertEqual(group.power(a), reduced.pow(a, modulus: prime))
+        XCTAssertEqual(group.power(long), reduced.pow(long, modulus: prime))
+        XCTAssertEqual((group.power(-a) * group.power(a)) % prime, AmplifyBigInt(1))
+        XCTAssertEqual((group.power(-long) * group.power(long)) % prime, AmplifyBigInt(1))
+    }
+
+    func testGroupOfEvenPrimeIsNil() {
+        XCTAssertNil(AmplifySRPGroup(prime: AmplifyBigInt(1 << 20), generator: AmplifyBigInt(2)))
+        XCTAssertNil(AmplifySRPGroup(prime: AmplifyBigInt(1), generator: AmplifyBigInt(2)))
+    }
+
+    // MARK: - Cognito, SHA-256 with signed padding
+
+    let cognitoNHexValue =
+        "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74" +
+        "020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B302B0A6DF25F1437" +
+        "4FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7ED" +
+        "EE386BFB5A899FA5AE9F24117C4B1FE649286651ECE45B3DC2007CB8A163BF05" +
+        "98DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB" +
+        "9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3B" +
+        "E39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF695581718" +
+        "3995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33" +
+        "A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7DB3970F85A6E1E4C7" +
+        "ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864" +
+        "D87602733EC86A64521F2B18177B200CBBE117577A615D6C770988C0BAD946E2" +
+        "08E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF"
+
+    func testCognitoMultiplier() throws {
+        let context = AmplifySRPClientContext(
+            prime: try XCTUnwrap(AmplifyBigInt(cognitoNHexValue, radix: 16)),
+            generator: AmplifyBigInt(2)
+        )
+        XCTAssertEqual(
+            context.multiplier.asString(radix: 16),
+            "538282C4354742D7CBBDE2359FCF67F9F5B3A6B08791E5011B43B8A5B66D9EE6"
+        )
+        let group = try XCTUnwrap(AmplifySRPGroup(
+            prime: try XCTUnwrap(AmplifyBigInt(cognitoNHexValue, radix: 16)),
+            generator: AmplifyBigInt(2)
+        ))
+        XCTAssertEqual(group.multiplier, context.multiplier)
+    }
+
+    func testCognitoScramblingParameter() throws {
+        let publicClientKey =
+            "27042f8575322fee79d27caaec003ab3dd7bf6b7c40c3438ebac8c75329d2fdc" +
+            "f8f344c33dce23fcb7d265b681600eeef19a83be4bed41e368f25a3913a71203" +
+            "c1744f66cd2a7b5e4c06a0c062c5fce4b07b1a73fc7adcf6233db976d1ce417f" +
+            "f4eb9153df873970326a9c18e36c2ae8490149d98422ce57a001853279761260" +
+            "316321f4b4e90d6fd9e4ff55b3cea2a55be9446f13736aad842e9af0763e83f4" +
+            "208320a326fb592eac84f3c65ac46573c41443f4c4673189e6b4afe8b84a4332" +
+            "7de73577145927bc2408390ab63724a17b150225cbb1620f5607c8676641ee49" +
+            "f6c06071a5a009be48b7449efabfdfa9b26edea8f731b579aa803d1333dd1472" +
+            "dd1ae59fea12d0a5200925be31979ac37911f67aed2f9ba4b1a326488e1a03b1" +
+            "e10f2287f06df83b04c955a4776dffb49dd4cc17f9a20f0f14ec22342c2d9779" +
+            "5a24e5e86810d21430713fd6c9612a59e864ba251fca59e36555c4abb28cf6b1" +
+            "049544dcea3cfe3d024ed57b81a3366e0e9daee4616e7b277412032ec6b50e57"
+        let publicServerKey =
+            "b5619b2e02a66d7681acc7ab0d4baa69921d8b8e2e1b67828c5d88d403c93b17" +
+            "6879a0f9c93127109f2b72120231238a3b56adefb53e8e454679f5d3e4874926" +
+            "a7b1cd9515999f57867e265b30a918628bba40ccffc7ef29f71e92e60c1acb3f" +
+            "48e7240ad621add7fb8c80646309d2fc980976b2f41219d877d1264a13f52cb7" +
+            "233ab06e4c056bcd0af7a4a3f5e4e887e90da816c1e599fcc8b62d9ee2fd5f9c" +
+            "011f14119af03e1b39ffbfc5442614746f1b9a8f3650244ae7711b9e0b5adb49" +
+            "9711c81ad65d5e50f554e4add08e499f387f517d8269cc80302f935cb6c40297" +
+            "82bd65ef55b315fbec657288b2dab1699cf32ef8c09b822e650ffe9f7ecac5ee" +
+            "d47bc6e63a9f9f46bd9bb3eabc7c758ca944aedb7a5a4a204fc4f5a67093a7f4" +
+            "ea444417b85e71bf7363b98a982d4f5bb77e4a6ac66f15054663775bc567445b" +
+            "62685f1d4e9bf20ac14bf00453c5b666e88e1c72a6539bfda079e4de05b32462" +
+            "9b160935d15cdb18d1f8dfe55f2d84afaef0f761bec33eba2178b426a7bf2985"
+        let u = AmplifySRPClientContext.scramblingParameter(
+            publicClientKey: try XCTUnwrap(AmplifyBigInt(publicClientKey, radix: 16)),
+            publicServerKey: try XCTUnwrap(AmplifyBigInt(publicServerKey, radix: 16))
+        )
+        XCTAssertEqual(u.asString(radix: 16), "C3A1193F8683863ACC9C1D9532105C589696E3347B860080853435906B61342A")
+    }
+
+    func testCognitoPremasterSecret() throws {
+        let privateClientKey =
+            "98fba2902c23b5e55de97ae4e9497f0b7dfbb639f1539243029ddabd0ed10c8"
+        let publicClientKey =
+            "c4808c3cee673f869923c08c3f42aa4b2a98197f2187ce9af9736a27c1689bf7" +
+            "f423cc5a20973ed1b4db7daead68a54467308dd80701adb31756f43286cb88b1" +
+            "d441115e4eddcaa1730ecb3164068db45d0960b81a652798cf018369c5a3f581" +
+            "036cee2b36b4e63839b4d9b313a21b54e658dbc2c7aa1b0bb0c73be9d9dcb713" +
+            "462e6630fc748e4d4899b4e1db4b579d1a24f9fd7ecdd43ded934a5bde8e90bc" +
+            "488a8f49d6b849f95cac284e17589285d6bbcd1c86d57ccfbbb991dc3cd2b66f" +
+            "56d197fdacb9cc2da9f79b582bf2e632266f73cfe2f6ae9373e1438a48aaf7fe" +
+            "c6be9bf4f87415c7a500ddf8181c075f2284ab2c2810b03eb211696d2d47584c" +
+            "6e9d2810ec17466ea5a2adfc99193746942b5abb48d3957de4ab3249d17af696" +
+            "b18b36d05f6051ba41dd732e23f05c378625459f0971cffe702badd6dd4d40e0" +
+            "6e012636fb29784f7541caaa6c8c09b9465f7d364850228661c1573c446ef5fb" +
+            "859f2ee8eb6cc3642de42b47d777b1148c4dede62819458df94a83e526c0cd9f"
+        let publicServerKey =
+            "cccd551910a5a4a05af370b8f7340bd4a4cbf2daed273fcfc3c4ec112f1424f0" +
+            "64635e9ad8337af7a7372212793c057f24570ea2c2e87f1b47a9153dfdeb4707" +
+            "72f2985dc3e7ffca700a3b826ad4fe559f3d3cbdd5e33d02a4008cd6cd1104df" +
+            "09236647c59ea3645beebaffefe34ea5915cdb974e905ac06e7daf4932327f1b" +
+            "d7c9d8e0778c971996497cecd8b17a4e49636024ef1b6c6ba293d06d5cb49684" +
+            "aa8a6c03a51d6e9eb6c612e886ad2b553e75918043150f73114f7e455f755956" +
+            "0f7b67f21340c5c3dff8b1af71fe3bfa73bd0a7443d197c19ab7927d25ad3605" +
+            "89da9ab2e20e7fc2278eda238323ac7f1d2bd7dc909c1f96560eff8214ae0026" +
+            "f67891fe97ccd49702263ee9ef93888c5797beab21bdeeba688668f1d6002809" +
+            "afbd726506e7aa527ad867235aaf34131b2ba2b09e12733ad3fcd00ea945c0ca" +
+            "546911d0bf23234852ae507800aa81e2722d0494ae5ac735e7ed5c0288fd7498" +
+            "35b9a58dd7c340a824191a9f177f12ef824102c3582b92bb608ab090ca34e246"
+        let expectedSecret =
+            "eaf55a5aab2cacc78e84aea5bf6e01c4d63fc3bc7fb19c3360144e79dcc0b2fb" +
+            "1f1b55203d430d396027e64cd5ad4561f7bc4c5395f43ce3863055c522ab252c" +
+            "c5ec488e0f2321dcb675d410d19c042a8a3dcb517609dc2ebb3db42a70a91849" +
+            "bd0cd7ca36a2aded7bf137643e0f02da31b9b32804bb41e5a877cd72a45a2211" +
+            "c90c71deea91d004baf7258e179afd9299d91279c7a268473cfb3255d4750be7" +
+            "ba1da07366c8329a15770345243132416c908a89739fd2d3e980ff0a697d628b" +
+            "49966a9683575aef37b5d3f33cc0258fb2c492123c0c01cd703680cbceff1f2c" +
+            "117711da53ce9322a74a1ab5355f51e358347adfed8c40d413059a07ba1a1f53" +
+            "c8f341560de8f94bff0cf027cc5a6ab556c9d3e60ac2efebc5716454ca80e9c5" +
+            "0d6ef2561ac23148179e37b7490baba57ff7bd65ddababaa335454a4eb4738c4" +
+            "2bf5166b7e99acdef377e584e00dcc01cd2e631b77fea29e48efb0f22409e35a" +
+            "b625f4b9bed94fe9af5d9fb4cd1e16a6c4c8f3edf54d1f2b24e4afcd40d69888"
+        let context = AmplifySRPClientContext(
+            prime: try XCTUnwrap(AmplifyBigInt(cognitoNHexValue, radix: 16)),
+            generator: AmplifyBigInt(2)
+        )
+        let secret = context.premasterSecret(
+            identity: [UInt8]("VEUHc88gProyji7:dummy123@".utf8),
+            salt: try XCTUnwrap(AmplifyBigInt("8bb7dcf905f418bf27b6623aa4d2f58f", radix: 16)),
+            privateClientKey: try XCTUnwrap(AmplifyBigInt(privateClientKey, radix: 16)),
+            publicClientKey: try XCTUnwrap(AmplifyBigInt(publicClientKey, radix: 16)),
+            publicServerKey: try XCTUnwrap(AmplifyBigInt(publicServerKey, radix: 16))
+        )
+        XCTAssertEqual(secret?.asString(radix: 16), expectedSecret.uppercased())
+
+        // the same S, with the u it was computed with
+        let publicClientKeyNum = try XCTUnwrap(AmplifyBigInt(publicClientKey, radix: 16))
+        let publicServerKeyNum = try XCTUnwrap(AmplifyBigInt(publicServerKey, radix: 16))
+        let both = try XCTUnwrap(context.premasterSecretAndScramblingParameter(
+            identity: [UInt8]("VEUHc88gProyji7:dummy123@".utf8),
+            salt: try XCTUnwrap(AmplifyBigInt("8bb7dcf905f418bf27b6623aa4d2f58f", radix: 16)),
+            privateClientKey: try XCTUnwrap(AmplifyBigInt(privateClientKey, radix: 16)),
+            publicClientKey: publicClientKeyNum,
+            publicServerKey: publicServerKeyNum
+        ))
+        XCTAssertEqual(both.premasterSecret, secret)
+        XCTAssertEqual(
+            both.scramblingParameter,
+            AmplifySRPClientContext.scramblingParameter(publicClientKey: publicClientKeyNum, publicServerKey: publicServerKeyNum)
+        )
+    }
+}
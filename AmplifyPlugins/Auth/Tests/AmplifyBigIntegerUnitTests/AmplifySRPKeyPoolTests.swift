@@ -0,0 +1,55 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class AmplifySRPKeyPoolTests: XCTestCase {
+
+    func testEmptyPoolReturnsNil() {
+        let pool = AmplifySRPKeyPool(capacity: 2)
+        XCTAssertEqual(pool.capacity, 2)
+        XCTAssertEqual(pool.count, 0)
+        XCTAssertNil(pool.take())
+    }
+
+    func testPairsAreTakenInOrder() {
+        let pool = AmplifySRPKeyPool(capacity: 2)
+        for round in 0 ..< 3 {
+            XCTAssertTrue(pool.put(privateKey: AmplifyBigInt(round), publicKey: AmplifyBigInt(round + 100)))
+            XCTAssertTrue(pool.put(privateKey: AmplifyBigInt(round + 1), publicKey: AmplifyBigInt(round + 101)))
+            XCTAssertEqual(pool.count, 2)
+
+            for expected in [round, round + 1] {
+                let pair = pool.take()
+                XCTAssertEqual(pair?.privateKey, AmplifyBigInt(expected))
+                XCTAssertEqual(pair?.publicKey, AmplifyBigInt(expected + 100))
+            }
+            XCTAssertEqual(pool.count, 0)
+        }
+    }
+
+    func testPutMovesThePair() {
+        let pool = AmplifySRPKeyPool(capacity: 1)
+        let privateKey = AmplifyBigInt(7)
+        let publicKey = AmplifyBigInt(8)
+
+        XCTAssertTrue(pool.put(privateKey: privateKey, publicKey: publicKey))
+        XCTAssertEqual(privateKey, AmplifyBigInt(0))
+        XCTAssertEqual(publicKey, AmplifyBigInt(0))
+    }
+
+    func testFullPoolRejectsPut() {
+        let pool = AmplifySRPKeyPool(capacity: 1)
+        XCTAssertTrue(pool.put(privateKey: AmplifyBigInt(1), publicKey: AmplifyBigInt(2)))
+
+        let privateKey = AmplifyBigInt(3)
+        XCTAssertFalse(pool.put(privateKey: privateKey, publicKey: AmplifyBigInt(4)))
+        XCTAssertEqual(privateKey, AmplifyBigInt(3))
+        XCTAssertEqual(pool.take()?.privateKey, AmplifyBigInt(1))
+    }
+}
@@ -0,0 +1,82 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import AmplifyBigInteger
+import XCTest
+
+final class BigIntegerTests: XCTestCase {
+
+    func testCopiesAreIndependent() {
+        var first = BigInteger(1_000)
+        let second = first
+
+        first += 1
+        first *= 3
+        XCTAssertEqual(first, BigInteger(3_003))
+        XCTAssertEqual(second, BigInteger(1_000))
+    }
+
+    func testSharedReferenceIsNotMutated() {
+        let reference = AmplifyBigInt(42)
+        var number = BigInteger(reference)
+
+        number -= 2
+        XCTAssertEqual(number, BigInteger(40))
+        XCTAssertEqual(reference, AmplifyBigInt(42))
+    }
+
+    func testCopiedReferenceCanBeConsumed() {
+        let number = BigInteger(42)
+        let copy = number
+        let reference = number.copiedReference
+        XCTAssertNotEqual(ObjectIdentifier(reference), ObjectIdentifier(number.reference))
+
+        // put moves the digits out and leaves its argument zero
+        let pool = AmplifySRPKeyPool(capacity: 1)
+        XCTAssertTrue(pool.put(privateKey: reference, publicKey: AmplifyBigInt(1)))
+        XCTAssertEqual(reference, AmplifyBigInt(0))
+        XCTAssertEqual(number, BigInteger(42))
+        XCTAssertEqual(copy, BigInteger(42))
+        XCTAssertEqual(pool.take()?.privateKey, AmplifyBigInt(42))
+    }
+
+    func testUniqueValueKeepsItsStorage() {
+        var number = BigInteger("123456789012345678901234567890")!
+        number *= 2
+        let storage = ObjectIdentifier(number.reference)
+
+        number += 1
+        number -= 1
+        number /= 2
+        number %= BigInteger(1_000_000_007)
+        XCTAssertEqual(ObjectIdentifier(number.reference), storage)
+        XCTAssertEqual(number, BigInteger("123456789012345678901234567890")! % BigInteger(1_000_000_007))
+    }
+
+    func testSelfAssignment() {
+        var number = BigInteger(12)
+        number *= number
+        number += number
+        XCTAssertEqual(number, BigInteger(288))
+    }
+
+    func testDivisionTruncates() {
+        XCTAssertEqual(BigInteger(-7) / BigInteger(2), BigInteger(-3))
+        XCTAssertEqual(BigInteger(-7) % BigInteger(2), BigInteger(-1))
+
+        var number = BigInteger(7)
+        number.negate()
+        XCTAssertEqual(number, BigInteger(-7))
+    }
+
+    func testFormPower() {
+        let modulus = BigInteger(1_000_003)
+        var power = BigInteger(3)
+        power.formPower(BigInteger(65_537), modulus: modulus)
+        XCTAssertEqual(power, BigInteger(3).pow(BigInteger(65_537), modulus: modulus))
+    }
+}
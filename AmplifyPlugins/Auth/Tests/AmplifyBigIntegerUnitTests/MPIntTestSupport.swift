@@ -0,0 +1,64 @@
+//
+// Copyright Amazon.com Inc. or its affiliates.
+// All Rights Reserved.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+import libtommathAmplify
+import XCTest
+
+/// A bare amplify_mp_int for tests that call the C routines directly,
+/// e.g. to reach an argument combination the Swift API never passes.
+final class MPInt {
+
+    var value = amplify_mp_int(used: 0, alloc: 0, sign: AMPLIFY_MP_ZPOS, dp: nil)
+
+    init() {
+        let result = amplify_mp_init(&value)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_init failed: \(result)")
+    }
+
+    convenience init(hex: String) {
+        self.init()
+        let result = amplify_mp_read_radix(&value, hex.uppercased(), 16)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_read_radix failed: \(result)")
+    }
+
+    convenience init(_ int: Int64) {
+        self.init()
+        amplify_mp_set_i64(&value, int)
+    }
+
+    /// A random number of `digits` limbs and random sign, every limb all ones if `allOnes`
+    convenience init<G: RandomNumberGenerator>(randomDigits digits: Int, allOnes: Bool = false, using generator: inout G) {
+        self.init()
+        let result = amplify_mp_grow(&value, Int32(max(digits, 1)))
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_grow failed: \(result)")
+        let mask: amplify_mp_digit = (1 << AMPLIFY_MP_DIGIT_BIT) - 1
+        for i in 0 ..< digits {
+            value.dp[i] = allOnes ? mask : amplify_mp_digit.random(in: 0 ... mask, using: &generator)
+        }
+        value.used = Int32(digits)
+        value.sign = Bool.random(using: &generator) ? AMPLIFY_MP_NEG : AMPLIFY_MP_ZPOS
+        amplify_mp_clamp(&value)
+    }
+
+    deinit {
+        amplify_mp_clear(&value)
+    }
+
+    var hex: String {
+        var size: Int32 = 0
+        var result = amplify_mp_radix_size(&value, 16, &size)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_radix_size failed: \(result)")
+        var buffer = [CChar](repeating: 0, count: Int(size))
+        result = amplify_mp_to_radix(&value, &buffer, Int(size), nil, 16)
+        precondition(result == AMPLIFY_MP_OKAY, "amplify_mp_to_radix failed: \(result)")
+        return String(cString: buffer)
+    }
+}
+
+func XCTAssertEqualMP(_ lhs: MPInt, _ rhs: MPInt, _ message: @autoclosure () -> String = "", file: StaticString = #filePath, line: UInt = #line) {
+    XCTAssertEqual(amplify_mp_cmp(&lhs.value, &rhs.value), AMPLIFY_MP_EQ, "\(lhs.hex) != \(rhs.hex) \(message())", file: file, line: line)
+}
@@ -222,9 +222,31 @@ let authTargets: [Target] = [
     .testTarget(
         name: "AmplifyBigIntegerTests",
         dependencies: [
-            "AmplifyBigInteger"
+            "AmplifyBigInteger",
+            "libtommathAmplify"
         ],
         path: "AmplifyPlugins/Auth/Tests/AmplifyBigIntegerUnitTests"
+    ),
+    .executableTarget(
+        name: "libtommathAmplifyBenchmark",
+        dependencies: [
+            "libtommathAmplify"
+        ],
+        path: "AmplifyPlugins/Auth/Benchmarks/libtommathAmplifyBenchmark"
+    ),
+    .target(
+        name: "AmplifySRPBenchmarkSupport",
+        path: "AmplifyPlugins/Auth/Benchmarks/AmplifySRPBenchmarkSupport"
+    ),
+    .executableTarget(
+        name: "AmplifySRPBenchmark",
+        dependencies: [
+            "AWSCognitoAuthPlugin",
+            "AmplifyBigInteger",
+            "AmplifySRP",
+            "AmplifySRPBenchmarkSupport"
+        ],
+        path: "AmplifyPlugins/Auth/Benchmarks/AmplifySRPBenchmark"
     )
 ]
 